@@ -0,0 +1,572 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+// Public API
+#include <la/networkInterfaceHelper/networkInterfaceHelper.hpp>
+#include <la/networkInterfaceHelper/ipAddressArray.hpp>
+#include <la/networkInterfaceHelper/ipPrefix.hpp>
+#include <la/networkInterfaceHelper/ipFamilyAddress.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+#include <array>
+#include <cstdint>
+
+/* ************************************************************ */
+/* IPAddress Benchmarks                                         */
+/* ************************************************************ */
+static void IPAddress_ParseV4(benchmark::State& state)
+{
+	auto const str = std::string{ "192.168.100.254" };
+	for (auto _ : state)
+	{
+		auto const ip = la::networkInterface::IPAddress{ str };
+		benchmark::DoNotOptimize(ip);
+	}
+}
+BENCHMARK(IPAddress_ParseV4);
+
+static void IPAddress_ParseV6(benchmark::State& state)
+{
+	auto const str = std::string{ "fe80::1ff:fe23:4567:890a" };
+	for (auto _ : state)
+	{
+		auto const ip = la::networkInterface::IPAddress{ str };
+		benchmark::DoNotOptimize(ip);
+	}
+}
+BENCHMARK(IPAddress_ParseV6);
+
+static void IPAddress_FormatV4(benchmark::State& state)
+{
+	auto const ip = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v4{ 192, 168, 100, 254 } };
+	for (auto _ : state)
+	{
+		auto const str = static_cast<std::string>(ip);
+		benchmark::DoNotOptimize(str);
+	}
+}
+BENCHMARK(IPAddress_FormatV4);
+
+static void IPAddress_FormatV6(benchmark::State& state)
+{
+	auto const ip = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v6{ 0xfe80, 0, 0, 0, 0x01ff, 0xfe23, 0x4567, 0x890a } };
+	for (auto _ : state)
+	{
+		auto const str = static_cast<std::string>(ip);
+		benchmark::DoNotOptimize(str);
+	}
+}
+BENCHMARK(IPAddress_FormatV6);
+
+static void IPAddress_ConstructV4(benchmark::State& state)
+{
+	auto value = la::networkInterface::IPAddress::value_type_v4{ 10, 0, 0, 1 };
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(value);
+		auto const ip = la::networkInterface::IPAddress{ value };
+		benchmark::DoNotOptimize(ip);
+	}
+}
+BENCHMARK(IPAddress_ConstructV4);
+
+static void IPAddress_PackedV4(benchmark::State& state)
+{
+	auto const ip = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v4{ 10, 0, 0, 1 } };
+	for (auto _ : state)
+	{
+		auto const packed = ip.getIPV4Packed();
+		benchmark::DoNotOptimize(packed);
+		auto const fromPacked = la::networkInterface::IPAddress{ packed };
+		benchmark::DoNotOptimize(fromPacked);
+	}
+}
+BENCHMARK(IPAddress_PackedV4);
+
+static void IPAddress_PackedV6(benchmark::State& state)
+{
+	auto const ip = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v6{ 0xfe80, 0, 0, 0, 0x01ff, 0xfe23, 0x4567, 0x890a } };
+	for (auto _ : state)
+	{
+		auto const packed = ip.getIPV6Packed();
+		benchmark::DoNotOptimize(packed);
+		auto const fromPacked = la::networkInterface::IPAddress{ packed };
+		benchmark::DoNotOptimize(fromPacked);
+	}
+}
+BENCHMARK(IPAddress_PackedV6);
+
+static void IPAddress_IncrementV4(benchmark::State& state)
+{
+	auto ip = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v4{ 10, 0, 0, 1 } };
+	for (auto _ : state)
+	{
+		++ip;
+		benchmark::DoNotOptimize(ip);
+	}
+}
+BENCHMARK(IPAddress_IncrementV4);
+
+static void IPAddress_AddV4(benchmark::State& state)
+{
+	auto const ip = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v4{ 10, 0, 0, 1 } };
+	for (auto _ : state)
+	{
+		auto const result = ip + 1000u;
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(IPAddress_AddV4);
+
+static void IPAddress_AndV6(benchmark::State& state)
+{
+	auto const ip = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v6{ 0xfe80, 0, 0, 0, 0x01ff, 0xfe23, 0x4567, 0x890a } };
+	auto const mask = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v6{ 0xffff, 0xffff, 0xffff, 0xffff, 0, 0, 0, 0 } };
+	for (auto _ : state)
+	{
+		auto const result = ip & mask;
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(IPAddress_AndV6);
+
+static void IPAddress_Compare(benchmark::State& state)
+{
+	auto const lhs = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v4{ 10, 0, 0, 1 } };
+	auto const rhs = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v4{ 10, 0, 0, 2 } };
+	for (auto _ : state)
+	{
+		auto const result = lhs < rhs;
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(IPAddress_Compare);
+
+static void IPAddress_HashV4(benchmark::State& state)
+{
+	auto const ip = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v4{ 10, 0, 0, 1 } };
+	auto const hasher = la::networkInterface::IPAddress::hash{};
+	for (auto _ : state)
+	{
+		auto const h = hasher(ip);
+		benchmark::DoNotOptimize(h);
+	}
+}
+BENCHMARK(IPAddress_HashV4);
+
+static void IPAddress_HashV6(benchmark::State& state)
+{
+	auto const ip = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v6{ 0xfe80, 0, 0, 0, 0x01ff, 0xfe23, 0x4567, 0x890a } };
+	auto const hasher = la::networkInterface::IPAddress::hash{};
+	for (auto _ : state)
+	{
+		auto const h = hasher(ip);
+		benchmark::DoNotOptimize(h);
+	}
+}
+BENCHMARK(IPAddress_HashV6);
+
+static void IPAddress_PrefixLengthV6(benchmark::State& state)
+{
+	auto length = std::uint8_t{ 64u };
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(length);
+		auto const packed = la::networkInterface::IPAddress::packedV6FromPrefixLength(length);
+		auto const result = la::networkInterface::IPAddress::prefixLengthFromPackedV6(packed);
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(IPAddress_PrefixLengthV6);
+
+static void IPAddress_AddV6(benchmark::State& state)
+{
+	auto const ip = la::networkInterface::IPAddress{ "2001:db8::ffff:ffff:ffff:fff0" };
+	for (auto _ : state)
+	{
+		auto const result = ip + 0x20u;
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(IPAddress_AddV6);
+
+static void IPAddress_PackedAddV6(benchmark::State& state)
+{
+	auto packed = la::networkInterface::IPAddress::value_type_packed_v6{ 0x20010db800000000, 0xfffffffffffffff0 };
+	auto offset = la::networkInterface::UInt128{ 0x1u, 0x20u };
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(packed);
+		benchmark::DoNotOptimize(offset);
+		auto const result = la::networkInterface::IPAddress::add(packed, offset);
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(IPAddress_PackedAddV6);
+
+/* ************************************************************ */
+/* IPAddressInfo Benchmarks                                     */
+/* ************************************************************ */
+static void IPAddressInfo_GetNetworkBaseAddressV4(benchmark::State& state)
+{
+	auto const info = la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "192.168.100.254" }, la::networkInterface::IPAddress{ "255.255.255.0" } };
+	for (auto _ : state)
+	{
+		auto const base = info.getNetworkBaseAddress();
+		benchmark::DoNotOptimize(base);
+	}
+}
+BENCHMARK(IPAddressInfo_GetNetworkBaseAddressV4);
+
+static void IPAddressInfo_GetNetworkBaseAddressV6(benchmark::State& state)
+{
+	auto const info = la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "fe80::1ff:fe23:4567:890a" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff::" } };
+	for (auto _ : state)
+	{
+		auto const base = info.getNetworkBaseAddress();
+		benchmark::DoNotOptimize(base);
+	}
+}
+BENCHMARK(IPAddressInfo_GetNetworkBaseAddressV6);
+
+static void IPAddressInfo_GetBroadcastAddressV4(benchmark::State& state)
+{
+	auto const info = la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "192.168.100.254" }, la::networkInterface::IPAddress{ "255.255.255.0" } };
+	for (auto _ : state)
+	{
+		auto const broadcast = info.getBroadcastAddress();
+		benchmark::DoNotOptimize(broadcast);
+	}
+}
+BENCHMARK(IPAddressInfo_GetBroadcastAddressV4);
+
+static void IPAddressInfo_IsPrivateNetworkAddress(benchmark::State& state)
+{
+	auto const infos = std::vector<la::networkInterface::IPAddressInfo>{
+		{ la::networkInterface::IPAddress{ "10.1.2.3" }, la::networkInterface::IPAddress{ "255.0.0.0" } },
+		{ la::networkInterface::IPAddress{ "172.16.5.4" }, la::networkInterface::IPAddress{ "255.240.0.0" } },
+		{ la::networkInterface::IPAddress{ "192.168.1.1" }, la::networkInterface::IPAddress{ "255.255.0.0" } },
+		{ la::networkInterface::IPAddress{ "8.8.8.8" }, la::networkInterface::IPAddress{ "255.255.255.0" } },
+	};
+	for (auto _ : state)
+	{
+		for (auto const& info : infos)
+		{
+			auto const result = info.isPrivateNetworkAddress();
+			benchmark::DoNotOptimize(result);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(infos.size()));
+}
+BENCHMARK(IPAddressInfo_IsPrivateNetworkAddress);
+
+static std::vector<std::string> makeCidrStrings()
+{
+	auto strings = std::vector<std::string>{};
+	for (auto i = 0u; i < 1024u; ++i)
+	{
+		strings.push_back("10." + std::to_string(i >> 8) + "." + std::to_string(i & 0xFF) + ".1/" + std::to_string(8u + (i % 25u)));
+		strings.push_back("2001:db8:" + std::to_string(i) + "::1/" + std::to_string(32u + (i % 97u)));
+	}
+	return strings;
+}
+
+static void IPAddressInfo_CidrFromString(benchmark::State& state)
+{
+	// Equivalent of ipAddressInfoFromChars using the string API
+	auto const strings = makeCidrStrings();
+	for (auto _ : state)
+	{
+		for (auto const& str : strings)
+		{
+			auto const separator = str.find('/');
+			auto const address = la::networkInterface::IPAddress{ str.substr(0, separator) };
+			auto const length = static_cast<std::uint8_t>(std::stoul(str.substr(separator + 1)));
+			auto const info = address.getType() == la::networkInterface::IPAddress::Type::V4 ? la::networkInterface::IPAddressInfo{ address, la::networkInterface::IPAddress{ static_cast<la::networkInterface::IPAddress::value_type_packed_v4>(~std::uint64_t{ 0u } << (32u - length)) } } : la::networkInterface::IPAddressInfo{ address, la::networkInterface::IPAddress{ la::networkInterface::IPAddress::packedV6FromPrefixLength(length) } };
+			benchmark::DoNotOptimize(info);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(strings.size()));
+}
+BENCHMARK(IPAddressInfo_CidrFromString);
+
+static void IPAddressInfo_CidrFromChars(benchmark::State& state)
+{
+	auto const strings = makeCidrStrings();
+	for (auto _ : state)
+	{
+		for (auto const& str : strings)
+		{
+			auto info = la::networkInterface::IPAddressInfo{};
+			auto const result = la::networkInterface::NetworkInterfaceHelper::ipAddressInfoFromChars(str.data(), str.data() + str.size(), info);
+			benchmark::DoNotOptimize(result);
+			benchmark::DoNotOptimize(info);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(strings.size()));
+}
+BENCHMARK(IPAddressInfo_CidrFromChars);
+
+static void IPAddressInfo_CidrToString(benchmark::State& state)
+{
+	// Equivalent of ipAddressInfoToChars using the string API
+	auto const strings = makeCidrStrings();
+	auto infos = std::vector<la::networkInterface::IPAddressInfo>(strings.size());
+	for (auto i = 0u; i < strings.size(); ++i)
+	{
+		la::networkInterface::NetworkInterfaceHelper::ipAddressInfoFromChars(strings[i].data(), strings[i].data() + strings[i].size(), infos[i]);
+	}
+	for (auto _ : state)
+	{
+		for (auto const& info : infos)
+		{
+			auto length = 0u;
+			if (info.address.getType() == la::networkInterface::IPAddress::Type::V4)
+			{
+				for (auto mask = info.netmask.getIPV4Packed(); mask != 0; mask <<= 1)
+				{
+					++length;
+				}
+			}
+			else
+			{
+				length = la::networkInterface::IPAddress::prefixLengthFromPackedV6(info.netmask.getIPV6Packed());
+			}
+			auto const str = static_cast<std::string>(info.address) + "/" + std::to_string(length);
+			benchmark::DoNotOptimize(str);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(infos.size()));
+}
+BENCHMARK(IPAddressInfo_CidrToString);
+
+static void IPAddressInfo_CidrToChars(benchmark::State& state)
+{
+	auto const strings = makeCidrStrings();
+	auto infos = std::vector<la::networkInterface::IPAddressInfo>(strings.size());
+	for (auto i = 0u; i < strings.size(); ++i)
+	{
+		la::networkInterface::NetworkInterfaceHelper::ipAddressInfoFromChars(strings[i].data(), strings[i].data() + strings[i].size(), infos[i]);
+	}
+	auto buffer = std::array<char, la::networkInterface::IPAddressInfoCharsMaxLength>{};
+	for (auto _ : state)
+	{
+		for (auto const& info : infos)
+		{
+			auto const result = la::networkInterface::NetworkInterfaceHelper::ipAddressInfoToChars(buffer.data(), buffer.data() + buffer.size(), info);
+			benchmark::DoNotOptimize(result);
+			benchmark::DoNotOptimize(buffer);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(infos.size()));
+}
+BENCHMARK(IPAddressInfo_CidrToChars);
+
+/* ************************************************************ */
+/* IPPrefix Benchmarks                                          */
+/* ************************************************************ */
+static void IPPrefix_GetNetworkValueV6(benchmark::State& state)
+{
+	auto const prefix = la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "fe80::1ff:fe23:4567:890a" }, 64u };
+	for (auto _ : state)
+	{
+		auto const base = prefix.getNetworkValue();
+		benchmark::DoNotOptimize(base);
+	}
+}
+BENCHMARK(IPPrefix_GetNetworkValueV6);
+
+static void IPAddressInfo_ContainsV4(benchmark::State& state)
+{
+	auto const info = la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "192.168.100.254" }, la::networkInterface::IPAddress{ "255.255.255.0" } };
+	auto const base = info.getNetworkBaseAddress();
+	auto ip = la::networkInterface::IPAddress::value_type_packed_v4{ 0xC0A86400u };
+	for (auto _ : state)
+	{
+		// Equivalent of IPPrefix::contains using the IPAddressInfo API (netmask validated on each call)
+		auto const result = info.getNetworkBaseAddress() == base && (ip & info.netmask.getIPV4Packed()) == base.getIPV4Packed();
+		benchmark::DoNotOptimize(result);
+		++ip;
+	}
+}
+BENCHMARK(IPAddressInfo_ContainsV4);
+
+static void IPPrefix_ContainsV4(benchmark::State& state)
+{
+	auto const prefix = la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "192.168.100.254" }, 24u };
+	auto ip = la::networkInterface::IPAddress::value_type_packed_v4{ 0xC0A86400u };
+	for (auto _ : state)
+	{
+		auto const result = prefix.contains(ip);
+		benchmark::DoNotOptimize(result);
+		++ip;
+	}
+}
+BENCHMARK(IPPrefix_ContainsV4);
+
+/* ************************************************************ */
+/* IPV4Address/IPV6Address Benchmarks                           */
+/* ************************************************************ */
+static void IPV4Address_AddV4(benchmark::State& state)
+{
+	auto ip = la::networkInterface::IPV4Address{ 10u, 0u, 0u, 1u };
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(ip);
+		auto const result = ip + 1000u;
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(IPV4Address_AddV4);
+
+static void IPV6Address_AndV6(benchmark::State& state)
+{
+	auto ip = la::networkInterface::IPV6Address{ la::networkInterface::IPV6Address::value_type{ 0xfe80, 0, 0, 0, 0x01ff, 0xfe23, 0x4567, 0x890a } };
+	auto const mask = la::networkInterface::IPV6Address::makeNetmask(64u);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(ip);
+		auto const result = ip & mask;
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(IPV6Address_AndV6);
+
+static void IPV4Address_IsInSameSubnet(benchmark::State& state)
+{
+	auto const network = la::networkInterface::IPV4Address{ 192u, 168u, 100u, 0u };
+	auto ip = la::networkInterface::IPV4Address{ 192u, 168u, 100u, 0u };
+	for (auto _ : state)
+	{
+		auto const result = la::networkInterface::isInSameSubnet(ip, network, 24u);
+		benchmark::DoNotOptimize(result);
+		++ip;
+	}
+}
+BENCHMARK(IPV4Address_IsInSameSubnet);
+
+/* ************************************************************ */
+/* IPAddressArray Benchmarks                                    */
+/* ************************************************************ */
+static la::networkInterface::IPAddressArray makeIPAddressArray(std::size_t const count)
+{
+	auto array = la::networkInterface::IPAddressArray{};
+	array.reserve(count, count);
+	for (auto i = std::size_t{ 0u }; i < count; ++i)
+	{
+		array.addV4(static_cast<la::networkInterface::IPAddress::value_type_packed_v4>(0xC0A80000u + (i * 2654435761u >> 16)));
+		array.addV6(la::networkInterface::IPAddress::value_type_packed_v6{ 0x20010db800000000u + (i & 0xFFFFu), i * 0x9E3779B97F4A7C15u });
+	}
+	return array;
+}
+
+static void IPAddressArray_InSubnetV4(benchmark::State& state)
+{
+	auto const count = static_cast<std::size_t>(state.range(0));
+	auto const array = makeIPAddressArray(count);
+	auto const subnet = la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "192.168.128.0" }, la::networkInterface::IPAddress{ "255.255.128.0" } };
+	auto results = std::vector<std::uint8_t>(count);
+	for (auto _ : state)
+	{
+		auto const found = array.inSubnet(subnet, results.data());
+		benchmark::DoNotOptimize(found);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+	state.SetLabel(la::networkInterface::IPAddressArray::getKernelsInstructionSet());
+}
+BENCHMARK(IPAddressArray_InSubnetV4)->Arg(1 << 20);
+
+static void IPAddressArray_InSubnetV6(benchmark::State& state)
+{
+	auto const count = static_cast<std::size_t>(state.range(0));
+	auto const array = makeIPAddressArray(count);
+	auto const subnet = la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "2001:db8::" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff:fff0::" } };
+	auto results = std::vector<std::uint8_t>(count);
+	for (auto _ : state)
+	{
+		auto const found = array.inSubnet(subnet, results.data());
+		benchmark::DoNotOptimize(found);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+	state.SetLabel(la::networkInterface::IPAddressArray::getKernelsInstructionSet());
+}
+BENCHMARK(IPAddressArray_InSubnetV6)->Arg(1 << 20);
+
+static void IPAddressArray_CountInSubnetsV4(benchmark::State& state)
+{
+	auto const count = static_cast<std::size_t>(state.range(0));
+	auto const array = makeIPAddressArray(count);
+	auto const subnets = std::vector<la::networkInterface::IPAddressInfo>{
+		{ la::networkInterface::IPAddress{ "192.168.0.0" }, la::networkInterface::IPAddress{ "255.255.240.0" } },
+		{ la::networkInterface::IPAddress{ "192.168.64.0" }, la::networkInterface::IPAddress{ "255.255.192.0" } },
+		{ la::networkInterface::IPAddress{ "192.168.200.0" }, la::networkInterface::IPAddress{ "255.255.255.0" } },
+		{ la::networkInterface::IPAddress{ "10.0.0.0" }, la::networkInterface::IPAddress{ "255.0.0.0" } },
+	};
+	for (auto _ : state)
+	{
+		auto const found = array.countInSubnets(subnets);
+		benchmark::DoNotOptimize(found);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+	state.SetLabel(la::networkInterface::IPAddressArray::getKernelsInstructionSet());
+}
+BENCHMARK(IPAddressArray_CountInSubnetsV4)->Arg(1 << 20);
+
+static void IPAddress_InSubnetV4(benchmark::State& state)
+{
+	auto const count = static_cast<std::size_t>(state.range(0));
+	auto addresses = std::vector<la::networkInterface::IPAddress>{};
+	addresses.reserve(count);
+	for (auto i = std::size_t{ 0u }; i < count; ++i)
+	{
+		addresses.emplace_back(static_cast<la::networkInterface::IPAddress::value_type_packed_v4>(0xC0A80000u + (i * 2654435761u >> 16)));
+	}
+	auto const netmask = la::networkInterface::IPAddress{ "255.255.128.0" };
+	auto const network = la::networkInterface::IPAddress{ "192.168.128.0" };
+	for (auto _ : state)
+	{
+		auto found = std::size_t{ 0u };
+		for (auto const& ip : addresses)
+		{
+			found += static_cast<std::size_t>((ip & netmask) == network);
+		}
+		benchmark::DoNotOptimize(found);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+BENCHMARK(IPAddress_InSubnetV4)->Arg(1 << 16);
@@ -0,0 +1,230 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+// Public API
+#include <la/networkInterfaceHelper/networkInterfaceHelper.hpp>
+#include <la/networkInterfaceHelper/packedMacAddress.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <array>
+#include <vector>
+#include <unordered_set>
+#include <random>
+#include <algorithm> // sort
+#include <memory> // make_unique
+
+/* ************************************************************ */
+/* MacAddress Benchmarks                                        */
+/* ************************************************************ */
+static void MacAddress_ToString(benchmark::State& state)
+{
+	auto const macAddress = la::networkInterface::MacAddress{ 0x00, 0x1b, 0x92, 0xab, 0xcd, 0xef };
+	for (auto _ : state)
+	{
+		auto const str = la::networkInterface::NetworkInterfaceHelper::macAddressToString(macAddress);
+		benchmark::DoNotOptimize(str);
+	}
+}
+BENCHMARK(MacAddress_ToString);
+
+static void MacAddress_FromString(benchmark::State& state)
+{
+	auto const str = std::string{ "00:1B:92:AB:CD:EF" };
+	for (auto _ : state)
+	{
+		auto const macAddress = la::networkInterface::NetworkInterfaceHelper::stringToMacAddress(str);
+		benchmark::DoNotOptimize(macAddress);
+	}
+}
+BENCHMARK(MacAddress_FromString);
+
+static void MacAddress_ToChars(benchmark::State& state)
+{
+	auto const macAddress = la::networkInterface::MacAddress{ 0x00, 0x1b, 0x92, 0xab, 0xcd, 0xef };
+	auto buffer = std::array<char, 17>{};
+	for (auto _ : state)
+	{
+		auto const result = la::networkInterface::NetworkInterfaceHelper::macAddressToChars(buffer.data(), buffer.data() + buffer.size(), macAddress);
+		benchmark::DoNotOptimize(result);
+		benchmark::ClobberMemory();
+	}
+}
+BENCHMARK(MacAddress_ToChars);
+
+static void MacAddress_FromChars(benchmark::State& state)
+{
+	auto const str = std::string{ "00:1B:92:AB:CD:EF" };
+	for (auto _ : state)
+	{
+		auto macAddress = la::networkInterface::MacAddress{};
+		auto const result = la::networkInterface::NetworkInterfaceHelper::macAddressFromChars(str.data(), str.data() + str.size(), macAddress, la::networkInterface::MacAddressNotation::Colon);
+		benchmark::DoNotOptimize(result);
+		benchmark::DoNotOptimize(macAddress);
+	}
+}
+BENCHMARK(MacAddress_FromChars);
+
+static void MacAddress_BatchToChars(benchmark::State& state)
+{
+	auto const count = static_cast<size_t>(state.range(0));
+	auto macAddresses = std::vector<la::networkInterface::MacAddress>(count);
+	for (auto index = size_t{ 0u }; index < count; ++index)
+	{
+		macAddresses[index] = la::networkInterface::MacAddress{ 0x00, 0x1b, 0x92, static_cast<std::uint8_t>(index >> 16), static_cast<std::uint8_t>(index >> 8), static_cast<std::uint8_t>(index) };
+	}
+	auto buffer = std::vector<char>(count * (la::networkInterface::getMacAddressCharsLength(la::networkInterface::MacAddressNotation::Colon) + 1u));
+	for (auto _ : state)
+	{
+		auto const result = la::networkInterface::NetworkInterfaceHelper::macAddressesToChars(buffer.data(), buffer.data() + buffer.size(), macAddresses.data(), count);
+		benchmark::DoNotOptimize(result);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(MacAddress_BatchToChars)->Arg(1024);
+
+static void MacAddress_BatchFromChars(benchmark::State& state)
+{
+	auto const count = static_cast<size_t>(state.range(0));
+	auto macAddresses = std::vector<la::networkInterface::MacAddress>(count, la::networkInterface::MacAddress{ 0x00, 0x1b, 0x92, 0xab, 0xcd, 0xef });
+	auto buffer = std::vector<char>(count * (la::networkInterface::getMacAddressCharsLength(la::networkInterface::MacAddressNotation::Colon) + 1u));
+	la::networkInterface::NetworkInterfaceHelper::macAddressesToChars(buffer.data(), buffer.data() + buffer.size(), macAddresses.data(), count);
+	for (auto _ : state)
+	{
+		auto const parsed = la::networkInterface::NetworkInterfaceHelper::macAddressesFromChars(buffer.data(), buffer.data() + buffer.size(), macAddresses.data(), count);
+		benchmark::DoNotOptimize(parsed);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(MacAddress_BatchFromChars)->Arg(1024);
+
+static void MacAddress_IsValid(benchmark::State& state)
+{
+	auto const macAddress = la::networkInterface::MacAddress{ 0x00, 0x1b, 0x92, 0xab, 0xcd, 0xef };
+	for (auto _ : state)
+	{
+		auto const result = la::networkInterface::NetworkInterfaceHelper::isMacAddressValid(macAddress);
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(MacAddress_IsValid);
+
+static void MacAddress_Hash(benchmark::State& state)
+{
+	auto const macAddress = la::networkInterface::MacAddress{ 0x00, 0x1b, 0x92, 0xab, 0xcd, 0xef };
+	auto const hasher = la::networkInterface::MacAddressHash{};
+	for (auto _ : state)
+	{
+		auto const h = hasher(macAddress);
+		benchmark::DoNotOptimize(h);
+	}
+}
+BENCHMARK(MacAddress_Hash);
+
+static void MacAddress_Vendor(benchmark::State& state)
+{
+	auto const macAddress = la::networkInterface::MacAddress{ 0x00, 0x1b, 0x92, 0xab, 0xcd, 0xef };
+	for (auto _ : state)
+	{
+		auto const vendor = la::networkInterface::NetworkInterfaceHelper::getMacAddressVendor(macAddress);
+		benchmark::DoNotOptimize(vendor);
+	}
+}
+BENCHMARK(MacAddress_Vendor);
+
+/* ************************************************************ */
+/* PackedMacAddress Benchmarks                                  */
+/* ************************************************************ */
+static std::vector<la::networkInterface::PackedMacAddress> makeRandomAddresses(size_t const count, std::uint32_t const seed)
+{
+	auto generator = std::mt19937_64{ seed };
+	auto addresses = std::vector<la::networkInterface::PackedMacAddress>(count);
+	for (auto& address : addresses)
+	{
+		address = la::networkInterface::PackedMacAddress{ generator() };
+	}
+	return addresses;
+}
+
+static void MacAddressFlatSet_Contains(benchmark::State& state)
+{
+	auto const count = static_cast<size_t>(state.range(0));
+	auto const set = la::networkInterface::MacAddressFlatSet{ makeRandomAddresses(count, 1u) };
+	auto const queries = makeRandomAddresses(1024, 2u);
+	for (auto _ : state)
+	{
+		for (auto const& query : queries)
+		{
+			benchmark::DoNotOptimize(set.contains(query));
+		}
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(MacAddressFlatSet_Contains)->Arg(1024)->Arg(65536);
+
+static void MacAddressFlatSet_BulkContainsSorted(benchmark::State& state)
+{
+	auto const count = static_cast<size_t>(state.range(0));
+	auto const set = la::networkInterface::MacAddressFlatSet{ makeRandomAddresses(count, 1u) };
+	auto queries = makeRandomAddresses(1024, 2u);
+	std::sort(queries.begin(), queries.end());
+	auto results = std::make_unique<bool[]>(queries.size());
+	for (auto _ : state)
+	{
+		auto const found = set.contains(queries.data(), queries.size(), results.get());
+		benchmark::DoNotOptimize(found);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(MacAddressFlatSet_BulkContainsSorted)->Arg(1024)->Arg(65536);
+
+static void MacAddressUnorderedSet_Contains(benchmark::State& state)
+{
+	auto const count = static_cast<size_t>(state.range(0));
+	auto const addresses = makeRandomAddresses(count, 1u);
+	auto const set = std::unordered_set<la::networkInterface::PackedMacAddress, la::networkInterface::PackedMacAddress::hash>{ addresses.begin(), addresses.end() };
+	auto const queries = makeRandomAddresses(1024, 2u);
+	for (auto _ : state)
+	{
+		for (auto const& query : queries)
+		{
+			benchmark::DoNotOptimize(set.count(query));
+		}
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(MacAddressUnorderedSet_Contains)->Arg(1024)->Arg(65536);
@@ -0,0 +1,829 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+* End-to-end benchmark of the helper on Linux, from kernel events to Observer notifications.
+* Runs in its own (unprivileged) user and network namespaces, with N veth (or dummy) interfaces, so no real network nor privilege is required.
+* Measures the cost of a full enumeration and the latency between a netlink request (link up/down, address added/removed) and the matching Observer callback,
+* for each dispatch mode (internal event thread, external event loop, network namespace instance), each mode running in its own forked process.
+*/
+
+// Public API
+#include <la/networkInterfaceHelper/networkInterfaceHelper.hpp>
+
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/if_link.h>
+#include <linux/veth.h>
+#include <net/if.h>
+#include <arpa/inet.h>
+#include <sched.h>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct Options
+{
+	std::size_t interfacesCount{ 16u };
+	std::size_t iterations{ 200u };
+	std::string kind{ "veth" };
+	std::vector<std::string> modes{ "thread", "external", "namespace" };
+	std::string jsonPath{};
+};
+
+/* ************************************************************ */
+/* Netlink requests                                             */
+/* ************************************************************ */
+class NetlinkMessage
+{
+public:
+	NetlinkMessage(std::uint16_t const type, std::uint16_t const flags)
+	{
+		auto header = nlmsghdr{};
+		header.nlmsg_type = type;
+		header.nlmsg_flags = static_cast<std::uint16_t>(NLM_F_REQUEST | NLM_F_ACK | flags);
+		append(&header, sizeof(header));
+	}
+
+	template<typename T>
+	void appendStruct(T const& value)
+	{
+		append(&value, sizeof(value));
+	}
+
+	void addAttribute(std::uint16_t const type, void const* const data, std::size_t const length)
+	{
+		auto attr = rtattr{};
+		attr.rta_type = type;
+		attr.rta_len = static_cast<unsigned short>(RTA_LENGTH(length));
+		append(&attr, sizeof(attr));
+		append(data, length);
+	}
+
+	void addAttribute(std::uint16_t const type, std::string const& str)
+	{
+		addAttribute(type, str.c_str(), str.size() + 1);
+	}
+
+	std::size_t beginNested(std::uint16_t const type)
+	{
+		auto const offset = _buffer.size();
+		auto attr = rtattr{};
+		attr.rta_type = type;
+		append(&attr, sizeof(attr));
+		return offset;
+	}
+
+	void endNested(std::size_t const offset)
+	{
+		auto attr = rtattr{};
+		std::memcpy(&attr, _buffer.data() + offset, sizeof(attr));
+		attr.rta_len = static_cast<unsigned short>(_buffer.size() - offset);
+		std::memcpy(_buffer.data() + offset, &attr, sizeof(attr));
+	}
+
+	std::vector<std::uint8_t> const& finalize(std::uint32_t const sequence)
+	{
+		auto header = nlmsghdr{};
+		std::memcpy(&header, _buffer.data(), sizeof(header));
+		header.nlmsg_len = static_cast<std::uint32_t>(_buffer.size());
+		header.nlmsg_seq = sequence;
+		std::memcpy(_buffer.data(), &header, sizeof(header));
+		return _buffer;
+	}
+
+private:
+	void append(void const* const data, std::size_t const length)
+	{
+		auto const* const bytes = static_cast<std::uint8_t const*>(data);
+		_buffer.insert(_buffer.end(), bytes, bytes + length);
+		_buffer.resize(NLMSG_ALIGN(_buffer.size()));
+	}
+
+	std::vector<std::uint8_t> _buffer{};
+};
+
+class NetlinkSocket
+{
+public:
+	NetlinkSocket()
+	{
+		_fd = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+		if (_fd < 0)
+		{
+			throw std::runtime_error(std::string{ "Failed to open netlink socket: " } + std::strerror(errno));
+		}
+		auto addr = sockaddr_nl{};
+		addr.nl_family = AF_NETLINK;
+		if (::bind(_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0)
+		{
+			::close(_fd);
+			throw std::runtime_error(std::string{ "Failed to bind netlink socket: " } + std::strerror(errno));
+		}
+	}
+
+	~NetlinkSocket() noexcept
+	{
+		::close(_fd);
+	}
+
+	/** Sends the request and waits for its acknowledgement. Throws std::runtime_error in case of error. */
+	void request(NetlinkMessage& message)
+	{
+		auto const sequence = ++_sequence;
+		auto const& buffer = message.finalize(sequence);
+		if (::send(_fd, buffer.data(), buffer.size(), 0) < 0)
+		{
+			throw std::runtime_error(std::string{ "Failed to send netlink request: " } + std::strerror(errno));
+		}
+
+		while (true)
+		{
+			alignas(nlmsghdr) char response[8192];
+			auto len = ::recv(_fd, response, sizeof(response), 0);
+			if (len < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				throw std::runtime_error(std::string{ "Failed to receive netlink response: " } + std::strerror(errno));
+			}
+			for (auto* header = reinterpret_cast<nlmsghdr*>(response); NLMSG_OK(header, static_cast<unsigned int>(len)); header = NLMSG_NEXT(header, len))
+			{
+				if (header->nlmsg_seq == sequence && header->nlmsg_type == NLMSG_ERROR)
+				{
+					auto const* const error = static_cast<nlmsgerr const*>(NLMSG_DATA(header));
+					if (error->error != 0)
+					{
+						throw std::runtime_error(std::string{ "Netlink request failed: " } + std::strerror(-error->error));
+					}
+					return;
+				}
+			}
+		}
+	}
+
+	// Deleted compiler auto-generated methods
+	NetlinkSocket(NetlinkSocket const&) = delete;
+	NetlinkSocket(NetlinkSocket&&) = delete;
+	NetlinkSocket& operator=(NetlinkSocket const&) = delete;
+	NetlinkSocket& operator=(NetlinkSocket&&) = delete;
+
+private:
+	int _fd{ -1 };
+	std::uint32_t _sequence{ 0u };
+};
+
+void createInterface(NetlinkSocket& socket, std::string const& kind, std::string const& name)
+{
+	auto message = NetlinkMessage{ RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL };
+	message.appendStruct(ifinfomsg{});
+	message.addAttribute(IFLA_IFNAME, name);
+	auto const linkInfo = message.beginNested(IFLA_LINKINFO);
+	message.addAttribute(IFLA_INFO_KIND, kind);
+	if (kind == "veth")
+	{
+		auto const infoData = message.beginNested(IFLA_INFO_DATA);
+		auto const peer = message.beginNested(VETH_INFO_PEER);
+		message.appendStruct(ifinfomsg{});
+		message.addAttribute(IFLA_IFNAME, name + "p");
+		message.endNested(peer);
+		message.endNested(infoData);
+	}
+	message.endNested(linkInfo);
+	socket.request(message);
+}
+
+void setLinkUp(NetlinkSocket& socket, int const index, bool const up)
+{
+	auto message = NetlinkMessage{ RTM_NEWLINK, 0 };
+	auto info = ifinfomsg{};
+	info.ifi_index = index;
+	info.ifi_flags = up ? static_cast<unsigned int>(IFF_UP) : 0u;
+	info.ifi_change = IFF_UP;
+	message.appendStruct(info);
+	socket.request(message);
+}
+
+void setAddress(NetlinkSocket& socket, int const index, in_addr const address, bool const add)
+{
+	auto message = NetlinkMessage{ static_cast<std::uint16_t>(add ? RTM_NEWADDR : RTM_DELADDR), static_cast<std::uint16_t>(add ? (NLM_F_CREATE | NLM_F_EXCL) : 0) };
+	auto info = ifaddrmsg{};
+	info.ifa_family = AF_INET;
+	info.ifa_prefixlen = 24;
+	info.ifa_scope = RT_SCOPE_UNIVERSE;
+	info.ifa_index = static_cast<unsigned int>(index);
+	message.appendStruct(info);
+	message.addAttribute(IFA_LOCAL, &address, sizeof(address));
+	message.addAttribute(IFA_ADDRESS, &address, sizeof(address));
+	socket.request(message);
+}
+
+/* ************************************************************ */
+/* Namespace                                                    */
+/* ************************************************************ */
+void writeFile(std::string const& path, std::string const& content)
+{
+	auto file = std::ofstream{ path };
+	file << content;
+	if (!file.flush())
+	{
+		throw std::runtime_error("Failed to write " + path);
+	}
+}
+
+/** Moves the process into new user and network namespaces, mapping the current user to root (must be called before any thread is started) */
+void enterNamespaces()
+{
+	auto const uid = ::getuid();
+	auto const gid = ::getgid();
+	if (::unshare(CLONE_NEWUSER | CLONE_NEWNET) != 0)
+	{
+		throw std::runtime_error(std::string{ "Failed to create user and network namespaces (are unprivileged user namespaces enabled?): " } + std::strerror(errno));
+	}
+	writeFile("/proc/self/setgroups", "deny");
+	writeFile("/proc/self/uid_map", "0 " + std::to_string(uid) + " 1");
+	writeFile("/proc/self/gid_map", "0 " + std::to_string(gid) + " 1");
+}
+
+/* ************************************************************ */
+/* Statistics                                                   */
+/* ************************************************************ */
+struct Stats
+{
+	std::size_t count{ 0u };
+	double p50{ 0.0 };
+	double p90{ 0.0 };
+	double p99{ 0.0 };
+	double max{ 0.0 };
+};
+
+Stats computeStats(std::vector<double> values)
+{
+	auto stats = Stats{};
+	stats.count = values.size();
+	if (values.empty())
+	{
+		return stats;
+	}
+	std::sort(values.begin(), values.end());
+	auto const percentile = [&values](double const p)
+	{
+		auto const index = static_cast<std::size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+		return values[index];
+	};
+	stats.p50 = percentile(0.50);
+	stats.p90 = percentile(0.90);
+	stats.p99 = percentile(0.99);
+	stats.max = values.back();
+	return stats;
+}
+
+double toMicroseconds(Clock::duration const duration)
+{
+	return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+double getCpuTimeMs()
+{
+	auto usage = rusage{};
+	::getrusage(RUSAGE_SELF, &usage);
+	auto const toMs = [](timeval const& tv)
+	{
+		return static_cast<double>(tv.tv_sec) * 1000.0 + static_cast<double>(tv.tv_usec) / 1000.0;
+	};
+	return toMs(usage.ru_utime) + toMs(usage.ru_stime);
+}
+
+std::string toJson(Stats const& stats)
+{
+	auto ss = std::ostringstream{};
+	ss << "{ \"count\": " << stats.count << ", \"p50\": " << stats.p50 << ", \"p90\": " << stats.p90 << ", \"p99\": " << stats.p99 << ", \"max\": " << stats.max << " }";
+	return ss.str();
+}
+
+void printStats(char const* const name, Stats const& stats)
+{
+	std::printf("  %-28s n=%-5zu p50=%9.1f p90=%9.1f p99=%9.1f max=%9.1f (us)\n", name, stats.count, stats.p50, stats.p90, stats.p99, stats.max);
+}
+
+/* ************************************************************ */
+/* Observer                                                     */
+/* ************************************************************ */
+class LatencyObserver final : public la::networkInterface::NetworkInterfaceHelper::DefaultedObserver
+{
+public:
+	using Predicate = std::function<bool(la::networkInterface::Interface const&)>;
+
+	/** Sets the condition to wait for, on the specified interface */
+	void expect(std::string const& id, Predicate&& predicate)
+	{
+		// Lock
+		auto const lg = std::lock_guard(_lock);
+		_id = id;
+		_predicate = std::move(predicate);
+		_matchTime.reset();
+	}
+
+	/** Waits until the expected condition is notified. Returns the notification time, or std::nullopt in case of timeout */
+	std::optional<Clock::time_point> wait(std::chrono::milliseconds const timeout)
+	{
+		// Lock
+		auto lock = std::unique_lock(_lock);
+		_condition.wait_for(lock, timeout,
+			[this]()
+			{
+				return _matchTime.has_value();
+			});
+		auto const result = _matchTime;
+		_predicate = nullptr;
+		return result;
+	}
+
+private:
+	void check(la::networkInterface::Interface const& intfc) noexcept
+	{
+		auto const now = Clock::now();
+
+		// Lock
+		auto const lg = std::lock_guard(_lock);
+		if (_predicate && !_matchTime && intfc.id == _id && _predicate(intfc))
+		{
+			_matchTime = now;
+			_condition.notify_all();
+		}
+	}
+
+	// la::networkInterface::NetworkInterfaceHelper::Observer overrides
+	virtual void onInterfaceEnabledStateChanged(la::networkInterface::Interface const& intfc, bool const /*isEnabled*/) noexcept override
+	{
+		check(intfc);
+	}
+	virtual void onInterfaceIPAddressInfosChanged(la::networkInterface::Interface const& intfc, la::networkInterface::Interface::IPAddressInfos const& /*ipAddressInfos*/) noexcept override
+	{
+		check(intfc);
+	}
+
+	std::mutex _lock{};
+	std::condition_variable _condition{};
+	std::string _id{};
+	Predicate _predicate{};
+	std::optional<Clock::time_point> _matchTime{};
+};
+
+/* ************************************************************ */
+/* Benchmark                                                    */
+/* ************************************************************ */
+struct TestInterface
+{
+	std::string name{};
+	int index{ 0 };
+	in_addr address{};
+	bool isUp{ false };
+	bool hasAddress{ false };
+};
+
+bool hasAddress(la::networkInterface::Interface const& intfc, in_addr const address)
+{
+	auto const* const bytes = reinterpret_cast<std::uint8_t const*>(&address);
+	auto const ip = la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_v4{ bytes[0], bytes[1], bytes[2], bytes[3] } };
+	return std::any_of(intfc.ipAddressInfos.begin(), intfc.ipAddressInfos.end(),
+		[&ip](auto const& info)
+		{
+			return info.address == ip;
+		});
+}
+
+std::size_t countInterfaces(la::networkInterface::NetworkInterfaceHelper& helper)
+{
+	auto count = std::size_t{ 0u };
+	helper.enumerateInterfaces(
+		[&count](la::networkInterface::Interface const&)
+		{
+			++count;
+		});
+	return count;
+}
+
+/** Simulates a user event loop, processing the helper events from its own thread */
+class ExternalEventLoop
+{
+public:
+	ExternalEventLoop()
+	{
+		auto const fd = la::networkInterface::NetworkInterfaceHelper::enableExternalEventProcessing();
+		if (fd < 0)
+		{
+			throw std::runtime_error("Failed to enable external event processing");
+		}
+		_thread = std::thread{
+			[this, fd]()
+			{
+				while (!_shouldTerminate)
+				{
+					auto pfd = pollfd{ fd, POLLIN, 0 };
+					if (::poll(&pfd, 1, 100) > 0)
+					{
+						la::networkInterface::NetworkInterfaceHelper::processEvents();
+					}
+				}
+			}
+		};
+	}
+
+	~ExternalEventLoop() noexcept
+	{
+		_shouldTerminate = true;
+		_thread.join();
+	}
+
+	// Deleted compiler auto-generated methods
+	ExternalEventLoop(ExternalEventLoop const&) = delete;
+	ExternalEventLoop(ExternalEventLoop&&) = delete;
+	ExternalEventLoop& operator=(ExternalEventLoop const&) = delete;
+	ExternalEventLoop& operator=(ExternalEventLoop&&) = delete;
+
+private:
+	std::atomic_bool _shouldTerminate{ false };
+	std::thread _thread{};
+};
+
+/** Runs all measurements for the specified dispatch mode. Returns the results as a JSON object. */
+std::string runMode(std::string const& mode, Options const& options, std::vector<TestInterface>& interfaces)
+{
+	auto const timeout = std::chrono::milliseconds{ 2000 };
+	auto socket = NetlinkSocket{};
+
+	// Setup the dispatch mode
+	auto externalEventLoop = std::optional<ExternalEventLoop>{};
+	if (mode == "external")
+	{
+		externalEventLoop.emplace();
+	}
+
+	// First enumeration (synchronous, done when the helper is first used)
+	auto namespaceHelper = la::networkInterface::NetworkInterfaceHelper::UniquePointer{ nullptr, nullptr };
+	auto const firstStart = Clock::now();
+	if (mode == "namespace")
+	{
+		namespaceHelper = la::networkInterface::NetworkInterfaceHelper::createForNetworkNamespace(std::string{ "/proc/self/ns/net" });
+	}
+	auto& helper = namespaceHelper ? *namespaceHelper : la::networkInterface::NetworkInterfaceHelper::getInstance();
+	auto const enumeratedCount = countInterfaces(helper);
+	auto const firstEnumeration = toMicroseconds(Clock::now() - firstStart);
+
+	// Full enumerations (a new instance always enumerates from the kernel)
+	auto fullEnumerations = std::vector<double>{};
+	for (auto i = 0u; i < std::min<std::size_t>(options.iterations, 50u); ++i)
+	{
+		auto const start = Clock::now();
+		auto instance = la::networkInterface::NetworkInterfaceHelper::createForNetworkNamespace(std::string{ "/proc/self/ns/net" });
+		countInterfaces(*instance);
+		fullEnumerations.push_back(toMicroseconds(Clock::now() - start));
+	}
+
+	// Cached enumerations
+	auto cachedEnumerations = std::vector<double>{};
+	for (auto i = 0u; i < options.iterations; ++i)
+	{
+		auto const start = Clock::now();
+		countInterfaces(helper);
+		cachedEnumerations.push_back(toMicroseconds(Clock::now() - start));
+	}
+
+	// Start monitoring
+	auto observer = LatencyObserver{};
+	helper.registerObserver(&observer);
+	auto const cpuStart = getCpuTimeMs();
+	auto eventsCount = std::size_t{ 0u };
+	auto timeouts = std::size_t{ 0u };
+
+	// Link up/down latency
+	auto linkLatencies = std::vector<double>{};
+	for (auto i = 0u; i < options.iterations; ++i)
+	{
+		auto& intfc = interfaces[i % interfaces.size()];
+		auto const up = !intfc.isUp;
+		observer.expect(intfc.name,
+			[up](la::networkInterface::Interface const& changedIntfc)
+			{
+				return changedIntfc.isEnabled == up;
+			});
+		auto const start = Clock::now();
+		setLinkUp(socket, intfc.index, up);
+		intfc.isUp = up;
+		++eventsCount;
+		if (auto const notified = observer.wait(timeout))
+		{
+			linkLatencies.push_back(toMicroseconds(*notified - start));
+		}
+		else
+		{
+			++timeouts;
+		}
+	}
+
+	// Address added/removed latency
+	auto addressLatencies = std::vector<double>{};
+	for (auto i = 0u; i < options.iterations; ++i)
+	{
+		auto& intfc = interfaces[i % interfaces.size()];
+		auto const add = !intfc.hasAddress;
+		auto const address = intfc.address;
+		observer.expect(intfc.name,
+			[add, address](la::networkInterface::Interface const& changedIntfc)
+			{
+				return hasAddress(changedIntfc, address) == add;
+			});
+		auto const start = Clock::now();
+		setAddress(socket, intfc.index, intfc.address, add);
+		intfc.hasAddress = add;
+		++eventsCount;
+		if (auto const notified = observer.wait(timeout))
+		{
+			addressLatencies.push_back(toMicroseconds(*notified - start));
+		}
+		else
+		{
+			++timeouts;
+		}
+	}
+
+	auto const cpuMs = getCpuTimeMs() - cpuStart;
+	helper.unregisterObserver(&observer);
+
+	// Restore the initial state of the interfaces for the next mode
+	for (auto& intfc : interfaces)
+	{
+		if (intfc.hasAddress)
+		{
+			setAddress(socket, intfc.index, intfc.address, false);
+			intfc.hasAddress = false;
+		}
+		if (intfc.isUp)
+		{
+			setLinkUp(socket, intfc.index, false);
+			intfc.isUp = false;
+		}
+	}
+
+	// Print results
+	auto const fullStats = computeStats(std::move(fullEnumerations));
+	auto const cachedStats = computeStats(std::move(cachedEnumerations));
+	auto const linkStats = computeStats(std::move(linkLatencies));
+	auto const addressStats = computeStats(std::move(addressLatencies));
+	auto const cpuPerEvent = eventsCount != 0u ? cpuMs * 1000.0 / static_cast<double>(eventsCount) : 0.0;
+	std::printf("Mode '%s' (%zu interfaces enumerated)\n", mode.c_str(), enumeratedCount);
+	std::printf("  %-28s %9.1f us\n", "First enumeration", firstEnumeration);
+	printStats("Full enumeration", fullStats);
+	printStats("Cached enumeration", cachedStats);
+	printStats("Link event to callback", linkStats);
+	printStats("Address event to callback", addressStats);
+	std::printf("  %-28s %9.1f us per event (%zu events, %zu timeouts)\n", "CPU", cpuPerEvent, eventsCount, timeouts);
+	std::fflush(stdout);
+
+	auto ss = std::ostringstream{};
+	ss << "{ \"mode\": \"" << mode << "\", \"kind\": \"" << options.kind << "\", \"interfaces\": " << enumeratedCount << ", \"firstEnumerationUs\": " << firstEnumeration << ", \"fullEnumerationUs\": " << toJson(fullStats) << ", \"cachedEnumerationUs\": " << toJson(cachedStats) << ", \"linkEventLatencyUs\": " << toJson(linkStats) << ", \"addressEventLatencyUs\": " << toJson(addressStats) << ", \"cpuUsPerEvent\": " << cpuPerEvent << ", \"events\": " << eventsCount << ", \"timeouts\": " << timeouts << " }";
+	return ss.str();
+}
+
+/** Runs the specified mode in a forked process (so each mode starts from a fresh helper). Returns the JSON result, or an empty string in case of error. */
+std::string runModeInChild(std::string const& mode, Options const& options, std::vector<TestInterface> interfaces)
+{
+	int fds[2];
+	if (::pipe(fds) != 0)
+	{
+		throw std::runtime_error("Failed to create pipe");
+	}
+
+	auto const pid = ::fork();
+	if (pid < 0)
+	{
+		throw std::runtime_error("Failed to fork");
+	}
+	if (pid == 0)
+	{
+		::close(fds[0]);
+		auto status = EXIT_SUCCESS;
+		try
+		{
+			auto const result = runMode(mode, options, interfaces);
+			if (::write(fds[1], result.data(), result.size()) != static_cast<ssize_t>(result.size()))
+			{
+				status = EXIT_FAILURE;
+			}
+		}
+		catch (std::exception const& e)
+		{
+			std::fprintf(stderr, "Mode '%s' failed: %s\n", mode.c_str(), e.what());
+			status = EXIT_FAILURE;
+		}
+		::close(fds[1]);
+		std::fflush(stdout);
+		::_exit(status);
+	}
+
+	::close(fds[1]);
+	auto result = std::string{};
+	char buffer[4096];
+	auto len = ssize_t{ 0 };
+	while ((len = ::read(fds[0], buffer, sizeof(buffer))) > 0)
+	{
+		result.append(buffer, static_cast<std::size_t>(len));
+	}
+	::close(fds[0]);
+	auto status = 0;
+	::waitpid(pid, &status, 0);
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+	{
+		return {};
+	}
+	return result;
+}
+
+std::vector<std::string> split(std::string const& str, char const separator)
+{
+	auto tokens = std::vector<std::string>{};
+	auto ss = std::istringstream{ str };
+	auto token = std::string{};
+	while (std::getline(ss, token, separator))
+	{
+		if (!token.empty())
+		{
+			tokens.push_back(token);
+		}
+	}
+	return tokens;
+}
+
+void printUsage(char const* const name)
+{
+	std::printf("Usage: %s [options]\n", name);
+	std::printf("  -n, --interfaces <count>   Number of test interfaces to create (default 16)\n");
+	std::printf("  -i, --iterations <count>   Number of events (and enumerations) per measurement (default 200)\n");
+	std::printf("  -k, --kind <veth|dummy>    Kind of test interfaces (default veth)\n");
+	std::printf("  -m, --modes <list>         Comma separated dispatch modes among thread, external and namespace (default all)\n");
+	std::printf("  -j, --json <path>          Save the results as JSON\n");
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	auto options = Options{};
+	for (auto i = 1; i < argc; ++i)
+	{
+		auto const arg = std::string{ argv[i] };
+		auto const hasValue = i + 1 < argc;
+		if ((arg == "-n" || arg == "--interfaces") && hasValue)
+		{
+			options.interfacesCount = std::stoul(argv[++i]);
+		}
+		else if ((arg == "-i" || arg == "--iterations") && hasValue)
+		{
+			options.iterations = std::stoul(argv[++i]);
+		}
+		else if ((arg == "-k" || arg == "--kind") && hasValue)
+		{
+			options.kind = argv[++i];
+		}
+		else if ((arg == "-m" || arg == "--modes") && hasValue)
+		{
+			options.modes = split(argv[++i], ',');
+		}
+		else if ((arg == "-j" || arg == "--json") && hasValue)
+		{
+			options.jsonPath = argv[++i];
+		}
+		else
+		{
+			printUsage(argv[0]);
+			return arg == "-h" || arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+	if (options.interfacesCount == 0u || options.iterations == 0u || (options.kind != "veth" && options.kind != "dummy"))
+	{
+		printUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	try
+	{
+		enterNamespaces();
+
+		// Create the test interfaces (down, without address)
+		auto interfaces = std::vector<TestInterface>{};
+		{
+			auto socket = NetlinkSocket{};
+			for (auto i = 0u; i < options.interfacesCount; ++i)
+			{
+				auto intfc = TestInterface{};
+				intfc.name = "nihb" + std::to_string(i);
+				createInterface(socket, options.kind, intfc.name);
+				intfc.index = static_cast<int>(::if_nametoindex(intfc.name.c_str()));
+				intfc.address.s_addr = htonl((10u << 24) | ((i / 256u) << 16) | ((i % 256u) << 8) | 1u);
+				interfaces.push_back(std::move(intfc));
+			}
+		}
+		std::printf("Created %zu %s interfaces in a new network namespace, %zu iterations per measurement\n", interfaces.size(), options.kind.c_str(), options.iterations);
+		std::fflush(stdout);
+
+		// Run each mode in its own process
+		auto results = std::vector<std::string>{};
+		auto success = true;
+		for (auto const& mode : options.modes)
+		{
+			if (mode != "thread" && mode != "external" && mode != "namespace")
+			{
+				std::fprintf(stderr, "Unknown mode '%s'\n", mode.c_str());
+				success = false;
+				continue;
+			}
+			auto result = runModeInChild(mode, options, interfaces);
+			if (result.empty())
+			{
+				success = false;
+				continue;
+			}
+			results.push_back(std::move(result));
+		}
+
+		if (!options.jsonPath.empty())
+		{
+			auto file = std::ofstream{ options.jsonPath };
+			file << "[\n";
+			for (auto i = 0u; i < results.size(); ++i)
+			{
+				file << "  " << results[i] << (i + 1 < results.size() ? ",\n" : "\n");
+			}
+			file << "]\n";
+			if (!file.flush())
+			{
+				std::fprintf(stderr, "Failed to write %s\n", options.jsonPath.c_str());
+				return EXIT_FAILURE;
+			}
+		}
+
+		return success ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	catch (std::exception const& e)
+	{
+		std::fprintf(stderr, "Error: %s\n", e.what());
+		return EXIT_FAILURE;
+	}
+}
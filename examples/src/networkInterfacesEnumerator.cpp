@@ -41,6 +41,8 @@
 
 #include <iostream>
 #include <string>
+#include <array>
+#include <system_error> // errc
 #include <chrono>
 #include <thread>
 
@@ -50,6 +52,18 @@ std::ostream& operator<<(std::ostream& stream, la::networkInterface::MacAddress
 	return stream;
 }
 
+std::ostream& operator<<(std::ostream& stream, la::networkInterface::IPAddressInfo const& ipAddressInfo)
+{
+	// Write in CIDR notation
+	auto buffer = std::array<char, la::networkInterface::IPAddressInfoCharsMaxLength>{};
+	auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::ipAddressInfoToChars(buffer.data(), buffer.data() + buffer.size(), ipAddressInfo);
+	if (ec == std::errc{})
+	{
+		stream.write(buffer.data(), ptr - buffer.data());
+	}
+	return stream;
+}
+
 std::ostream& operator<<(std::ostream& stream, la::networkInterface::Interface::Type const type)
 {
 	switch (type)
@@ -86,6 +100,7 @@ int displayInterfaces()
 				std::cout << intNum << ": " << intfc.id << std::endl;
 				std::cout << "  Description:  " << intfc.description << std::endl;
 				std::cout << "  Alias:        " << intfc.alias << std::endl;
+				std::cout << "  Index:        " << intfc.index << std::endl;
 				std::cout << "  MacAddress:   " << intfc.macAddress << std::endl;
 				std::cout << "  Type:         " << intfc.type << std::endl;
 				std::cout << "  Enabled:      " << (intfc.isEnabled ? "YES" : "NO") << std::endl;
@@ -103,7 +118,7 @@ int displayInterfaces()
 						else
 						{
 							// IPv6
-							std::cout << "    " << static_cast<std::string>(info.address) << "/" << std::to_string(la::networkInterface::IPAddress::prefixLengthFromPackedV6(info.netmask.getIPV6Packed())) << " -> " << static_cast<std::string>(info.getNetworkBaseAddress()) << std::endl;
+							std::cout << "    " << info << " -> " << static_cast<std::string>(info.getNetworkBaseAddress()) << std::endl;
 						}
 					}
 				}
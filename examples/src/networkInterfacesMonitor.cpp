@@ -41,6 +41,8 @@
 
 #include <iostream>
 #include <string>
+#include <array>
+#include <system_error> // errc
 
 std::ostream& operator<<(std::ostream& stream, la::networkInterface::MacAddress const& macAddress)
 {
@@ -48,6 +50,18 @@ std::ostream& operator<<(std::ostream& stream, la::networkInterface::MacAddress
 	return stream;
 }
 
+std::ostream& operator<<(std::ostream& stream, la::networkInterface::IPAddressInfo const& ipAddressInfo)
+{
+	// Write in CIDR notation
+	auto buffer = std::array<char, la::networkInterface::IPAddressInfoCharsMaxLength>{};
+	auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::ipAddressInfoToChars(buffer.data(), buffer.data() + buffer.size(), ipAddressInfo);
+	if (ec == std::errc{})
+	{
+		stream.write(buffer.data(), ptr - buffer.data());
+	}
+	return stream;
+}
+
 std::ostream& operator<<(std::ostream& stream, la::networkInterface::Interface::Type const type)
 {
 	switch (type)
@@ -100,7 +114,7 @@ private:
 					else
 					{
 						// IPv6
-						std::cout << "    " << static_cast<std::string>(ip.address) << "/" << std::to_string(la::networkInterface::IPAddress::prefixLengthFromPackedV6(ip.netmask.getIPV6Packed())) << " -> " << static_cast<std::string>(ip.getNetworkBaseAddress()) << std::endl;
+						std::cout << "    " << ip << " -> " << static_cast<std::string>(ip.getNetworkBaseAddress()) << std::endl;
 					}
 				}
 			}
@@ -152,7 +166,7 @@ private:
 				else
 				{
 					// IPv6
-					std::cout << "  " << static_cast<std::string>(ip.address) << "/" << std::to_string(la::networkInterface::IPAddress::prefixLengthFromPackedV6(ip.netmask.getIPV6Packed())) << " -> " << static_cast<std::string>(ip.getNetworkBaseAddress()) << std::endl;
+					std::cout << "  " << ip << " -> " << static_cast<std::string>(ip.getNetworkBaseAddress()) << std::endl;
 				}
 			}
 		}
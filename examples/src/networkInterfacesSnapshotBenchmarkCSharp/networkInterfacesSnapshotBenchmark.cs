@@ -0,0 +1,89 @@
+// Compares reading all interfaces through the SWIG proxies (Observer) and through a bulk snapshot buffer
+
+const int Iterations = 1000;
+byte[] buffer = null; // Reused by the snapshot path
+
+Console.WriteLine("Using " + la_networkInterfaceHelper.getLibraryName() + " v" + la_networkInterfaceHelper.getLibraryVersion());
+
+var helper = la.networkInterface.NetworkInterfaceHelper.getInstance();
+
+// Keep an observer registered for the whole run, so both paths read the same cached interfaces (registering the first observer, or unregistering the last one, would re-enumerate and restart the monitoring)
+var keepAlive = new la.networkInterface.NetworkInterfaceHelper.DefaultedObserver();
+helper.registerObserver(keepAlive);
+
+// Warm up (wait for the first enumeration and JIT both paths)
+var proxyResult = readUsingProxies(helper);
+var snapshotResult = readUsingSnapshot(helper);
+Console.WriteLine("Interfaces: " + proxyResult.Interfaces + " (proxies) / " + snapshotResult.Interfaces + " (snapshot), IP addresses: " + proxyResult.Addresses + " / " + snapshotResult.Addresses);
+
+var proxyTime = measure(() => readUsingProxies(helper));
+var snapshotTime = measure(() => readUsingSnapshot(helper));
+Console.WriteLine("Proxies:  " + (proxyTime.TotalMilliseconds * 1000 / Iterations).ToString("F2") + " us per full read");
+Console.WriteLine("Snapshot: " + (snapshotTime.TotalMilliseconds * 1000 / Iterations).ToString("F2") + " us per full read");
+
+helper.unregisterObserver(keepAlive);
+
+TimeSpan measure(Func<Result> read)
+{
+	var sw = System.Diagnostics.Stopwatch.StartNew();
+	for (var i = 0; i < Iterations; ++i)
+	{
+		read();
+	}
+	return sw.Elapsed;
+}
+
+// Current path: one proxy and P/Invoke round-trip per Interface, IPAddressInfo, IPAddress and string (registering an observer only replays the cached interfaces, as another observer is kept registered)
+Result readUsingProxies(la.networkInterface.NetworkInterfaceHelper helper)
+{
+	var obs = new Reader();
+	helper.registerObserver(obs);
+	helper.unregisterObserver(obs);
+	return obs.Result;
+}
+
+// Bulk path: a single native call filling a reused managed buffer
+Result readUsingSnapshot(la.networkInterface.NetworkInterfaceHelper helper)
+{
+	var result = new Result();
+	var view = helper.takeSnapshot(ref buffer);
+	foreach (ref readonly var intfc in view.Interfaces)
+	{
+		var id = view.GetString(intfc.Id);
+		var description = view.GetString(intfc.Description);
+		var alias = view.GetString(intfc.Alias);
+		var isConnected = intfc.IsConnected != 0;
+		foreach (ref readonly var ip in view.GetIPAddresses(intfc))
+		{
+			var prefixLength = ip.PrefixLength;
+			++result.Addresses;
+		}
+		++result.Interfaces;
+	}
+	return result;
+}
+
+struct Result
+{
+	public int Interfaces;
+	public int Addresses;
+}
+
+class Reader : la.networkInterface.NetworkInterfaceHelper.DefaultedObserver
+{
+	public override void onInterfaceAdded(la.networkInterface.Interface intfc)
+	{
+		var id = intfc.id;
+		var description = intfc.description;
+		var alias = intfc.alias;
+		var isConnected = intfc.isConnected;
+		foreach (var info in intfc.ipAddressInfos)
+		{
+			var prefixLength = info.address.getType() == la.networkInterface.IPAddress.Type.V4 ? 0 : la.networkInterface.IPAddress.prefixLengthFromPackedV6(info.netmask.getIPV6Packed());
+			++Result.Addresses;
+		}
+		++Result.Interfaces;
+	}
+
+	public Result Result;
+};
@@ -0,0 +1,379 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+* @file interfaceChangeStream.hpp
+* @author Christophe Calmejane
+* @brief Awaitable stream of interface changes (requires C++20 coroutines).
+*/
+
+#pragma once
+
+#include "networkInterfaceHelper.hpp"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#	include <coroutine>
+#	include <deque>
+#	include <mutex>
+#	include <optional>
+#	include <vector>
+#	include <string>
+#	include <functional>
+#	include <unordered_map>
+#	include <utility>
+#	include <iterator>
+#	include <cstddef> // size_t
+
+namespace la
+{
+namespace networkInterface
+{
+/** A change of an Interface, as notified to a NetworkInterfaceHelper::Observer */
+struct InterfaceChange
+{
+	enum class Kind
+	{
+		Added = 0,
+		Removed = 1,
+		EnabledStateChanged = 2,
+		ConnectedStateChanged = 3,
+		AliasChanged = 4,
+		IPAddressInfosChanged = 5,
+		GatewaysChanged = 6,
+	};
+
+	Kind kind{ Kind::Added }; /** Kind of change */
+	Interface intfc{}; /** State of the interface after the change (last known state if removed) */
+	std::size_t droppedChangesCount{ 0u }; /** Number of changes dropped just before this one, because they were not consumed in time (0 if none was missed) */
+};
+
+/**
+* Awaitable stream of interface changes.
+* Changes are recorded from the stream creation (starting with an Added change for each already discovered interface) until its destruction.
+* Suspended coroutines are resumed through the executor given at construction, or directly from the thread notifying the change if none was given.
+* Only one coroutine may await nextChange/nextChanges at a time, but any number of coroutines may wait for interfaces.
+* At most maxPendingChanges changes are kept until consumed by nextChange/nextChanges, older ones being dropped (reported by the droppedChangesCount of the next change returned, and by getDroppedChangesCount), so a stream only used to wait for interfaces doesn't grow without limit.
+* The stream must not be destroyed while coroutines are suspended on it.
+*/
+class InterfaceChangeStream final : private NetworkInterfaceHelper::Observer
+{
+public:
+	using Changes = std::vector<InterfaceChange>;
+	using Executor = std::function<void(std::coroutine_handle<>)>;
+	using Predicate = std::function<bool(Interface const&)>;
+
+	static constexpr std::size_t DefaultMaxPendingChanges = 1024u;
+
+	/** Creates a stream of all the changes of the specified helper */
+	explicit InterfaceChangeStream(NetworkInterfaceHelper& helper = NetworkInterfaceHelper::getInstance(), Executor executor = {}, std::size_t const maxPendingChanges = DefaultMaxPendingChanges) noexcept
+		: _helper{ helper }
+		, _executor{ std::move(executor) }
+		, _maxPendingChanges{ maxPendingChanges > 0u ? maxPendingChanges : 1u }
+	{
+		_helper.registerObserver(this);
+	}
+
+	/** Creates a stream of the changes of the specified helper, for the interfaces passing the filter */
+	InterfaceChangeStream(NetworkInterfaceHelper& helper, InterfaceFilter const& filter, Executor executor = {}, std::size_t const maxPendingChanges = DefaultMaxPendingChanges) noexcept
+		: _helper{ helper }
+		, _executor{ std::move(executor) }
+		, _maxPendingChanges{ maxPendingChanges > 0u ? maxPendingChanges : 1u }
+	{
+		_helper.registerObserver(this, filter);
+	}
+
+	~InterfaceChangeStream() noexcept
+	{
+		_helper.unregisterObserver(this);
+	}
+
+	/** Returns an awaitable resuming with the next change */
+	[[nodiscard]] auto nextChange() noexcept
+	{
+		return ChangesAwaiter<true>{ *this };
+	}
+
+	/** Returns an awaitable resuming with all the changes recorded since the previous call (never empty) */
+	[[nodiscard]] auto nextChanges() noexcept
+	{
+		return ChangesAwaiter<false>{ *this };
+	}
+
+	/** Returns the total number of changes dropped because they were not consumed before maxPendingChanges newer changes were recorded */
+	std::size_t getDroppedChangesCount() const noexcept
+	{
+		// Lock
+		auto const lg = std::lock_guard(_lock);
+		return _droppedChangesCount;
+	}
+
+	/** Returns an awaitable resuming with the specified interface as soon as it matches the predicate (immediately if it already does) */
+	[[nodiscard]] auto interfaceMatching(std::string interfaceName, Predicate predicate) noexcept
+	{
+		return InterfaceAwaiter{ *this, std::move(interfaceName), std::move(predicate) };
+	}
+
+	/** Returns an awaitable resuming with the specified interface as soon as it is connected (immediately if it already is) */
+	[[nodiscard]] auto interfaceConnected(std::string interfaceName) noexcept
+	{
+		return interfaceMatching(std::move(interfaceName),
+			[](Interface const& intfc)
+			{
+				return intfc.isConnected;
+			});
+	}
+
+	// Deleted compiler auto-generated methods
+	InterfaceChangeStream(InterfaceChangeStream const&) = delete;
+	InterfaceChangeStream(InterfaceChangeStream&&) = delete;
+	InterfaceChangeStream& operator=(InterfaceChangeStream const&) = delete;
+	InterfaceChangeStream& operator=(InterfaceChangeStream&&) = delete;
+
+private:
+	template<bool Single>
+	class ChangesAwaiter
+	{
+	public:
+		explicit ChangesAwaiter(InterfaceChangeStream& stream) noexcept
+			: _stream{ stream }
+		{
+		}
+
+		bool await_ready() const noexcept
+		{
+			// Always check for pending changes under lock, in await_suspend
+			return false;
+		}
+
+		bool await_suspend(std::coroutine_handle<> const handle) noexcept
+		{
+			// Lock
+			auto const lg = std::lock_guard(_stream._lock);
+
+			// Changes already pending, don't suspend
+			if (!_stream._changes.empty())
+			{
+				return false;
+			}
+			_stream._changesWaiter = handle;
+			return true;
+		}
+
+		auto await_resume()
+		{
+			// Lock
+			auto const lg = std::lock_guard(_stream._lock);
+
+			if constexpr (Single)
+			{
+				auto change = std::move(_stream._changes.front());
+				_stream._changes.pop_front();
+				return change;
+			}
+			else
+			{
+				auto changes = Changes{ std::make_move_iterator(_stream._changes.begin()), std::make_move_iterator(_stream._changes.end()) };
+				_stream._changes.clear();
+				return changes;
+			}
+		}
+
+	private:
+		InterfaceChangeStream& _stream;
+	};
+
+	class InterfaceAwaiter
+	{
+	public:
+		InterfaceAwaiter(InterfaceChangeStream& stream, std::string&& interfaceName, Predicate&& predicate) noexcept
+			: _stream{ stream }
+			, _interfaceName{ std::move(interfaceName) }
+			, _predicate{ std::move(predicate) }
+		{
+		}
+
+		bool await_ready() const noexcept
+		{
+			// Always check the interface under lock, in await_suspend
+			return false;
+		}
+
+		bool await_suspend(std::coroutine_handle<> const handle)
+		{
+			// Lock
+			auto const lg = std::lock_guard(_stream._lock);
+
+			// Interface already matching, don't suspend
+			if (auto const intfcIt = _stream._interfaces.find(_interfaceName); intfcIt != _stream._interfaces.end() && _predicate(intfcIt->second))
+			{
+				_result = intfcIt->second;
+				return false;
+			}
+			_stream._interfaceWaiters.push_back(InterfaceWaiter{ &_interfaceName, &_predicate, &_result, handle });
+			return true;
+		}
+
+		Interface await_resume()
+		{
+			return std::move(*_result);
+		}
+
+	private:
+		InterfaceChangeStream& _stream;
+		std::string _interfaceName{};
+		Predicate _predicate{};
+		std::optional<Interface> _result{ std::nullopt };
+	};
+
+	struct InterfaceWaiter
+	{
+		std::string const* interfaceName{ nullptr };
+		Predicate const* predicate{ nullptr };
+		std::optional<Interface>* result{ nullptr };
+		std::coroutine_handle<> handle{};
+	};
+
+	void onChange(InterfaceChange::Kind const kind, Interface const& intfc) noexcept
+	{
+		auto toResume = std::vector<std::coroutine_handle<>>{};
+		{
+			// Lock
+			auto const lg = std::lock_guard(_lock);
+
+			try
+			{
+				_changes.push_back(InterfaceChange{ kind, intfc, 0u });
+				// Drop the oldest changes not consumed yet, recording the gap in the next change so consumers know they missed some
+				while (_changes.size() > _maxPendingChanges)
+				{
+					auto const droppedCount = _changes.front().droppedChangesCount + 1u;
+					_changes.pop_front();
+					_changes.front().droppedChangesCount += droppedCount;
+					++_droppedChangesCount;
+				}
+				if (kind == InterfaceChange::Kind::Removed)
+				{
+					_interfaces.erase(intfc.id);
+				}
+				else
+				{
+					_interfaces[intfc.id] = intfc;
+
+					// Check for coroutines waiting for this interface
+					for (auto waiterIt = _interfaceWaiters.begin(); waiterIt != _interfaceWaiters.end();)
+					{
+						if (*waiterIt->interfaceName == intfc.id && (*waiterIt->predicate)(intfc))
+						{
+							*waiterIt->result = intfc;
+							toResume.push_back(waiterIt->handle);
+							waiterIt = _interfaceWaiters.erase(waiterIt);
+						}
+						else
+						{
+							++waiterIt;
+						}
+					}
+				}
+
+				if (_changesWaiter)
+				{
+					toResume.push_back(std::exchange(_changesWaiter, {}));
+				}
+			}
+			catch (...)
+			{
+				// Failed to allocate, the change is lost
+			}
+		}
+
+		// Resume coroutines outside the lock, so they can await again
+		for (auto const handle : toResume)
+		{
+			if (_executor)
+			{
+				_executor(handle);
+			}
+			else
+			{
+				handle.resume();
+			}
+		}
+	}
+
+	// NetworkInterfaceHelper::Observer overrides
+	virtual void onInterfaceAdded(Interface const& intfc) noexcept override
+	{
+		onChange(InterfaceChange::Kind::Added, intfc);
+	}
+	virtual void onInterfaceRemoved(Interface const& intfc) noexcept override
+	{
+		onChange(InterfaceChange::Kind::Removed, intfc);
+	}
+	virtual void onInterfaceEnabledStateChanged(Interface const& intfc, bool const /*isEnabled*/) noexcept override
+	{
+		onChange(InterfaceChange::Kind::EnabledStateChanged, intfc);
+	}
+	virtual void onInterfaceConnectedStateChanged(Interface const& intfc, bool const /*isConnected*/) noexcept override
+	{
+		onChange(InterfaceChange::Kind::ConnectedStateChanged, intfc);
+	}
+	virtual void onInterfaceAliasChanged(Interface const& intfc, std::string const& /*alias*/) noexcept override
+	{
+		onChange(InterfaceChange::Kind::AliasChanged, intfc);
+	}
+	virtual void onInterfaceIPAddressInfosChanged(Interface const& intfc, Interface::IPAddressInfos const& /*ipAddressInfos*/) noexcept override
+	{
+		onChange(InterfaceChange::Kind::IPAddressInfosChanged, intfc);
+	}
+	virtual void onInterfaceGateWaysChanged(Interface const& intfc, Interface::Gateways const& /*gateways*/) noexcept override
+	{
+		onChange(InterfaceChange::Kind::GatewaysChanged, intfc);
+	}
+
+	// Private members
+	NetworkInterfaceHelper& _helper;
+	Executor _executor{};
+	std::size_t const _maxPendingChanges{ DefaultMaxPendingChanges };
+	mutable std::mutex _lock{};
+	std::deque<InterfaceChange> _changes{};
+	std::size_t _droppedChangesCount{ 0u };
+	std::coroutine_handle<> _changesWaiter{};
+	std::unordered_map<std::string, Interface> _interfaces{}; // Last known state of the interfaces
+	std::vector<InterfaceWaiter> _interfaceWaiters{};
+};
+
+} // namespace networkInterface
+} // namespace la
+
+#endif // __cpp_impl_coroutine
@@ -0,0 +1,130 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+* @file ipAddressArray.hpp
+* @author Christophe Calmejane
+* @brief Structure-of-arrays container of IP addresses, with vectorized mask, compare and subnet kernels.
+*/
+
+#pragma once
+
+#include "networkInterfaceHelper.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace la
+{
+namespace networkInterface
+{
+/* ************************************************************ */
+/* IPAddressArray class declaration                             */
+/* ************************************************************ */
+/**
+* Container of IP addresses stored as packed values in contiguous arrays (V4 addresses as uint32, V6 addresses as two uint64 lanes),
+* with kernels processing all the addresses at once (AVX2 or NEON when the library is compiled with them, scalar otherwise).
+* V4 and V6 addresses are stored separately, each keeping its own insertion order.
+*/
+class IPAddressArray final
+{
+public:
+	/** Default constructor. */
+	IPAddressArray() noexcept = default;
+
+	/** Constructor from a list of IPAddress. Throws std::invalid_argument if an IPAddress is not valid. */
+	explicit IPAddressArray(std::vector<IPAddress> const& addresses);
+
+	/** Adds an IPAddress. Throws std::invalid_argument if the IPAddress is not valid. */
+	void add(IPAddress const& ip);
+
+	/** Adds a packed V4 address. */
+	void addV4(IPAddress::value_type_packed_v4 const ipv4);
+
+	/** Adds a packed V6 address. */
+	void addV6(IPAddress::value_type_packed_v6 const& ipv6);
+
+	/** Reserves storage for the specified number of addresses of each Type. */
+	void reserve(std::size_t const v4Count, std::size_t const v6Count);
+
+	/** Removes all addresses. */
+	void clear() noexcept;
+
+	/** Returns the total number of addresses. */
+	std::size_t size() const noexcept;
+
+	/** Returns true if there is no address. */
+	bool empty() const noexcept;
+
+	/** Returns the number of addresses of the specified Type. */
+	std::size_t getCount(IPAddress::Type const type) const noexcept;
+
+	/** Returns the V4 address at the specified index (among V4 addresses). Throws std::invalid_argument if index is out of range. */
+	IPAddress getV4(std::size_t const index) const;
+
+	/** Returns the V6 address at the specified index (among V6 addresses). Throws std::invalid_argument if index is out of range. */
+	IPAddress getV6(std::size_t const index) const;
+
+	/** Returns the packed V4 addresses (getCount(IPAddress::Type::V4) values). */
+	IPAddress::value_type_packed_v4 const* getV4Data() const noexcept;
+
+	/** Returns the most significant halves of the packed V6 addresses (getCount(IPAddress::Type::V6) values). */
+	std::uint64_t const* getV6HighData() const noexcept;
+
+	/** Returns the least significant halves of the packed V6 addresses (getCount(IPAddress::Type::V6) values). */
+	std::uint64_t const* getV6LowData() const noexcept;
+
+	/** Applies the netmask (bitwise AND) to all addresses of the same Type, in place. Throws std::invalid_argument if netmask is not valid. */
+	void maskAll(IPAddress const& netmask);
+
+	/** Returns true if any address is equal to the specified one. */
+	bool equalsAny(IPAddress const& ip) const noexcept;
+
+	/** For each address of the same Type as the subnet (in order), writes to 'results' 1 if it belongs to the subnet, 0 otherwise. Returns the number of addresses belonging to the subnet. Throws std::invalid_argument if subnet address or netmask is not valid, or if they are not of the same Type. */
+	std::size_t inSubnet(IPAddressInfo const& subnet, std::uint8_t* const results) const;
+
+	/** Returns the number of addresses belonging to at least one of the subnets. Throws std::invalid_argument if a subnet address or netmask is not valid, or if they are not of the same Type. */
+	std::size_t countInSubnets(std::vector<IPAddressInfo> const& subnets) const;
+
+	/** Returns the instruction set used by the kernels ("AVX2", "NEON" or "Scalar"). */
+	static char const* getKernelsInstructionSet() noexcept;
+
+private:
+	std::vector<IPAddress::value_type_packed_v4> _v4{};
+	std::vector<std::uint64_t> _v6High{};
+	std::vector<std::uint64_t> _v6Low{};
+};
+
+} // namespace networkInterface
+} // namespace la
@@ -0,0 +1,148 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+* @file ipEndpoint.hpp
+* @author Christophe Calmejane
+* @brief IP endpoint (address, port and IPV6 scope id), directly convertible to a sockaddr.
+*/
+
+#pragma once
+
+#include "networkInterfaceHelper.hpp"
+
+#include <cstdint>
+#include <cstddef> // size_t
+
+namespace la
+{
+namespace networkInterface
+{
+/* ************************************************************ */
+/* IPEndpoint class declaration                                 */
+/* ************************************************************ */
+/**
+* IP endpoint: an IPAddress, a port and (for V6 only) a scope id (the index of the interface a link-local address is attached to).
+* Text conversions are done through NetworkInterfaceHelper::ipEndpointToChars and NetworkInterfaceHelper::ipEndpointFromChars.
+*/
+class IPEndpoint final
+{
+public:
+	/** Default constructor. Creates an invalid endpoint (IPAddress::Type::None). */
+	IPEndpoint() noexcept = default;
+
+	/** Constructor from an IPAddress, a port and a scope id. Throws std::invalid_argument if the IPAddress is not valid, or if a scope id is specified for a V4 address. */
+	IPEndpoint(IPAddress const& address, std::uint16_t const port, std::uint32_t const scopeId = 0u);
+
+	/** Constructor from a sockaddr_in (port and address in network byte order) */
+	explicit IPEndpoint(sockaddr_in const& address) noexcept;
+
+	/** Constructor from a sockaddr_in6 (port and address in network byte order, scope id in host byte order). IPV4-mapped addresses (::ffff:a.b.c.d) are converted to V4 if normalizeMappedV4 is true (the scope id is then dropped). */
+	explicit IPEndpoint(sockaddr_in6 const& address, bool const normalizeMappedV4 = false) noexcept;
+
+	/** Constructor from a sockaddr (using its family). Throws std::invalid_argument if the family is neither AF_INET nor AF_INET6. */
+	explicit IPEndpoint(sockaddr const& address, bool const normalizeMappedV4 = false);
+
+	/** Constructor from a sockaddr_storage (using its family). Throws std::invalid_argument if the family is neither AF_INET nor AF_INET6. */
+	explicit IPEndpoint(sockaddr_storage const& address, bool const normalizeMappedV4 = false);
+
+	/** Returns true if the endpoint is valid (not default constructed). */
+	bool isValid() const noexcept
+	{
+		return _address.getType() != IPAddress::Type::None;
+	}
+
+	/** Returns the address. */
+	IPAddress const& getAddress() const noexcept
+	{
+		return _address;
+	}
+
+	/** Returns the port. */
+	std::uint16_t getPort() const noexcept
+	{
+		return _port;
+	}
+
+	/** Returns the scope id (0 if not specified, always 0 for V4). */
+	std::uint32_t getScopeId() const noexcept
+	{
+		return _scopeId;
+	}
+
+	/** Converts to a sockaddr_storage (sockaddr_in or sockaddr_in6 depending on the address Type), to be used with bind, connect or sendto along with getSockaddrLength. Throws std::invalid_argument if the endpoint is not valid. */
+	sockaddr_storage getSockaddrStorage() const;
+
+	/** Returns the length of the sockaddr returned by getSockaddrStorage (sizeof(sockaddr_in) or sizeof(sockaddr_in6)), or 0 if the endpoint is not valid. */
+	std::size_t getSockaddrLength() const noexcept;
+
+	/** Equality operator. Returns true if the address, port and scope id are equal. */
+	friend bool operator==(IPEndpoint const& lhs, IPEndpoint const& rhs) noexcept
+	{
+		return lhs._address == rhs._address && lhs._port == rhs._port && lhs._scopeId == rhs._scopeId;
+	}
+
+	/** Non equality operator. */
+	friend bool operator!=(IPEndpoint const& lhs, IPEndpoint const& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	/** Inferiority operator. Compares the address, then the port, then the scope id. */
+	friend bool operator<(IPEndpoint const& lhs, IPEndpoint const& rhs) noexcept
+	{
+		if (lhs._address != rhs._address)
+		{
+			return lhs._address < rhs._address;
+		}
+		if (lhs._port != rhs._port)
+		{
+			return lhs._port < rhs._port;
+		}
+		return lhs._scopeId < rhs._scopeId;
+	}
+
+	// Defaulted compiler auto-generated methods
+	IPEndpoint(IPEndpoint&&) = default;
+	IPEndpoint(IPEndpoint const&) = default;
+	IPEndpoint& operator=(IPEndpoint const&) = default;
+	IPEndpoint& operator=(IPEndpoint&&) = default;
+
+private:
+	IPAddress _address{};
+	std::uint16_t _port{ 0u };
+	std::uint32_t _scopeId{ 0u };
+};
+
+} // namespace networkInterface
+} // namespace la
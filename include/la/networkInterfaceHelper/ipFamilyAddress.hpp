@@ -0,0 +1,526 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+* @file ipFamilyAddress.hpp
+* @author Christophe Calmejane
+* @brief IP addresses of a statically known family (IPV4Address and IPV6Address), with constexpr non-throwing operations.
+*/
+
+#pragma once
+
+#include "networkInterfaceHelper.hpp"
+#include "ipPrefix.hpp"
+
+#include <cstdint>
+#include <stdexcept> // invalid_argument
+#include <type_traits> // enable_if / is_same
+#if __has_include(<bit>)
+#	include <bit> // countl_one
+#endif
+
+namespace la
+{
+namespace networkInterface
+{
+/* ************************************************************ */
+/* IPV4Address class declaration                                */
+/* ************************************************************ */
+/**
+* IPV4 address stored as a packed 32-bit value (4 bytes).
+* Contrary to IPAddress, the family is known at compile time so all operations are constexpr, never throw and never switch on a Type.
+* Implicitly converts to IPAddress.
+*/
+class IPV4Address final
+{
+public:
+	using value_type = IPAddress::value_type_v4;
+	using value_type_packed = IPAddress::value_type_packed_v4;
+
+	static constexpr IPAddress::Type Type = IPAddress::Type::V4;
+	static constexpr std::uint8_t BitsCount = 32u;
+
+	/** Default constructor (0.0.0.0). */
+	constexpr IPV4Address() noexcept = default;
+
+	/** Constructor from a packed value. */
+	constexpr explicit IPV4Address(value_type_packed const ipv4) noexcept
+		: _value{ ipv4 }
+	{
+	}
+
+	/** Constructor from the 4 bytes of the address ("a.b.c.d"). */
+	constexpr IPV4Address(std::uint8_t const a, std::uint8_t const b, std::uint8_t const c, std::uint8_t const d) noexcept
+		: _value{ (value_type_packed{ a } << 24) | (value_type_packed{ b } << 16) | (value_type_packed{ c } << 8) | value_type_packed{ d } }
+	{
+	}
+
+	/** Constructor from an array of bytes. */
+	constexpr explicit IPV4Address(value_type const& ipv4) noexcept
+		: IPV4Address{ ipv4[0], ipv4[1], ipv4[2], ipv4[3] }
+	{
+	}
+
+	/** Constructor from an IPAddress. Throws std::invalid_argument if IPAddress is not a Type::V4. */
+	explicit IPV4Address(IPAddress const& ip)
+		: _value{ ip.getIPV4Packed() }
+	{
+	}
+
+	/** Returns the address (in the 32 least significant bits) from a packed UInt128 value, as used by IPPrefix. */
+	static constexpr IPV4Address fromValue(UInt128 const& value) noexcept
+	{
+		return IPV4Address{ static_cast<value_type_packed>(value.low) };
+	}
+
+	/** Returns the netmask for the specified prefix length (clamped to 32). */
+	static constexpr IPV4Address makeNetmask(std::uint8_t const prefixLength) noexcept
+	{
+		return fromValue(IPPrefix::makeNetmaskValue(Type, prefixLength < BitsCount ? prefixLength : BitsCount));
+	}
+
+	/** Returns the packed value. */
+	constexpr value_type_packed getPacked() const noexcept
+	{
+		return _value;
+	}
+
+	/** Returns the packed value as a UInt128, as used by IPPrefix. */
+	constexpr UInt128 getValue() const noexcept
+	{
+		return UInt128{ _value };
+	}
+
+	/** Returns the 4 bytes of the address. */
+	constexpr value_type getBytes() const noexcept
+	{
+		return value_type{ static_cast<std::uint8_t>(_value >> 24), static_cast<std::uint8_t>(_value >> 16), static_cast<std::uint8_t>(_value >> 8), static_cast<std::uint8_t>(_value) };
+	}
+
+	/** True if the address is 0.0.0.0. */
+	constexpr bool isUnspecified() const noexcept
+	{
+		return _value == 0u;
+	}
+
+	/** True if the address is in 127.0.0.0/8. */
+	constexpr bool isLoopback() const noexcept
+	{
+		return (_value >> 24) == 127u;
+	}
+
+	/** True if the address is in 169.254.0.0/16. */
+	constexpr bool isLinkLocal() const noexcept
+	{
+		return (_value >> 16) == 0xA9FEu;
+	}
+
+	/** True if the address is in 224.0.0.0/4. */
+	constexpr bool isMulticast() const noexcept
+	{
+		return (_value >> 28) == 0xEu;
+	}
+
+	/** True if the address is in one of the private ranges (10.0.0.0/8, 172.16.0.0/12 or 192.168.0.0/16). */
+	constexpr bool isPrivate() const noexcept
+	{
+		return ((_value >> 24) == 10u) | ((_value >> 20) == 0xAC1u) | ((_value >> 16) == 0xC0A8u);
+	}
+
+	/** Creates a prefix from this address. Throws std::invalid_argument if prefixLength is out of range (1 to 32). */
+	constexpr IPPrefix toPrefix(std::uint8_t const prefixLength) const
+	{
+		return IPPrefix::fromPackedV4(_value, prefixLength);
+	}
+
+	/** IPAddress conversion operator. */
+	operator IPAddress() const noexcept
+	{
+		return IPAddress{ _value };
+	}
+
+	friend constexpr bool operator==(IPV4Address const& lhs, IPV4Address const& rhs) noexcept
+	{
+		return lhs._value == rhs._value;
+	}
+	friend constexpr bool operator!=(IPV4Address const& lhs, IPV4Address const& rhs) noexcept
+	{
+		return lhs._value != rhs._value;
+	}
+	friend constexpr bool operator<(IPV4Address const& lhs, IPV4Address const& rhs) noexcept
+	{
+		return lhs._value < rhs._value;
+	}
+	friend constexpr bool operator<=(IPV4Address const& lhs, IPV4Address const& rhs) noexcept
+	{
+		return lhs._value <= rhs._value;
+	}
+	friend constexpr bool operator>(IPV4Address const& lhs, IPV4Address const& rhs) noexcept
+	{
+		return lhs._value > rhs._value;
+	}
+	friend constexpr bool operator>=(IPV4Address const& lhs, IPV4Address const& rhs) noexcept
+	{
+		return lhs._value >= rhs._value;
+	}
+	/** Increment operator (modulo 2^32). */
+	friend constexpr IPV4Address operator+(IPV4Address const& lhs, UInt128 const& offset) noexcept
+	{
+		return IPV4Address{ IPAddress::add(lhs._value, offset) };
+	}
+	/** Decrement operator (modulo 2^32). */
+	friend constexpr IPV4Address operator-(IPV4Address const& lhs, UInt128 const& offset) noexcept
+	{
+		return IPV4Address{ IPAddress::subtract(lhs._value, offset) };
+	}
+	friend constexpr IPV4Address& operator++(IPV4Address& lhs) noexcept
+	{
+		++lhs._value;
+		return lhs;
+	}
+	friend constexpr IPV4Address& operator--(IPV4Address& lhs) noexcept
+	{
+		--lhs._value;
+		return lhs;
+	}
+	friend constexpr IPV4Address operator&(IPV4Address const& lhs, IPV4Address const& rhs) noexcept
+	{
+		return IPV4Address{ lhs._value & rhs._value };
+	}
+	friend constexpr IPV4Address operator|(IPV4Address const& lhs, IPV4Address const& rhs) noexcept
+	{
+		return IPV4Address{ lhs._value | rhs._value };
+	}
+	friend constexpr IPV4Address operator^(IPV4Address const& lhs, IPV4Address const& rhs) noexcept
+	{
+		return IPV4Address{ lhs._value ^ rhs._value };
+	}
+	constexpr IPV4Address operator~() const noexcept
+	{
+		return IPV4Address{ ~_value };
+	}
+
+private:
+	value_type_packed _value{ 0u };
+};
+
+/* ************************************************************ */
+/* IPV6Address class declaration                                */
+/* ************************************************************ */
+/**
+* IPV6 address stored as a packed 128-bit value (16 bytes).
+* Contrary to IPAddress, the family is known at compile time so all operations are constexpr, never throw and never switch on a Type.
+* Implicitly converts to IPAddress.
+*/
+class IPV6Address final
+{
+public:
+	using value_type = IPAddress::value_type_v6;
+	using value_type_packed = IPAddress::value_type_packed_v6;
+
+	static constexpr IPAddress::Type Type = IPAddress::Type::V6;
+	static constexpr std::uint8_t BitsCount = 128u;
+
+	/** Default constructor (::). */
+	constexpr IPV6Address() noexcept = default;
+
+	/** Constructor from a packed value. */
+	constexpr explicit IPV6Address(value_type_packed const& ipv6) noexcept
+		: _value{ ipv6.first, ipv6.second }
+	{
+	}
+
+	/** Constructor from the 8 groups of the address. */
+	constexpr explicit IPV6Address(value_type const& ipv6) noexcept
+		: _value{ packGroups(ipv6[0], ipv6[1], ipv6[2], ipv6[3]), packGroups(ipv6[4], ipv6[5], ipv6[6], ipv6[7]) }
+	{
+	}
+
+	/** Constructor from an IPAddress. Throws std::invalid_argument if IPAddress is not a Type::V6. */
+	explicit IPV6Address(IPAddress const& ip)
+		: IPV6Address{ ip.getIPV6Packed() }
+	{
+	}
+
+	/** Returns the address from a packed UInt128 value, as used by IPPrefix. */
+	static constexpr IPV6Address fromValue(UInt128 const& value) noexcept
+	{
+		return IPV6Address{ value_type_packed{ value.high, value.low } };
+	}
+
+	/** Returns the netmask for the specified prefix length (clamped to 128). */
+	static constexpr IPV6Address makeNetmask(std::uint8_t const prefixLength) noexcept
+	{
+		return fromValue(IPPrefix::makeNetmaskValue(Type, prefixLength < BitsCount ? prefixLength : BitsCount));
+	}
+
+	/** Returns the V4 mapped address (::ffff:a.b.c.d) of the specified IPV4Address. */
+	static constexpr IPV6Address fromMappedV4(IPV4Address const& ipv4) noexcept
+	{
+		return fromValue(UInt128{ 0u, 0x0000FFFF00000000u | ipv4.getPacked() });
+	}
+
+	/** Returns the packed value. */
+	constexpr value_type_packed getPacked() const noexcept
+	{
+		return value_type_packed{ _value.high, _value.low };
+	}
+
+	/** Returns the packed value as a UInt128, as used by IPPrefix. */
+	constexpr UInt128 getValue() const noexcept
+	{
+		return _value;
+	}
+
+	/** Returns the 8 groups of the address. */
+	constexpr value_type getGroups() const noexcept
+	{
+		return value_type{ getGroup(_value.high, 48), getGroup(_value.high, 32), getGroup(_value.high, 16), getGroup(_value.high, 0), getGroup(_value.low, 48), getGroup(_value.low, 32), getGroup(_value.low, 16), getGroup(_value.low, 0) };
+	}
+
+	/** True if the address is ::. */
+	constexpr bool isUnspecified() const noexcept
+	{
+		return _value == UInt128{};
+	}
+
+	/** True if the address is ::1. */
+	constexpr bool isLoopback() const noexcept
+	{
+		return _value == UInt128{ 1u };
+	}
+
+	/** True if the address is in fe80::/10. */
+	constexpr bool isLinkLocal() const noexcept
+	{
+		return (_value.high >> 54) == 0x3FAu;
+	}
+
+	/** True if the address is in ff00::/8. */
+	constexpr bool isMulticast() const noexcept
+	{
+		return (_value.high >> 56) == 0xFFu;
+	}
+
+	/** True if the address is in the unique local range (fc00::/7). */
+	constexpr bool isPrivate() const noexcept
+	{
+		return (_value.high >> 57) == 0x7Eu;
+	}
+
+	/** True if the address is a V4 mapped one (::ffff:a.b.c.d). */
+	constexpr bool isV4Mapped() const noexcept
+	{
+		return (_value.high == 0u) & ((_value.low >> 32) == 0xFFFFu);
+	}
+
+	/** Returns the V4 address mapped in the 32 least significant bits (only meaningful if isV4Mapped() is true). */
+	constexpr IPV4Address getMappedV4() const noexcept
+	{
+		return IPV4Address{ static_cast<IPV4Address::value_type_packed>(_value.low) };
+	}
+
+	/** Creates a prefix from this address. Throws std::invalid_argument if prefixLength is out of range (0 to 128). */
+	constexpr IPPrefix toPrefix(std::uint8_t const prefixLength) const
+	{
+		return IPPrefix::fromPackedV6(getPacked(), prefixLength);
+	}
+
+	/** IPAddress conversion operator. */
+	operator IPAddress() const noexcept
+	{
+		return IPAddress{ getPacked() };
+	}
+
+	friend constexpr bool operator==(IPV6Address const& lhs, IPV6Address const& rhs) noexcept
+	{
+		return lhs._value == rhs._value;
+	}
+	friend constexpr bool operator!=(IPV6Address const& lhs, IPV6Address const& rhs) noexcept
+	{
+		return lhs._value != rhs._value;
+	}
+	friend constexpr bool operator<(IPV6Address const& lhs, IPV6Address const& rhs) noexcept
+	{
+		return lhs._value < rhs._value;
+	}
+	friend constexpr bool operator<=(IPV6Address const& lhs, IPV6Address const& rhs) noexcept
+	{
+		return lhs._value <= rhs._value;
+	}
+	friend constexpr bool operator>(IPV6Address const& lhs, IPV6Address const& rhs) noexcept
+	{
+		return lhs._value > rhs._value;
+	}
+	friend constexpr bool operator>=(IPV6Address const& lhs, IPV6Address const& rhs) noexcept
+	{
+		return lhs._value >= rhs._value;
+	}
+	/** Increment operator (modulo 2^128). */
+	friend constexpr IPV6Address operator+(IPV6Address const& lhs, UInt128 const& offset) noexcept
+	{
+		return fromValue(lhs._value + offset);
+	}
+	/** Decrement operator (modulo 2^128). */
+	friend constexpr IPV6Address operator-(IPV6Address const& lhs, UInt128 const& offset) noexcept
+	{
+		return fromValue(lhs._value - offset);
+	}
+	friend constexpr IPV6Address& operator++(IPV6Address& lhs) noexcept
+	{
+		lhs._value = lhs._value + UInt128{ 1u };
+		return lhs;
+	}
+	friend constexpr IPV6Address& operator--(IPV6Address& lhs) noexcept
+	{
+		lhs._value = lhs._value - UInt128{ 1u };
+		return lhs;
+	}
+	friend constexpr IPV6Address operator&(IPV6Address const& lhs, IPV6Address const& rhs) noexcept
+	{
+		return fromValue(lhs._value & rhs._value);
+	}
+	friend constexpr IPV6Address operator|(IPV6Address const& lhs, IPV6Address const& rhs) noexcept
+	{
+		return fromValue(lhs._value | rhs._value);
+	}
+	friend constexpr IPV6Address operator^(IPV6Address const& lhs, IPV6Address const& rhs) noexcept
+	{
+		return fromValue(lhs._value ^ rhs._value);
+	}
+	constexpr IPV6Address operator~() const noexcept
+	{
+		return fromValue(~_value);
+	}
+
+private:
+	static constexpr std::uint64_t packGroups(std::uint16_t const a, std::uint16_t const b, std::uint16_t const c, std::uint16_t const d) noexcept
+	{
+		return (std::uint64_t{ a } << 48) | (std::uint64_t{ b } << 32) | (std::uint64_t{ c } << 16) | std::uint64_t{ d };
+	}
+	static constexpr std::uint16_t getGroup(std::uint64_t const value, unsigned int const shift) noexcept
+	{
+		return static_cast<std::uint16_t>(value >> shift);
+	}
+
+	UInt128 _value{};
+};
+
+/* ************************************************************ */
+/* Family generic algorithms                                    */
+/* ************************************************************ */
+/** True if AddressType is one of the family specific address types (IPV4Address or IPV6Address) */
+template<typename AddressType>
+constexpr bool IsIPFamilyAddress = std::is_same_v<AddressType, IPV4Address> || std::is_same_v<AddressType, IPV6Address>;
+
+/** Returns the number of leading bits set in the value. */
+constexpr std::uint8_t countLeadingOnes(std::uint64_t const value) noexcept
+{
+#if defined(__cpp_lib_bitops)
+	return static_cast<std::uint8_t>(std::countl_one(value));
+#else
+	if (value == ~std::uint64_t{ 0u })
+	{
+		return 64u;
+	}
+	// Binary search of the first cleared bit
+	auto count = std::uint8_t{ 0u };
+	auto remaining = value;
+	for (auto width = 32u; width > 0u; width /= 2u)
+	{
+		auto const mask = ~std::uint64_t{ 0u } << (64u - width);
+		if ((remaining & mask) == mask)
+		{
+			count += static_cast<std::uint8_t>(width);
+			remaining <<= width;
+		}
+	}
+	return count;
+#endif
+}
+
+/** Returns the network address (host bits cleared) of the address for the specified prefix length (clamped to AddressType::BitsCount). */
+template<typename AddressType, typename = std::enable_if_t<IsIPFamilyAddress<AddressType>>>
+constexpr AddressType getNetworkAddress(AddressType const& address, std::uint8_t const prefixLength) noexcept
+{
+	return address & AddressType::makeNetmask(prefixLength);
+}
+
+/** Returns the broadcast address (host bits set, last address of the prefix for V6) of the address for the specified prefix length (clamped to AddressType::BitsCount). */
+template<typename AddressType, typename = std::enable_if_t<IsIPFamilyAddress<AddressType>>>
+constexpr AddressType getBroadcastAddress(AddressType const& address, std::uint8_t const prefixLength) noexcept
+{
+	return address | ~AddressType::makeNetmask(prefixLength);
+}
+
+/** Returns true if both addresses are in the same subnet for the specified prefix length (clamped to AddressType::BitsCount). */
+template<typename AddressType, typename = std::enable_if_t<IsIPFamilyAddress<AddressType>>>
+constexpr bool isInSameSubnet(AddressType const& lhs, AddressType const& rhs, std::uint8_t const prefixLength) noexcept
+{
+	return ((lhs ^ rhs) & AddressType::makeNetmask(prefixLength)) == AddressType{};
+}
+
+/** Returns the number of leading bits set in the netmask (only meaningful for a contiguous netmask). */
+template<typename AddressType, typename = std::enable_if_t<IsIPFamilyAddress<AddressType>>>
+constexpr std::uint8_t getPrefixLength(AddressType const& netmask) noexcept
+{
+	auto const packed = netmask.getPacked();
+	if constexpr (std::is_same_v<AddressType, IPV4Address>)
+	{
+		// Low bits cleared, so the count stops at 32
+		return countLeadingOnes(std::uint64_t{ packed } << 32);
+	}
+	else
+	{
+		auto const length = countLeadingOnes(packed.first);
+		return length < 64u ? length : static_cast<std::uint8_t>(length + countLeadingOnes(packed.second));
+	}
+}
+
+/** Calls the handler with the IPV4Address or IPV6Address held by the IPAddress (both calls must return the same type), so generic algorithms are instantiated for each family. Throws std::invalid_argument if IPAddress Type is unsupported. */
+template<typename Handler>
+decltype(auto) visitIPAddress(IPAddress const& ip, Handler&& handler)
+{
+	switch (ip.getType())
+	{
+		case IPAddress::Type::V4:
+			return handler(IPV4Address{ ip.getIPV4Packed() });
+		case IPAddress::Type::V6:
+			return handler(IPV6Address{ ip.getIPV6Packed() });
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+}
+
+} // namespace networkInterface
+} // namespace la
@@ -0,0 +1,262 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+* @file ipPrefix.hpp
+* @author Christophe Calmejane
+* @brief Validated CIDR prefix (address and prefix length), with constexpr non-throwing subnet computations.
+*/
+
+#pragma once
+
+#include "networkInterfaceHelper.hpp"
+
+#include <cstdint>
+#include <stdexcept> // invalid_argument
+
+namespace la
+{
+namespace networkInterface
+{
+/* ************************************************************ */
+/* IPPrefix class declaration                                   */
+/* ************************************************************ */
+/**
+* CIDR prefix (an address and a prefix length), validated once at construction.
+* Contrary to IPAddressInfo, the subnet computations never throw and do not validate the netmask again.
+* Packed values are returned as UInt128 (V4 values are stored in the 32 least significant bits).
+* The prefix length of a V4 prefix cannot be 0, so that it can always be converted to a valid IPAddressInfo.
+*/
+class IPPrefix final
+{
+public:
+	/** Default constructor. Creates an invalid prefix (IPAddress::Type::None). */
+	constexpr IPPrefix() noexcept = default;
+
+	/** Constructor from an IPAddress and a prefix length. Throws std::invalid_argument if the IPAddress is not valid, or if prefixLength is out of range (1 to 32 for V4, 0 to 128 for V6). */
+	IPPrefix(IPAddress const& address, std::uint8_t const prefixLength);
+
+	/** Constructor from an IPAddressInfo. Throws std::invalid_argument if either address or netmask is invalid, or if they are not of the same IPAddress::Type */
+	explicit IPPrefix(IPAddressInfo const& info);
+
+	/** Creates a V4 prefix from a packed address. Throws std::invalid_argument if prefixLength is out of range (1 to 32). */
+	static constexpr IPPrefix fromPackedV4(IPAddress::value_type_packed_v4 const ipv4, std::uint8_t const prefixLength)
+	{
+		if (prefixLength == 0 || prefixLength > 32)
+		{
+			throw std::invalid_argument("Invalid V4 prefix length");
+		}
+		return IPPrefix{ IPAddress::Type::V4, UInt128{ ipv4 }, prefixLength };
+	}
+
+	/** Creates a V6 prefix from a packed address. Throws std::invalid_argument if prefixLength is out of range (0 to 128). */
+	static constexpr IPPrefix fromPackedV6(IPAddress::value_type_packed_v6 const& ipv6, std::uint8_t const prefixLength)
+	{
+		if (prefixLength > 128)
+		{
+			throw std::invalid_argument("Invalid V6 prefix length");
+		}
+		return IPPrefix{ IPAddress::Type::V6, UInt128{ ipv6.first, ipv6.second }, prefixLength };
+	}
+
+	/** Returns true if the prefix is valid (not default constructed). */
+	constexpr bool isValid() const noexcept
+	{
+		return _type != IPAddress::Type::None;
+	}
+
+	/** Returns the IPAddress::Type of the prefix. */
+	constexpr IPAddress::Type getType() const noexcept
+	{
+		return _type;
+	}
+
+	/** Returns the prefix length. */
+	constexpr std::uint8_t getPrefixLength() const noexcept
+	{
+		return _prefixLength;
+	}
+
+	/** Returns the packed address the prefix was created with (host bits are preserved). */
+	constexpr UInt128 getAddressValue() const noexcept
+	{
+		return _address;
+	}
+
+	/** Returns the packed netmask. */
+	constexpr UInt128 getNetmaskValue() const noexcept
+	{
+		return _netmask;
+	}
+
+	/** Returns the packed network address (address with host bits cleared). */
+	constexpr UInt128 getNetworkValue() const noexcept
+	{
+		return _address & _netmask;
+	}
+
+	/** Returns the packed broadcast address (address with host bits set). For V6 (which doesn't support broadcast), this is the last address of the prefix. */
+	constexpr UInt128 getBroadcastValue() const noexcept
+	{
+		return _address | _hostmask;
+	}
+
+	/** Returns the first usable host address. Same as the network address for V6, and for V4 /31 and /32 prefixes (RFC 3021). */
+	constexpr UInt128 getFirstHostValue() const noexcept
+	{
+		return getNetworkValue() + UInt128{ static_cast<std::uint64_t>(hasReservedV4Addresses()) };
+	}
+
+	/** Returns the last usable host address. Same as the broadcast value for V6, and for V4 /31 and /32 prefixes (RFC 3021). */
+	constexpr UInt128 getLastHostValue() const noexcept
+	{
+		return getBroadcastValue() - UInt128{ static_cast<std::uint64_t>(hasReservedV4Addresses()) };
+	}
+
+	/** Returns true if the packed V4 address belongs to the prefix (always false if the prefix is not V4). */
+	constexpr bool contains(IPAddress::value_type_packed_v4 const ipv4) const noexcept
+	{
+		return (_type == IPAddress::Type::V4) & ((UInt128{ ipv4 } & _netmask) == getNetworkValue());
+	}
+
+	/** Returns true if the packed V6 address belongs to the prefix (always false if the prefix is not V6). */
+	constexpr bool contains(IPAddress::value_type_packed_v6 const& ipv6) const noexcept
+	{
+		return (_type == IPAddress::Type::V6) & ((UInt128{ ipv6.first, ipv6.second } & _netmask) == getNetworkValue());
+	}
+
+	/** Returns true if the other prefix is entirely included in this one (same Type, same or longer prefix length, matching network). */
+	constexpr bool contains(IPPrefix const& other) const noexcept
+	{
+		return (_type != IPAddress::Type::None) & (_type == other._type) & (other._prefixLength >= _prefixLength) & ((other._address & _netmask) == getNetworkValue());
+	}
+
+	/** Returns true if the IPAddress belongs to the prefix (always false if Types differ). */
+	bool contains(IPAddress const& ip) const noexcept;
+
+	/** Returns the address the prefix was created with, or an invalid IPAddress if the prefix is not valid. */
+	IPAddress getAddress() const noexcept;
+
+	/** Returns the netmask, or an invalid IPAddress if the prefix is not valid. */
+	IPAddress getNetmask() const noexcept;
+
+	/** Returns the network address, or an invalid IPAddress if the prefix is not valid. */
+	IPAddress getNetworkAddress() const noexcept;
+
+	/** Returns the broadcast address (last address of the prefix for V6), or an invalid IPAddress if the prefix is not valid. */
+	IPAddress getBroadcastAddress() const noexcept;
+
+	/** Returns the first usable host address, or an invalid IPAddress if the prefix is not valid. */
+	IPAddress getFirstHostAddress() const noexcept;
+
+	/** Returns the last usable host address, or an invalid IPAddress if the prefix is not valid. */
+	IPAddress getLastHostAddress() const noexcept;
+
+	/** Converts to an IPAddressInfo (lossless, host bits of the address are preserved). Returns a default IPAddressInfo if the prefix is not valid. */
+	IPAddressInfo toIPAddressInfo() const noexcept;
+
+	/** Returns the packed netmask for the specified Type and prefix length (prefixLength must not exceed the Type bits count), computed without branching. */
+	static constexpr UInt128 makeNetmaskValue(IPAddress::Type const type, std::uint8_t const prefixLength) noexcept
+	{
+		if (type == IPAddress::Type::V4)
+		{
+			return UInt128{ makeLaneMask(prefixLength) >> 32 };
+		}
+		if (type == IPAddress::Type::V6)
+		{
+			auto const highBits = prefixLength < 64 ? prefixLength : std::uint8_t{ 64u };
+			auto const lowBits = static_cast<std::uint8_t>(prefixLength - highBits);
+			return UInt128{ makeLaneMask(highBits), makeLaneMask(lowBits) };
+		}
+		return UInt128{};
+	}
+
+	/** Equality operator. Returns true if both prefixes have the same Type, address and prefix length. */
+	friend constexpr bool operator==(IPPrefix const& lhs, IPPrefix const& rhs) noexcept
+	{
+		return lhs._type == rhs._type && lhs._prefixLength == rhs._prefixLength && lhs._address == rhs._address;
+	}
+
+	/** Non equality operator. */
+	friend constexpr bool operator!=(IPPrefix const& lhs, IPPrefix const& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	/** Inferiority operator. Prefixes are ordered by Type, then address, then prefix length. */
+	friend constexpr bool operator<(IPPrefix const& lhs, IPPrefix const& rhs) noexcept
+	{
+		if (lhs._type != rhs._type)
+		{
+			return lhs._type < rhs._type;
+		}
+		if (lhs._address != rhs._address)
+		{
+			return lhs._address < rhs._address;
+		}
+		return lhs._prefixLength < rhs._prefixLength;
+	}
+
+private:
+	/** Constructor from already validated values. */
+	constexpr IPPrefix(IPAddress::Type const type, UInt128 const& address, std::uint8_t const prefixLength) noexcept
+		: _address{ address }
+		, _netmask{ makeNetmaskValue(type, prefixLength) }
+		, _hostmask{ makeNetmaskValue(type, prefixLength) ^ makeNetmaskValue(type, type == IPAddress::Type::V4 ? 32u : 128u) }
+		, _type{ type }
+		, _prefixLength{ prefixLength }
+	{
+	}
+
+	/** Returns a mask with the 'countBits' (0 to 64) most significant bits set. */
+	static constexpr std::uint64_t makeLaneMask(std::uint8_t const countBits) noexcept
+	{
+		// Shift in two steps so a (undefined) 64 bits shift is never performed
+		return ~((~std::uint64_t{ 0u } >> (countBits / 2u)) >> (countBits - countBits / 2u));
+	}
+
+	/** Returns true if the prefix is V4 with reserved network and broadcast addresses (prefix length shorter than 31). */
+	constexpr bool hasReservedV4Addresses() const noexcept
+	{
+		return (_type == IPAddress::Type::V4) & (_prefixLength < 31u);
+	}
+
+	UInt128 _address{};
+	UInt128 _netmask{};
+	UInt128 _hostmask{};
+	IPAddress::Type _type{ IPAddress::Type::None };
+	std::uint8_t _prefixLength{ 0u };
+};
+
+} // namespace networkInterface
+} // namespace la
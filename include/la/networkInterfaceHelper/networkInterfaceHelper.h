@@ -41,6 +41,8 @@
 
 #include "internals/exports.h"
 
+#include <stddef.h>
+
 typedef char const* nih_const_string_t;
 typedef char* nih_string_t;
 typedef unsigned char nih_mac_address_t[6];
@@ -63,6 +65,29 @@ typedef enum nih_network_interface_type_e
 	nih_network_interface_type_AWDL = 4, /**< Apple Wireless Direct Link */
 } nih_network_interface_type_t;
 
+typedef struct nih_string_view_s
+{
+	nih_const_string_t data; /** First character of the string (the string is NULL-terminated) (UTF-8) */
+	size_t length; /** Length of the string (not including the NULL character) */
+} nih_string_view_t;
+
+/** Valid values for nih_ip_address_t family */
+typedef enum nih_ip_address_family_e
+{
+	nih_ip_address_family_None = 0, /**< Invalid address */
+	nih_ip_address_family_V4 = 1, /**< IPV4 address */
+	nih_ip_address_family_V6 = 2, /**< IPV6 address */
+} nih_ip_address_family_t;
+
+typedef struct nih_ip_address_s
+{
+	unsigned char family; /** The family of the address (nih_ip_address_family_t value) */
+	unsigned char prefix_length; /** Prefix length of the netmask (0 for gateways) */
+	unsigned char bytes[16]; /** Address in network byte order (only the first 4 bytes are used for IPV4) */
+} nih_ip_address_t;
+typedef nih_ip_address_t* nih_ip_address_p;
+typedef nih_ip_address_t const* nih_ip_address_cp;
+
 typedef struct nih_network_interface_s
 {
 	nih_string_t id; /** Identifier of the interface (system chosen, unique) (UTF-8) */
@@ -75,12 +100,63 @@ typedef struct nih_network_interface_s
 	nih_bool_t is_enabled; /** True if this interface is enabled */
 	nih_bool_t is_connected; /** True if this interface is connected to a working network (able to send and receive packets) */
 	nih_bool_t is_virtual; /** True if this interface is emulating a physical adapter (Like BlueTooth, VirtualMachine, or Software Loopback) */
+	nih_ip_address_p ip_address_infos; /** List of binary IP addresses (with the prefix length of their netmask) attached to this interface, NULL if empty */
+	size_t ip_address_infos_count; /** Number of entries in ip_address_infos */
+	nih_ip_address_p gateway_addresses; /** List of binary Gateways available for this interface, NULL if empty */
+	size_t gateway_addresses_count; /** Number of entries in gateway_addresses */
 } nih_network_interface_t, *nih_network_interface_p;
 typedef nih_network_interface_t const* nih_network_interface_cp;
 
+/** Opaque snapshot of all network interfaces, stored in a single contiguous buffer */
+typedef struct nih_snapshot_s* nih_snapshot_p;
+typedef struct nih_snapshot_s const* nih_snapshot_cp;
+
+/** Read-only view of an interface stored in a snapshot. All pointers are only valid until the snapshot is freed. */
+typedef struct nih_snapshot_interface_s
+{
+	nih_string_view_t id; /** Identifier of the interface (system chosen, unique) */
+	nih_string_view_t description; /** Description of the interface (system chosen) */
+	nih_string_view_t alias; /** Alias of the interface (often user chosen) */
+	nih_mac_address_t mac_address; /** Mac address */
+	nih_ip_address_cp ip_addresses; /** List of IP addresses attached to this interface */
+	size_t ip_addresses_count; /** Number of entries in ip_addresses */
+	nih_ip_address_cp gateways; /** List of Gateways available for this interface */
+	size_t gateways_count; /** Number of entries in gateways */
+	nih_network_interface_type_t type; /** The type of interface */
+	nih_bool_t is_enabled; /** True if this interface is enabled */
+	nih_bool_t is_connected; /** True if this interface is connected to a working network (able to send and receive packets) */
+	nih_bool_t is_virtual; /** True if this interface is emulating a physical adapter (Like BlueTooth, VirtualMachine, or Software Loopback) */
+} nih_snapshot_interface_t, *nih_snapshot_interface_p;
+
+/** Valid values for nih_event_t kind */
+typedef enum nih_event_kind_e
+{
+	nih_event_kind_InterfaceAdded = 0, /**< Interface was added */
+	nih_event_kind_InterfaceRemoved = 1, /**< Interface was removed */
+	nih_event_kind_EnabledStateChanged = 2, /**< is_enabled field of the interface changed */
+	nih_event_kind_ConnectedStateChanged = 3, /**< is_connected field of the interface changed */
+	nih_event_kind_AliasChanged = 4, /**< alias field of the interface changed */
+	nih_event_kind_IPAddressesChanged = 5, /**< ip_addresses field of the interface changed */
+	nih_event_kind_GatewaysChanged = 6, /**< gateways field of the interface changed */
+} nih_event_kind_t;
+
+typedef struct nih_event_s
+{
+	nih_event_kind_t kind; /** The kind of change */
+	size_t interface_index; /** Index (in the snapshot delivered with the event) of the interface, as it was right after the change */
+} nih_event_t;
+typedef nih_event_t const* nih_event_cp;
+
+/** Opaque monitor of network interfaces changes */
+typedef struct nih_monitor_s* nih_monitor_p;
+typedef struct nih_monitor_s const* nih_monitor_cp;
+
 /** LA_NIH_freeNetworkInterface must be called on each returned 'intfc' when no longer needed. */
 typedef void(LA_NIH_BINDINGS_C_CALL_CONVENTION* nih_enumerate_interfaces_cb)(nih_network_interface_p intfc);
 
+/** Called once per batch of changes. 'events' and 'interfaces' are only valid during the call. Helper methods can safely be called from the callback, but LA_NIH_destroyMonitor must not. */
+typedef void(LA_NIH_BINDINGS_C_CALL_CONVENTION* nih_monitor_events_cb)(void* user_data, nih_event_cp events, size_t events_count, nih_snapshot_cp interfaces);
+
 /** Enumerates network interfaces. The specified handler is called for each found interface. */
 LA_NIH_BINDINGS_C_API void LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_enumerateInterfaces(nih_enumerate_interfaces_cb const onInterface);
 /** Retrieve a copy of an interface from it's name. Returns NULL if no interface exists with that name. LA_NIH_freeNetworkInterface must be called on the returned interface. */
@@ -89,5 +165,33 @@ LA_NIH_BINDINGS_C_API nih_network_interface_p LA_NIH_BINDINGS_C_CALL_CONVENTION
 LA_NIH_BINDINGS_C_API nih_string_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_macAddressToString(nih_mac_address_cp const macAddress, nih_bool_t const upperCase);
 /** Returns true if specified MAC address is valid. */
 LA_NIH_BINDINGS_C_API nih_bool_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_isMacAddressValid(nih_mac_address_cp const macAddress);
+/** Returns the name of the organization the OUI of the MAC address is assigned to, or NULL if unknown (always NULL if the library is built without ENABLE_NIH_OUI_DATABASE). The returned string has static storage and must not be freed. */
+LA_NIH_BINDINGS_C_API nih_const_string_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_getMacAddressVendor(nih_mac_address_cp const macAddress);
+/** Converts the specified binary IP address to string (with its prefix length appended as '/xx' if 'withPrefixLength' is true). Returns NULL if the address is invalid. LA_NIH_freeString must be called on the returned string. */
+LA_NIH_BINDINGS_C_API nih_string_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_ipAddressToString(nih_ip_address_cp const address, nih_bool_t const withPrefixLength);
+/** Returns true if 'address' is in the subnet defined by 'subnet' and its prefix length (both addresses must be of the same family). */
+LA_NIH_BINDINGS_C_API nih_bool_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_isIPAddressInSubnet(nih_ip_address_cp const subnet, nih_ip_address_cp const address);
+/** Frees a string returned by the library. */
+LA_NIH_BINDINGS_C_API void LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_freeString(nih_string_t str);
 /** Frees nih_network_interface_p. */
 LA_NIH_BINDINGS_C_API void LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_freeNetworkInterface(nih_network_interface_p intfc);
+/** Takes a snapshot of all network interfaces (using a single allocation). Returns NULL in case of error. LA_NIH_freeSnapshot must be called on the returned snapshot. */
+LA_NIH_BINDINGS_C_API nih_snapshot_p LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_takeSnapshot(void);
+/** Returns the number of interfaces in the snapshot. */
+LA_NIH_BINDINGS_C_API size_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_getSnapshotInterfacesCount(nih_snapshot_cp const snapshot);
+/** Fills 'intfc' with a view of the interface at the specified index (without allocating). Returns false if the index is out of range. */
+LA_NIH_BINDINGS_C_API nih_bool_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_getSnapshotInterface(nih_snapshot_cp const snapshot, size_t const index, nih_snapshot_interface_p const intfc);
+/** Frees nih_snapshot_p (all views retrieved from it become invalid). */
+LA_NIH_BINDINGS_C_API void LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_freeSnapshot(nih_snapshot_p snapshot);
+/** Creates a monitor calling 'onEvents' for each batch of changes, from the helper's thread. Already existing interfaces are delivered as a first batch of added events, before this function returns. Returns NULL in case of error. LA_NIH_destroyMonitor must be called on the returned monitor. */
+LA_NIH_BINDINGS_C_API nih_monitor_p LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_createMonitor(nih_monitor_events_cb const onEvents, void* const user_data);
+/** Creates a monitor queuing batches of changes until LA_NIH_processMonitorEvents is called. At most 1024 events are queued, the oldest ones being dropped (see LA_NIH_getMonitorDroppedEventsCount). Returns NULL in case of error. LA_NIH_destroyMonitor must be called on the returned monitor. */
+LA_NIH_BINDINGS_C_API nih_monitor_p LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_createPollableMonitor(nih_monitor_events_cb const onEvents, void* const user_data);
+/** Returns a file descriptor which is readable while a pollable monitor has pending events (do not read nor close it). Returns -1 if the monitor is not pollable or if not supported on this platform (Windows). */
+LA_NIH_BINDINGS_C_API int LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_getMonitorFileDescriptor(nih_monitor_cp const monitor);
+/** Delivers all pending events of a pollable monitor as a single batch, from the calling thread. Returns the number of delivered events. */
+LA_NIH_BINDINGS_C_API size_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_processMonitorEvents(nih_monitor_p const monitor);
+/** Returns the number of events a pollable monitor dropped since its creation, because LA_NIH_processMonitorEvents was not called often enough (a snapshot should be taken to resynchronize when it increases). */
+LA_NIH_BINDINGS_C_API size_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_getMonitorDroppedEventsCount(nih_monitor_cp const monitor);
+/** Stops and frees nih_monitor_p (pending events are discarded). */
+LA_NIH_BINDINGS_C_API void LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_destroyMonitor(nih_monitor_p monitor);
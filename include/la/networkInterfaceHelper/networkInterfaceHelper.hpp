@@ -41,10 +41,25 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <array>
 #include <functional>
 #include <utility>
+#include <memory>
+#include <optional>
+#include <chrono>
+#include <cstddef> // size_t
+#include <charconv> // to_chars_result / from_chars_result
+#include <type_traits> // enable_if / is_unsigned
+
+// Forward declarations of the OS socket address structures (include <netinet/in.h> or <ws2tcpip.h> to use them)
+struct in_addr;
+struct in6_addr;
+struct sockaddr;
+struct sockaddr_in;
+struct sockaddr_in6;
+struct sockaddr_storage;
 
 namespace la
 {
@@ -52,6 +67,41 @@ namespace networkInterface
 {
 using MacAddress = std::array<std::uint8_t, 6>;
 
+/** Textual notations of a MacAddress */
+enum class MacAddressNotation : std::uint8_t
+{
+	Colon = 0, /**< 00:1B:92:AB:CD:EF */
+	Dash = 1, /**< 00-1B-92-AB-CD-EF */
+	CiscoDotted = 2, /**< 001B.92AB.CDEF */
+	Bare = 3, /**< 001B92ABCDEF */
+};
+
+/** Returns the number of characters of a MacAddress in the specified notation */
+constexpr std::size_t getMacAddressCharsLength(MacAddressNotation const notation) noexcept
+{
+	switch (notation)
+	{
+		case MacAddressNotation::Colon:
+		case MacAddressNotation::Dash:
+			return 17u;
+		case MacAddressNotation::CiscoDotted:
+			return 14u;
+		case MacAddressNotation::Bare:
+			return 12u;
+		default:
+			return 0u;
+	}
+}
+
+/** Maximum number of characters of an IPAddress written by NetworkInterfaceHelper::ipAddressToChars (full IPV6 form) */
+constexpr std::size_t IPAddressCharsMaxLength = 39u;
+
+/** Maximum number of characters of an IPAddressInfo written by NetworkInterfaceHelper::ipAddressInfoToChars (full IPV6 form followed by "/128") */
+constexpr std::size_t IPAddressInfoCharsMaxLength = IPAddressCharsMaxLength + 4u;
+
+/** Maximum number of characters of an IPEndpoint written by NetworkInterfaceHelper::ipEndpointToChars (bracketed full IPV6 form with a numeric scope id, followed by ":65535") */
+constexpr std::size_t IPEndpointCharsMaxLength = 1u + IPAddressCharsMaxLength + 11u + 1u + 6u;
+
 /** Gets the library version. */
 std::string getLibraryVersion() noexcept;
 
@@ -61,6 +111,90 @@ std::string getLibraryName() noexcept;
 /** Gets the library copyright. */
 std::string getLibraryCopyright() noexcept;
 
+/* ************************************************************ */
+/* UInt128 declaration                                          */
+/* ************************************************************ */
+/** Unsigned 128-bit integer (arithmetic is modulo 2^128), used for IPAddress offsets and distances */
+struct UInt128
+{
+	std::uint64_t high{ 0u };
+	std::uint64_t low{ 0u };
+
+	/** Default constructor (0). */
+	constexpr UInt128() noexcept = default;
+
+	/** Constructor from a 64-bit value (implicit so any unsigned value can be used as an offset). */
+	constexpr UInt128(std::uint64_t const value) noexcept
+		: low{ value }
+	{
+	}
+
+	/** Constructor from the high and low 64-bit parts. */
+	constexpr UInt128(std::uint64_t const highPart, std::uint64_t const lowPart) noexcept
+		: high{ highPart }
+		, low{ lowPart }
+	{
+	}
+
+	/** Returns the maximum value (2^128 - 1). */
+	static constexpr UInt128 max() noexcept
+	{
+		return UInt128{ ~std::uint64_t{ 0u }, ~std::uint64_t{ 0u } };
+	}
+
+	friend constexpr bool operator==(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		return lhs.high == rhs.high && lhs.low == rhs.low;
+	}
+	friend constexpr bool operator!=(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+	friend constexpr bool operator<(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		return lhs.high < rhs.high || (lhs.high == rhs.high && lhs.low < rhs.low);
+	}
+	friend constexpr bool operator<=(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		return !(rhs < lhs);
+	}
+	friend constexpr bool operator>(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		return rhs < lhs;
+	}
+	friend constexpr bool operator>=(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		return !(lhs < rhs);
+	}
+	friend constexpr UInt128 operator+(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		auto const low = lhs.low + rhs.low;
+		// The carry is computed without branching
+		return UInt128{ lhs.high + rhs.high + static_cast<std::uint64_t>(low < lhs.low), low };
+	}
+	friend constexpr UInt128 operator-(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		// The borrow is computed without branching
+		return UInt128{ lhs.high - rhs.high - static_cast<std::uint64_t>(lhs.low < rhs.low), lhs.low - rhs.low };
+	}
+	friend constexpr UInt128 operator&(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		return UInt128{ lhs.high & rhs.high, lhs.low & rhs.low };
+	}
+	friend constexpr UInt128 operator|(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		return UInt128{ lhs.high | rhs.high, lhs.low | rhs.low };
+	}
+	friend constexpr UInt128 operator^(UInt128 const& lhs, UInt128 const& rhs) noexcept
+	{
+		return UInt128{ lhs.high ^ rhs.high, lhs.low ^ rhs.low };
+	}
+	constexpr UInt128 operator~() const noexcept
+	{
+		return UInt128{ ~high, ~low };
+	}
+};
+
 /* ************************************************************ */
 /* IPAddress class declaration                                  */
 /* ************************************************************ */
@@ -104,6 +238,24 @@ public:
 	/** Constructor from a string. */
 	explicit IPAddress(std::string const& ipString);
 
+	/** Constructor from an in_addr (network byte order). */
+	explicit IPAddress(in_addr const& ipv4) noexcept;
+
+	/** Constructor from an in6_addr. If normalizeMappedV4 is true, an IPV4 mapped address (::ffff:a.b.c.d) is converted to a Type::V4 IPAddress. */
+	explicit IPAddress(in6_addr const& ipv6, bool const normalizeMappedV4 = false) noexcept;
+
+	/** Constructor from a sockaddr_in (the port is ignored). */
+	explicit IPAddress(sockaddr_in const& address) noexcept;
+
+	/** Constructor from a sockaddr_in6 (the port and scope are ignored). If normalizeMappedV4 is true, an IPV4 mapped address (::ffff:a.b.c.d) is converted to a Type::V4 IPAddress. */
+	explicit IPAddress(sockaddr_in6 const& address, bool const normalizeMappedV4 = false) noexcept;
+
+	/** Constructor from a sockaddr, which must actually be a sockaddr_in (AF_INET) or a sockaddr_in6 (AF_INET6). Throws std::invalid_argument if the address family is not supported. */
+	explicit IPAddress(sockaddr const& address, bool const normalizeMappedV4 = false);
+
+	/** Constructor from a sockaddr_storage (AF_INET or AF_INET6). Throws std::invalid_argument if the address family is not supported. */
+	explicit IPAddress(sockaddr_storage const& address, bool const normalizeMappedV4 = false);
+
 	/** Constructor for an IPV4 compatible IP inside a V6 one. */
 	IPAddress(IPAddress const& ipv4, CompatibleV6Tag);
 
@@ -134,6 +286,21 @@ public:
 	/** Getter to retrieve the IP value. Throws std::invalid_argument if IPAddress is not a Type::V6. */
 	value_type_v6 getIPV6() const;
 
+	/** Getter to retrieve the IP value as an in_addr (network byte order). Throws std::invalid_argument if IPAddress is not a Type::V4. */
+	in_addr getInAddr() const;
+
+	/** Getter to retrieve the IP value as an in6_addr. Throws std::invalid_argument if IPAddress is not a Type::V6. */
+	in6_addr getIn6Addr() const;
+
+	/** Getter to retrieve the IP value as a sockaddr_in with the specified port (in host byte order). Throws std::invalid_argument if IPAddress is not a Type::V4. */
+	sockaddr_in getSockaddrIn(std::uint16_t const port = 0u) const;
+
+	/** Getter to retrieve the IP value as a sockaddr_in6 with the specified port (in host byte order). Throws std::invalid_argument if IPAddress is not a Type::V6. */
+	sockaddr_in6 getSockaddrIn6(std::uint16_t const port = 0u) const;
+
+	/** Getter to retrieve the IP value as a sockaddr_storage (holding a sockaddr_in or a sockaddr_in6) with the specified port (in host byte order). Throws std::invalid_argument if Type is unsupported. */
+	sockaddr_storage getSockaddrStorage(std::uint16_t const port = 0u) const;
+
 	/** Getter to retrieve the IP value in the packed format. Throws std::invalid_argument if IPAddress is not a Type::V4. */
 	value_type_packed_v4 getIPV4Packed() const;
 
@@ -185,12 +352,32 @@ public:
 	/** Inferiority or equality operator. Throws std::invalid_argument if Type is unsupported. */
 	friend bool operator<=(IPAddress const& lhs, IPAddress const& rhs);
 
-	/** Increment operator. Throws std::invalid_argument if Type is unsupported. Note: Increment value is currently limited to 32bits. */
+	/** Increment operator. Throws std::invalid_argument if Type is unsupported. Note: Increment value is limited to 32bits, use the UInt128 overload for larger offsets. */
 	friend IPAddress operator+(IPAddress const& lhs, std::uint32_t const value);
 
-	/** Decrement operator. Throws std::invalid_argument if Type is unsupported. Note: Decrement value is currently limited to 32bits. */
+	/** Decrement operator. Throws std::invalid_argument if Type is unsupported. Note: Decrement value is limited to 32bits, use the UInt128 overload for larger offsets. */
 	friend IPAddress operator-(IPAddress const& lhs, std::uint32_t const value);
 
+	/** Increment operator for 64-bit unsigned offsets (not truncated to 32bits). Throws std::invalid_argument if Type is unsupported. */
+	template<typename T, typename = std::enable_if_t<std::is_unsigned_v<T> && (sizeof(T) > sizeof(std::uint32_t)) && (sizeof(T) <= sizeof(std::uint64_t))>>
+	friend IPAddress operator+(IPAddress const& lhs, T const value)
+	{
+		return lhs + UInt128{ value };
+	}
+
+	/** Decrement operator for 64-bit unsigned offsets (not truncated to 32bits). Throws std::invalid_argument if Type is unsupported. */
+	template<typename T, typename = std::enable_if_t<std::is_unsigned_v<T> && (sizeof(T) > sizeof(std::uint32_t)) && (sizeof(T) <= sizeof(std::uint64_t))>>
+	friend IPAddress operator-(IPAddress const& lhs, T const value)
+	{
+		return lhs - UInt128{ value };
+	}
+
+	/** Increment operator (modulo 2^32 for Type::V4, 2^128 for Type::V6). Throws std::invalid_argument if Type is unsupported. */
+	friend IPAddress operator+(IPAddress const& lhs, UInt128 const& value);
+
+	/** Decrement operator (modulo 2^32 for Type::V4, 2^128 for Type::V6). Throws std::invalid_argument if Type is unsupported. */
+	friend IPAddress operator-(IPAddress const& lhs, UInt128 const& value);
+
 	/** operator++ Throws std::invalid_argument if Type is unsupported. */
 	friend IPAddress& operator++(IPAddress& lhs);
 
@@ -215,6 +402,86 @@ public:
 	/** Unpack an IP of Type::V6. */
 	static value_type_v6 unpack(value_type_packed_v6 const ipv6) noexcept;
 
+	/** Returns the IP incremented by 'offset', saturating at the highest address of its Type. Throws std::invalid_argument if Type is unsupported. */
+	static IPAddress addSaturated(IPAddress const& ip, UInt128 const& offset);
+
+	/** Returns the IP decremented by 'offset', saturating at the lowest address of its Type. Throws std::invalid_argument if Type is unsupported. */
+	static IPAddress subtractSaturated(IPAddress const& ip, UInt128 const& offset);
+
+	/** Returns the number of addresses between two IPs (absolute difference, so the size of a range is distance(first, last) + 1). Throws std::invalid_argument if Type is unsupported or if both IPs are not of the same Type. */
+	static UInt128 distance(IPAddress const& lhs, IPAddress const& rhs);
+
+	/** Returns the packed IP incremented by 'offset' (modulo 2^32). */
+	static constexpr value_type_packed_v4 add(value_type_packed_v4 const ipv4, UInt128 const& offset) noexcept
+	{
+		return static_cast<value_type_packed_v4>(ipv4 + offset.low);
+	}
+
+	/** Returns the packed IP incremented by 'offset' (modulo 2^128). */
+	static constexpr value_type_packed_v6 add(value_type_packed_v6 const& ipv6, UInt128 const& offset) noexcept
+	{
+		auto const result = UInt128{ ipv6.first, ipv6.second } + offset;
+		return value_type_packed_v6{ result.high, result.low };
+	}
+
+	/** Returns the packed IP decremented by 'offset' (modulo 2^32). */
+	static constexpr value_type_packed_v4 subtract(value_type_packed_v4 const ipv4, UInt128 const& offset) noexcept
+	{
+		return static_cast<value_type_packed_v4>(ipv4 - offset.low);
+	}
+
+	/** Returns the packed IP decremented by 'offset' (modulo 2^128). */
+	static constexpr value_type_packed_v6 subtract(value_type_packed_v6 const& ipv6, UInt128 const& offset) noexcept
+	{
+		auto const result = UInt128{ ipv6.first, ipv6.second } - offset;
+		return value_type_packed_v6{ result.high, result.low };
+	}
+
+	/** Returns the packed IP incremented by 'offset', saturating at 255.255.255.255. */
+	static constexpr value_type_packed_v4 addSaturated(value_type_packed_v4 const ipv4, UInt128 const& offset) noexcept
+	{
+		auto const overflows = (offset.high != 0u) | (offset.low > static_cast<value_type_packed_v4>(~ipv4));
+		return overflows ? ~value_type_packed_v4{ 0u } : static_cast<value_type_packed_v4>(ipv4 + offset.low);
+	}
+
+	/** Returns the packed IP incremented by 'offset', saturating at ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff. */
+	static constexpr value_type_packed_v6 addSaturated(value_type_packed_v6 const& ipv6, UInt128 const& offset) noexcept
+	{
+		auto const value = UInt128{ ipv6.first, ipv6.second };
+		auto const sum = value + offset;
+		auto const result = sum < value ? UInt128::max() : sum;
+		return value_type_packed_v6{ result.high, result.low };
+	}
+
+	/** Returns the packed IP decremented by 'offset', saturating at 0.0.0.0. */
+	static constexpr value_type_packed_v4 subtractSaturated(value_type_packed_v4 const ipv4, UInt128 const& offset) noexcept
+	{
+		auto const underflows = (offset.high != 0u) | (offset.low > ipv4);
+		return underflows ? value_type_packed_v4{ 0u } : static_cast<value_type_packed_v4>(ipv4 - offset.low);
+	}
+
+	/** Returns the packed IP decremented by 'offset', saturating at ::. */
+	static constexpr value_type_packed_v6 subtractSaturated(value_type_packed_v6 const& ipv6, UInt128 const& offset) noexcept
+	{
+		auto const value = UInt128{ ipv6.first, ipv6.second };
+		auto const result = value < offset ? UInt128{} : value - offset;
+		return value_type_packed_v6{ result.high, result.low };
+	}
+
+	/** Returns the number of addresses between two packed IPs (absolute difference). */
+	static constexpr UInt128 distance(value_type_packed_v4 const lhs, value_type_packed_v4 const rhs) noexcept
+	{
+		return UInt128{ lhs < rhs ? rhs - lhs : lhs - rhs };
+	}
+
+	/** Returns the number of addresses between two packed IPs (absolute difference, so the size of a /64 is distance(first, last) + 1 = 2^64). */
+	static constexpr UInt128 distance(value_type_packed_v6 const& lhs, value_type_packed_v6 const& rhs) noexcept
+	{
+		auto const l = UInt128{ lhs.first, lhs.second };
+		auto const r = UInt128{ rhs.first, rhs.second };
+		return l < r ? r - l : l - r;
+	}
+
 	/** Helper method to generate IPAddress::value_type_packed_v6 from prefix length. */
 	static IPAddress::value_type_packed_v6 packedV6FromPrefixLength(std::uint8_t const length) noexcept;
 
@@ -234,6 +501,8 @@ public:
 	IPAddress& operator=(IPAddress&&) = default;
 
 private:
+	// NetworkInterfaceHelper::ipAddressToChars copies the already built string
+	friend class NetworkInterfaceHelper;
 	// Private methods
 	void buildIPString() noexcept;
 	// Private defines
@@ -302,10 +571,11 @@ struct Interface
 	bool isEnabled{ false }; /** True if this interface is enabled */
 	bool isConnected{ false }; /** True if this interface is connected to a working network (able to send and receive packets) */
 	bool isVirtual{ false }; /** True if this interface is emulating a physical adapter (Like BlueTooth, VirtualMachine, or Software Loopback) */
+	std::uint32_t index{ 0u }; /** Index of the interface (system chosen, also used as IPV6 scope id), 0 if unknown */
 
 	friend bool operator==(Interface const& lhs, Interface const& rhs) noexcept
 	{
-		return lhs.id == rhs.id && lhs.description == rhs.description && lhs.alias == rhs.alias && lhs.macAddress == rhs.macAddress && lhs.ipAddressInfos == rhs.ipAddressInfos && lhs.gateways == rhs.gateways && lhs.type == rhs.type && lhs.isEnabled == rhs.isEnabled && lhs.isConnected == rhs.isConnected && lhs.isVirtual == rhs.isVirtual;
+		return lhs.id == rhs.id && lhs.description == rhs.description && lhs.alias == rhs.alias && lhs.macAddress == rhs.macAddress && lhs.ipAddressInfos == rhs.ipAddressInfos && lhs.gateways == rhs.gateways && lhs.type == rhs.type && lhs.isEnabled == rhs.isEnabled && lhs.isConnected == rhs.isConnected && lhs.isVirtual == rhs.isVirtual && lhs.index == rhs.index;
 	}
 	friend bool operator!=(Interface const& lhs, Interface const& rhs) noexcept
 	{
@@ -313,6 +583,122 @@ struct Interface
 	}
 };
 
+/* ************************************************************ */
+/* InterfaceFilter declaration                                  */
+/* ************************************************************ */
+struct InterfaceFilter
+{
+	using TypeMask = std::uint32_t;
+
+	/** Returns the TypeMask value for the specified Interface::Type */
+	static constexpr TypeMask typeMask(Interface::Type const type) noexcept
+	{
+		return TypeMask{ 1u } << static_cast<TypeMask>(type);
+	}
+	static constexpr TypeMask AllTypes = ~TypeMask{ 0u };
+
+	TypeMask types{ AllTypes }; /** Mask of accepted Interface::Type (combination of typeMask() values) */
+	std::string namePattern{}; /** Pattern the id or the alias of the interface must match (supports '*' and '?' wildcards), empty to accept any name */
+	IPAddress::Type addressType{ IPAddress::Type::None }; /** Only accept interfaces with at least one IP address of this type, IPAddress::Type::None to accept any */
+	bool physicalOnly{ false }; /** Only accept non-virtual interfaces */
+	bool virtualOnly{ false }; /** Only accept virtual interfaces */
+	bool enabledOnly{ false }; /** Only accept enabled interfaces */
+	bool connectedOnly{ false }; /** Only accept connected interfaces */
+
+	/** Returns true if the specified Interface passes the filter */
+	bool matches(Interface const& intfc) const noexcept;
+};
+
+/* ************************************************************ */
+/* InterfacesSnapshot declaration                               */
+/* ************************************************************ */
+/**
+* Immutable snapshot of network interfaces, stored in a single contiguous buffer of POD entries.
+* All references inside the buffer are offsets from the beginning of the buffer, so it can be copied or shared as is.
+* Layout: Header, InterfaceEntry array, IPAddressEntry array, then the NULL-terminated strings.
+*/
+class InterfacesSnapshot
+{
+public:
+	static constexpr std::uint32_t Version = 1u;
+
+	struct Header
+	{
+		std::uint32_t version{ Version }; /** Version of the layout */
+		std::uint32_t size{ 0u }; /** Total size of the buffer */
+		std::uint32_t interfacesOffset{ 0u }; /** Offset of the first InterfaceEntry */
+		std::uint32_t interfacesCount{ 0u }; /** Number of InterfaceEntry */
+	};
+
+	struct StringEntry
+	{
+		std::uint32_t offset{ 0u }; /** Offset of the first character (the string is NULL-terminated) */
+		std::uint32_t length{ 0u }; /** Length of the string (not including the NULL character) */
+	};
+
+	struct IPAddressEntry
+	{
+		std::uint8_t type{ 0u }; /** IPAddress::Type value */
+		std::uint8_t prefixLength{ 0u }; /** Prefix length of the netmask (0 for gateways) */
+		std::array<std::uint8_t, 16> bytes{}; /** Address in network byte order (only the first 4 bytes are used for IPV4) */
+	};
+
+	struct InterfaceEntry
+	{
+		StringEntry id{}; /** Identifier of the interface (UTF-8) */
+		StringEntry description{}; /** Description of the interface (UTF-8) */
+		StringEntry alias{}; /** Alias of the interface (UTF-8) */
+		std::uint32_t ipAddressesOffset{ 0u }; /** Offset of the first IPAddressEntry of this interface */
+		std::uint32_t ipAddressesCount{ 0u }; /** Number of IP addresses */
+		std::uint32_t gatewaysOffset{ 0u }; /** Offset of the first gateway IPAddressEntry of this interface */
+		std::uint32_t gatewaysCount{ 0u }; /** Number of gateways */
+		MacAddress macAddress{}; /** Mac address */
+		std::uint8_t type{ 0u }; /** Interface::Type value */
+		std::uint8_t isEnabled{ 0u }; /** 1 if this interface is enabled */
+		std::uint8_t isConnected{ 0u }; /** 1 if this interface is connected to a working network */
+		std::uint8_t isVirtual{ 0u }; /** 1 if this interface is emulating a physical adapter */
+		std::array<std::uint8_t, 2> reserved{};
+	};
+
+	/** Builds a snapshot of the specified interfaces. Throws std::invalid_argument if the snapshot would be too large. */
+	static InterfacesSnapshot build(std::vector<Interface const*> const& interfaces);
+	/** Rebuilds the specified snapshot with the specified interfaces, reusing its buffer if large enough. Throws std::invalid_argument if the snapshot would be too large. */
+	static void build(std::vector<Interface const*> const& interfaces, InterfacesSnapshot& snapshot);
+	/** Converts the specified IPAddress (eg. a gateway) to an IPAddressEntry with the specified prefix length */
+	static IPAddressEntry makeIPAddressEntry(IPAddress const& address, std::uint8_t const prefixLength) noexcept;
+	/** Converts the specified IPAddressInfo to an IPAddressEntry (prefix length computed from the netmask) */
+	static IPAddressEntry makeIPAddressEntry(IPAddressInfo const& info) noexcept;
+
+	/** Returns the number of interfaces in the snapshot */
+	std::size_t getInterfacesCount() const noexcept;
+	/** Returns the interface at the specified index. Throws std::invalid_argument if the index is out of range. */
+	InterfaceEntry const& getInterface(std::size_t const index) const;
+	/** Returns the specified string */
+	std::string_view getString(StringEntry const& str) const noexcept;
+	/** Returns the first IP address of the specified interface (InterfaceEntry::ipAddressesCount entries available) */
+	IPAddressEntry const* getIPAddresses(InterfaceEntry const& intfc) const noexcept;
+	/** Returns the first gateway of the specified interface (InterfaceEntry::gatewaysCount entries available) */
+	IPAddressEntry const* getGateways(InterfaceEntry const& intfc) const noexcept;
+
+	/** Returns the raw buffer (nullptr for an empty snapshot) */
+	std::uint8_t const* data() const noexcept;
+	/** Returns the size of the raw buffer */
+	std::size_t size() const noexcept;
+
+	InterfacesSnapshot() noexcept = default;
+	InterfacesSnapshot(InterfacesSnapshot&&) noexcept = default;
+	InterfacesSnapshot& operator=(InterfacesSnapshot&&) noexcept = default;
+
+	// Deleted compiler auto-generated methods
+	InterfacesSnapshot(InterfacesSnapshot const&) = delete;
+	InterfacesSnapshot& operator=(InterfacesSnapshot const&) = delete;
+
+private:
+	std::unique_ptr<std::uint8_t[]> _buffer{};
+	std::size_t _size{ 0u };
+	std::size_t _capacity{ 0u };
+};
+
 /** MacAddress hash functor to be used for std::hash */
 struct MacAddressHash
 {
@@ -325,13 +711,15 @@ struct MacAddressHash
 	}
 };
 
+class IPEndpoint;
+
 class NetworkInterfaceHelper
 {
 public:
 	class Observer
 	{
 	public:
-		/** Observer will remove itself in case it was not properly unregistered */
+		/** Observer will remove itself (from all helpers) in case it was not properly unregistered */
 		virtual ~Observer() noexcept;
 
 		/** Called when an Interface was added */
@@ -348,6 +736,8 @@ public:
 		virtual void onInterfaceIPAddressInfosChanged(la::networkInterface::Interface const& intfc, la::networkInterface::Interface::IPAddressInfos const& ipAddressInfos) noexcept = 0;
 		/** Called when the gateways field of the specified Interface changed */
 		virtual void onInterfaceGateWaysChanged(la::networkInterface::Interface const& intfc, la::networkInterface::Interface::Gateways const& gateways) noexcept = 0;
+		/** Called after a group of changes (eg. the refresh of an interface) has been notified, so they can be processed as a batch */
+		virtual void onChangesCompleted() noexcept {}
 	};
 	/** Defaulted version of the observer base class. */
 	class DefaultedObserver : public Observer
@@ -368,25 +758,133 @@ public:
 		/** Called when the gateways field of the specified Interface changed */
 		virtual void onInterfaceGateWaysChanged(la::networkInterface::Interface const& /*intfc*/, la::networkInterface::Interface::Gateways const& /*gateways*/) noexcept override {}
 	};
+	/** Statistics about a helper instance (since its creation). All durations are in nanoseconds. */
+	struct Statistics
+	{
+		/** HDR-style log-linear histogram: 4 sub-buckets per power of 2, so any value is recorded with a relative error below 25% */
+		struct Histogram
+		{
+			static constexpr std::size_t SubBucketsCount = 4u;
+			static constexpr std::size_t BucketsCount = 2u * SubBucketsCount + (64u - 3u) * SubBucketsCount; // Values below 8 have their own bucket, then 4 sub-buckets for each power of 2 up to 2^63
+
+			std::uint64_t count{ 0u }; /** Number of recorded values */
+			std::uint64_t sum{ 0u }; /** Sum of all recorded values */
+			std::uint64_t max{ 0u }; /** Highest recorded value */
+			std::array<std::uint64_t, BucketsCount> buckets{}; /** Number of recorded values in each bucket */
+
+			/** Returns the index of the bucket the specified value is recorded in */
+			static std::size_t getBucketIndex(std::uint64_t const value) noexcept;
+			/** Returns the lowest value recorded in the specified bucket */
+			static std::uint64_t getBucketLowerBound(std::size_t const index) noexcept;
+			/** Returns an estimation (upper bound of the bucket, capped to max) of the specified percentile (between 0 and 100) */
+			std::uint64_t getPercentile(double const percentile) const noexcept;
+		};
+
+		/** Number of changes detected, for each type of event (counted once per change, regardless of the number of observers) */
+		struct Events
+		{
+			std::uint64_t interfaceAdded{ 0u };
+			std::uint64_t interfaceRemoved{ 0u };
+			std::uint64_t enabledStateChanged{ 0u };
+			std::uint64_t connectedStateChanged{ 0u };
+			std::uint64_t aliasChanged{ 0u };
+			std::uint64_t ipAddressInfosChanged{ 0u };
+			std::uint64_t gatewaysChanged{ 0u };
+		};
+
+		struct ObserverStatistics
+		{
+			Observer const* observer{ nullptr }; /** The observer (only used as an identifier) */
+			Histogram callbackDurations{}; /** Duration of each callback of the observer (blocking the helper) */
+			bool isIsolated{ false }; /** The observer exceeded its callback budget and is now notified from its own dispatch thread */
+			std::uint64_t droppedNotificationsCount{ 0u }; /** Number of notifications dropped because the isolated observer didn't keep up */
+		};
+
+		std::uint64_t fullRefreshCount{ 0u }; /** Number of times all interfaces have been queried from the OS */
+		std::uint64_t interfaceRefreshCount{ 0u }; /** Number of times a single interface has been queried from the OS */
+		Histogram refreshDurations{}; /** Duration of each OS query (full or single interface refresh) */
+		Histogram diffDurations{}; /** Duration of each comparison of refreshed interfaces with the previous ones (excluding observers notification) */
+		Histogram lockWaitDurations{}; /** Time spent waiting for the helper lock */
+		Events events{};
+		std::vector<ObserverStatistics> observers{}; /** Currently registered observers */
+	};
 	using EnumerateInterfacesHandler = std::function<void(la::networkInterface::Interface const&)>;
+	using InterfacePredicate = std::function<bool(la::networkInterface::Interface const&)>;
+	using UniquePointer = std::unique_ptr<NetworkInterfaceHelper, void (*)(NetworkInterfaceHelper*)>;
+	using SlowObserverHandler = std::function<void(Observer const* const observer, std::chrono::nanoseconds const callbackDuration)>;
 
+	/** Returns the helper monitoring the network interfaces of the process */
 	static NetworkInterfaceHelper& getInstance() noexcept;
+#if defined(__linux__)
+	/** Creates an independent helper (with its own interfaces and observers) monitoring the network namespace referred by the specified file descriptor, which can be closed after the call. All instances share a single event thread. Throws std::invalid_argument if the namespace cannot be entered. */
+	static UniquePointer createForNetworkNamespace(int const netnsFileDescriptor);
+	/** Creates an independent helper (with its own interfaces and observers) monitoring the network namespace at the specified path (eg. /var/run/netns/name or /proc/pid/ns/net). All instances share a single event thread. Throws std::invalid_argument if the namespace cannot be opened or entered. */
+	static UniquePointer createForNetworkNamespace(std::string const& netnsPath);
+	/** Stops the internal event thread (shared by all instances) so events are only processed by calling processEvents, from the calling thread. Returns a file descriptor that becomes readable when events are pending (to be used with poll, epoll or io_uring), or -1 in case of error. Cannot be reverted. */
+	static int enableExternalEventProcessing() noexcept;
+	/** Processes pending events (observers are notified from the calling thread). Only needed once enableExternalEventProcessing has been called. */
+	static void processEvents() noexcept;
+#endif // __linux__
 
 	/** Converts the specified MAC address to string (in the form: xx:xx:xx:xx:xx:xx, or any chosen separator which can be empty if \0 is given) */
 	static std::string macAddressToString(MacAddress const& macAddress, bool const upperCase = true, char const separator = ':') noexcept;
 	/** Converts the string representation of a MAC address to a MacAddress (from the form: xx:xx:xx:xx:xx:xx or XX:XX:XX:XX:XX:XX, or any chosen separator which can be empty if \0 is given) */
-	static MacAddress stringToMacAddress(std::string const& macAddressAsString, char const separator = ':'); // Throws std::invalid_argument if the string cannot be parsed
+	static MacAddress stringToMacAddress(std::string const& macAddressAsString, char const separator = ':'); // Throws std::invalid_argument if the string is not exactly in that form
 	/** Returns true if specified MAC address is valid */
 	static bool isMacAddressValid(MacAddress const& macAddress) noexcept;
-
+	/** Returns the name of the organization the OUI of the MAC address is assigned to (null-terminated, static storage), or an empty string_view if unknown. Constant time lookup in a table generated at build time (always empty if the library is built without ENABLE_NIH_OUI_DATABASE). */
+	static std::string_view getMacAddressVendor(MacAddress const& macAddress) noexcept;
+	/** Returns true if the library embeds the OUI vendor database (built with ENABLE_NIH_OUI_DATABASE) */
+	static bool isOuiDatabaseAvailable() noexcept;
+	/** Writes the MAC address in the specified notation (exactly getMacAddressCharsLength(notation) characters, not null-terminated) to [first, last), without any allocation. Returns {last, std::errc::value_too_large} if the buffer is too small. */
+	static std::to_chars_result macAddressToChars(char* const first, char* const last, MacAddress const& macAddress, MacAddressNotation const notation = MacAddressNotation::Colon, bool const upperCase = true) noexcept;
+	/** Parses a MAC address strictly in the specified notation (case insensitive) from the beginning of [first, last), without any allocation. Returns the end of the parsed characters, or {first, std::errc::invalid_argument} ('macAddress' being untouched) if not valid. */
+	static std::from_chars_result macAddressFromChars(char const* const first, char const* const last, MacAddress& macAddress, MacAddressNotation const notation) noexcept;
+	/** Parses a MAC address from the beginning of [first, last), detecting its notation (Colon, Dash, CiscoDotted or Bare) */
+	static std::from_chars_result macAddressFromChars(char const* const first, char const* const last, MacAddress& macAddress) noexcept;
+	/** Writes 'count' MAC addresses to [first, last) as fixed-size records (getMacAddressCharsLength(notation) characters followed by 'delimiter', use '\0' for an array of C strings). Returns {last, std::errc::value_too_large} (nothing written) if the buffer is too small. */
+	static std::to_chars_result macAddressesToChars(char* const first, char* const last, MacAddress const* const macAddresses, std::size_t const count, char const delimiter = '\n', MacAddressNotation const notation = MacAddressNotation::Colon, bool const upperCase = true) noexcept;
+	/** Parses up to 'count' fixed-size records (as written by macAddressesToChars, the last delimiter being optional) from [first, last). Returns the number of parsed MAC addresses, stopping at the first invalid record. */
+	static std::size_t macAddressesFromChars(char const* const first, char const* const last, MacAddress* const macAddresses, std::size_t const count, char const delimiter = '\n', MacAddressNotation const notation = MacAddressNotation::Colon) noexcept;
+	/** Writes the IPAddress (dotted-decimal for V4, RFC 5952 for V6, at most IPAddressCharsMaxLength characters, not null-terminated) to [first, last), without any allocation. Returns {first, std::errc::invalid_argument} if the IPAddress is not valid, {last, std::errc::value_too_large} if the buffer is too small. */
+	static std::to_chars_result ipAddressToChars(char* const first, char* const last, IPAddress const& ip) noexcept;
+	/** Parses an IPAddress (dotted-decimal V4, or RFC 4291 V6 text representation) from the beginning of [first, last), without any allocation. Returns the end of the parsed characters, or {first, std::errc::invalid_argument} ('ip' being untouched) if not valid. */
+	static std::from_chars_result ipAddressFromChars(char const* const first, char const* const last, IPAddress& ip) noexcept;
+	/** Writes the IPAddressInfo in CIDR notation (eg. 192.168.1.10/24 or fe80::1/64, at most IPAddressInfoCharsMaxLength characters, not null-terminated) to [first, last), without any allocation. Returns {first, std::errc::invalid_argument} if the IPAddressInfo is not valid, {last, std::errc::value_too_large} if the buffer is too small. */
+	static std::to_chars_result ipAddressInfoToChars(char* const first, char* const last, IPAddressInfo const& ipAddressInfo) noexcept;
+	/** Parses an IPAddressInfo in CIDR notation from the beginning of [first, last), without any allocation. A missing prefix length means a single host (/32 or /128), a V4 prefix length cannot be 0 and a prefix length cannot have leading zeros. Returns the end of the parsed characters, or {first, std::errc::invalid_argument} ('ipAddressInfo' being untouched) if not valid. */
+	static std::from_chars_result ipAddressInfoFromChars(char const* const first, char const* const last, IPAddressInfo& ipAddressInfo) noexcept;
+	/** Writes the IPEndpoint (eg. 192.168.1.10:17221, [2001:db8::1]:17221 or [fe80::1%3]:17221 with a numeric scope id, at most IPEndpointCharsMaxLength characters, not null-terminated) to [first, last), without any allocation. Returns {first, std::errc::invalid_argument} if the IPEndpoint is not valid, {last, std::errc::value_too_large} if the buffer is too small. */
+	static std::to_chars_result ipEndpointToChars(char* const first, char* const last, IPEndpoint const& endpoint) noexcept;
+	/** Formats the specified statistics using the Prometheus text exposition format, each metric name being prefixed with 'metricsPrefix' */
+	static std::string statisticsToPrometheusText(Statistics const& statistics, std::string const& metricsPrefix = "la_nih") noexcept;
+
+	/** Returns the index of the interface with the specified id or alias (an id matching first), from the already enumerated interfaces (no system call), or 0 if not found */
+	std::uint32_t getInterfaceIndex(std::string_view const name) const noexcept;
+	/** Parses an IPEndpoint (a.b.c.d:port, or [V6]:port with an optional %zone, the zone being either a numeric scope id or an interface id or alias resolved with getInterfaceIndex) from the beginning of [first, last), without any allocation. Returns the end of the parsed characters, or {first, std::errc::invalid_argument} ('endpoint' being untouched) if not valid or if the zone cannot be resolved. */
+	std::from_chars_result ipEndpointFromChars(char const* const first, char const* const last, IPEndpoint& endpoint) const noexcept;
 	/** Enumerates network interfaces. The specified handler is called for each found interface */
 	void enumerateInterfaces(EnumerateInterfacesHandler const& onInterface) const noexcept;
 	/** Retrieve a copy of an interface from it's name. Throws std::invalid_argument if no interface exists with that name. */
 	Interface getInterfaceByName(std::string const& name) const;
+	/** Takes an immutable snapshot of all the network interfaces, stored in a single buffer. Returns an empty snapshot in case of error. */
+	InterfacesSnapshot takeSnapshot() const noexcept;
 	/** Registers an observer to monitor changes in network interfaces. NetworkInterfaceObserver::onInterfaceAdded will be called before returning from the call, for all already discovered interfaces. */
 	void registerObserver(Observer* const observer) noexcept;
+	/** Registers an observer to monitor changes in network interfaces passing the specified filter. Interfaces starting (resp. stopping) to pass the filter are notified through onInterfaceAdded (resp. onInterfaceRemoved). */
+	void registerObserver(Observer* const observer, InterfaceFilter const& filter) noexcept;
 	/** Unregisters a previously registered network interfaces change observer */
 	void unregisterObserver(Observer* const observer) noexcept;
+	/** Blocks until an interface matches the predicate (woken up by interface changes) and returns a copy of it, or std::nullopt if the timeout expired. When called from an Observer (or any other context already holding the helper lock), or from the thread calling processEvents in external event processing mode, returns immediately after checking the current interfaces since no change can be applied while waiting. */
+	std::optional<Interface> waitFor(InterfacePredicate const& predicate, std::chrono::milliseconds const timeout) noexcept;
+	/** Blocks until the interface with the specified name passes the conditions (eg. connectedOnly and addressType) and returns a copy of it, or std::nullopt if the timeout expired. Same restrictions as waitFor when called from an Observer or from the thread processing events. */
+	std::optional<Interface> waitForInterface(std::string const& name, InterfaceFilter const& conditions, std::chrono::milliseconds const timeout) noexcept;
+	/** Returns statistics about this helper (refreshes, events, observers and lock contention) */
+	Statistics getStatistics() const noexcept;
+	/** Sets the maximum duration of a single observer callback (0 to disable, default). An observer exceeding its budget is isolated: its following notifications are queued (with copies of the interfaces) and dispatched from its own thread, so it cannot block the helper and the other observers anymore. At most 1024 notifications are queued for an isolated observer, the oldest ones being dropped (see ObserverStatistics::droppedNotificationsCount). The optional handler is called from that thread, once for each isolated observer. */
+	void setObserverCallbackBudget(std::chrono::microseconds const budget, SlowObserverHandler const& onSlowObserver = {}) noexcept;
+	/** Overrides the callback budget of the specified registered observer (0 to disable isolation for that observer). Reset when the observer is unregistered. */
+	void setObserverCallbackBudget(Observer* const observer, std::chrono::microseconds const budget) noexcept;
 
 	// Deleted compiler auto-generated methods
 	NetworkInterfaceHelper(NetworkInterfaceHelper const&) = delete;
@@ -41,6 +41,7 @@
 // Generated wrapper file needs to include our header file (include as soon as possible using 'insert(runtime)' as target language exceptions are defined early in the generated wrapper file)
 %insert(runtime) %{
 	#include <la/networkInterfaceHelper/networkInterfaceHelper.hpp>
+	#include <cstring> // memcpy
 %}
 
 #if defined(SWIGCSHARP)
@@ -68,6 +69,21 @@
 %ignore la::networkInterface::IPAddress::operator value_type_packed_v4; // Ignore value_type_packed_v4 operator (equivalent to getIPV4Packed)
 %ignore la::networkInterface::IPAddress::operator value_type_packed_v6; // Ignore value_type_packed_v6 operator (equivalent to getIPV6Packed)
 %ignore la::networkInterface::IPAddress::CompatibleV6; // Ignore CompatibleV6 (not needed)
+%ignore la::networkInterface::IPAddress::IPAddress(in_addr const&); // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::IPAddress(in6_addr const&, bool const); // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::IPAddress(in6_addr const&); // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::IPAddress(sockaddr_in const&); // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::IPAddress(sockaddr_in6 const&, bool const); // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::IPAddress(sockaddr_in6 const&); // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::IPAddress(sockaddr const&, bool const); // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::IPAddress(sockaddr const&); // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::IPAddress(sockaddr_storage const&, bool const); // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::IPAddress(sockaddr_storage const&); // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::getInAddr; // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::getIn6Addr; // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::getSockaddrIn; // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::getSockaddrIn6; // Not supported (OS socket structures)
+%ignore la::networkInterface::IPAddress::getSockaddrStorage; // Not supported (OS socket structures)
 %ignore la::networkInterface::IPAddress::MappedV6; // Ignore MappedV6 (not needed)
 %ignore la::networkInterface::IPAddress::hash; // Ignore hash (not needed)
 %rename("toString") la::networkInterface::IPAddress::operator std::string;
@@ -78,6 +94,14 @@
 %ignore operator<=(IPAddress const& lhs, IPAddress const& rhs); // Ignored
 %ignore operator+(IPAddress const& lhs, std::uint32_t const value); // Ignored
 %ignore operator-(IPAddress const& lhs, std::uint32_t const value); // Ignored
+%ignore operator+(IPAddress const& lhs, UInt128 const& value); // Ignored
+%ignore operator-(IPAddress const& lhs, UInt128 const& value); // Ignored
+%ignore la::networkInterface::IPAddress::add; // Not supported (UInt128)
+%ignore la::networkInterface::IPAddress::subtract; // Not supported (UInt128)
+%ignore la::networkInterface::IPAddress::addSaturated; // Not supported (UInt128)
+%ignore la::networkInterface::IPAddress::subtractSaturated; // Not supported (UInt128)
+%ignore la::networkInterface::IPAddress::distance; // Not supported (UInt128)
+%ignore la::networkInterface::UInt128; // Not supported
 %ignore operator++(IPAddress& lhs); // Redefined in %extend
 %ignore operator--(IPAddress& lhs); // Redefined in %extend
 %ignore operator&(IPAddress const& lhs, IPAddress const& rhs); // Redefined in %extend
@@ -172,6 +196,126 @@
 %template(Gateways) std::vector<la::networkInterface::IPAddress>;
 %template(MacAddress) std::array<std::uint8_t, 6>;
 
+////////////////////////////////////////
+// InterfaceFilter
+////////////////////////////////////////
+%nspace la::networkInterface::InterfaceFilter;
+
+////////////////////////////////////////
+// InterfacesSnapshot
+////////////////////////////////////////
+%ignore la::networkInterface::InterfacesSnapshot; // Exposed as a raw buffer through NetworkInterfaceHelper::copySnapshot
+%ignore la::networkInterface::NetworkInterfaceHelper::takeSnapshot; // Move-only type, use copySnapshot instead
+#if defined(SWIGCSHARP)
+// Blittable views of the InterfacesSnapshot layout (must match the C++ structures)
+%pragma(csharp) moduleimports=%{
+using System;
+using System.Runtime.InteropServices;
+
+namespace la.networkInterface
+{
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct SnapshotHeader
+	{
+		public uint Version;
+		public uint Size;
+		public uint InterfacesOffset;
+		public uint InterfacesCount;
+	}
+
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct SnapshotStringEntry
+	{
+		public uint Offset;
+		public uint Length;
+	}
+
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct SnapshotIPAddressEntry
+	{
+		public byte Type; // IPAddress.Type value
+		public byte PrefixLength; // Prefix length of the netmask (0 for gateways)
+		public byte B0, B1, B2, B3, B4, B5, B6, B7, B8, B9, B10, B11, B12, B13, B14, B15; // Address in network byte order
+
+		public IPAddress.Type AddressType => (IPAddress.Type)Type;
+
+		public System.Net.IPAddress ToIPAddress()
+		{
+			switch (AddressType)
+			{
+				case IPAddress.Type.V4:
+					return new System.Net.IPAddress(new byte[] { B0, B1, B2, B3 });
+				case IPAddress.Type.V6:
+					return new System.Net.IPAddress(new byte[] { B0, B1, B2, B3, B4, B5, B6, B7, B8, B9, B10, B11, B12, B13, B14, B15 });
+				default:
+					return System.Net.IPAddress.None;
+			}
+		}
+	}
+
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct SnapshotInterfaceEntry
+	{
+		public SnapshotStringEntry Id;
+		public SnapshotStringEntry Description;
+		public SnapshotStringEntry Alias;
+		public uint IPAddressesOffset;
+		public uint IPAddressesCount;
+		public uint GatewaysOffset;
+		public uint GatewaysCount;
+		public byte Mac0, Mac1, Mac2, Mac3, Mac4, Mac5;
+		public byte Type; // Interface.Type value
+		public byte IsEnabled;
+		public byte IsConnected;
+		public byte IsVirtual;
+		private byte _reserved0, _reserved1;
+
+		public Interface.Type InterfaceType => (Interface.Type)Type;
+	}
+
+	/// Read-only view of a snapshot buffer returned by NetworkInterfaceHelper.takeSnapshot (no per-interface native call nor proxy object)
+	public sealed class InterfacesSnapshotView
+	{
+		public const uint SupportedVersion = 1;
+
+		public InterfacesSnapshotView(byte[] buffer, int length)
+		{
+			_buffer = buffer;
+			_length = length;
+			if (length != 0)
+			{
+				_header = MemoryMarshal.Read<SnapshotHeader>(Span);
+				if (_header.Version != SupportedVersion)
+				{
+					throw new NotSupportedException("Unsupported snapshot version " + _header.Version);
+				}
+			}
+		}
+
+		public ReadOnlySpan<byte> Span => new ReadOnlySpan<byte>(_buffer, 0, _length);
+
+		public int Count => (int)_header.InterfacesCount;
+
+		public ReadOnlySpan<SnapshotInterfaceEntry> Interfaces => MemoryMarshal.Cast<byte, SnapshotInterfaceEntry>(Span.Slice((int)_header.InterfacesOffset, Count * Marshal.SizeOf<SnapshotInterfaceEntry>()));
+
+		public ReadOnlySpan<SnapshotIPAddressEntry> GetIPAddresses(in SnapshotInterfaceEntry intfc) => GetIPAddressEntries(intfc.IPAddressesOffset, intfc.IPAddressesCount);
+
+		public ReadOnlySpan<SnapshotIPAddressEntry> GetGateways(in SnapshotInterfaceEntry intfc) => GetIPAddressEntries(intfc.GatewaysOffset, intfc.GatewaysCount);
+
+		public ReadOnlySpan<byte> GetUTF8String(in SnapshotStringEntry str) => Span.Slice((int)str.Offset, (int)str.Length);
+
+		public string GetString(in SnapshotStringEntry str) => System.Text.Encoding.UTF8.GetString(_buffer, (int)str.Offset, (int)str.Length);
+
+		private ReadOnlySpan<SnapshotIPAddressEntry> GetIPAddressEntries(uint offset, uint count) => MemoryMarshal.Cast<byte, SnapshotIPAddressEntry>(Span.Slice((int)offset, (int)count * Marshal.SizeOf<SnapshotIPAddressEntry>()));
+
+		private readonly byte[] _buffer;
+		private readonly int _length;
+		private readonly SnapshotHeader _header;
+	}
+}
+%}
+#endif
+
 // Ignore MacAddressHash
 %ignore la::networkInterface::MacAddressHash;
 
@@ -181,7 +325,83 @@
 %nspace la::networkInterface::NetworkInterfaceHelper;
 %nspace la::networkInterface::NetworkInterfaceHelper::Observer;
 %ignore la::networkInterface::NetworkInterfaceHelper::enumerateInterfaces; // Disable this method, use Observer instead
+%ignore la::networkInterface::NetworkInterfaceHelper::waitFor; // Not supported (std::function, std::optional and std::chrono)
+%ignore la::networkInterface::NetworkInterfaceHelper::waitForInterface; // Not supported (std::optional and std::chrono)
+%ignore la::networkInterface::NetworkInterfaceHelper::Statistics; // Not supported (std::array), exposed as text through getStatisticsAsPrometheusText
+%ignore la::networkInterface::NetworkInterfaceHelper::getStatistics; // Use getStatisticsAsPrometheusText instead
+%ignore la::networkInterface::NetworkInterfaceHelper::statisticsToPrometheusText; // Use getStatisticsAsPrometheusText instead
+%ignore la::networkInterface::NetworkInterfaceHelper::setObserverCallbackBudget; // Not supported (std::chrono and std::function)
+%ignore la::networkInterface::NetworkInterfaceHelper::macAddressToChars; // Not supported (raw buffers), use macAddressToString instead
+%ignore la::networkInterface::NetworkInterfaceHelper::macAddressFromChars; // Not supported (raw buffers), use stringToMacAddress instead
+%ignore la::networkInterface::NetworkInterfaceHelper::macAddressesToChars; // Not supported (raw buffers)
+%ignore la::networkInterface::NetworkInterfaceHelper::macAddressesFromChars; // Not supported (raw buffers)
+%ignore la::networkInterface::NetworkInterfaceHelper::ipAddressToChars; // Not supported (raw buffers)
+%ignore la::networkInterface::NetworkInterfaceHelper::ipAddressFromChars; // Not supported (raw buffers)
+%ignore la::networkInterface::NetworkInterfaceHelper::ipAddressInfoToChars; // Not supported (raw buffers)
+%ignore la::networkInterface::NetworkInterfaceHelper::ipAddressInfoFromChars; // Not supported (raw buffers)
+%ignore la::networkInterface::NetworkInterfaceHelper::ipEndpointToChars; // Not supported (raw buffers)
+%ignore la::networkInterface::NetworkInterfaceHelper::ipEndpointFromChars; // Not supported (raw buffers)
+%ignore la::networkInterface::NetworkInterfaceHelper::getInterfaceIndex; // Not supported (std::string_view), use Interface::index instead
+%ignore la::networkInterface::NetworkInterfaceHelper::getMacAddressVendor; // Not supported (std::string_view), use getMacAddressVendorName instead
+%extend la::networkInterface::NetworkInterfaceHelper
+{
+	/** Returns statistics about this helper, in the Prometheus text exposition format */
+	std::string getStatisticsAsPrometheusText() const noexcept
+	{
+		return la::networkInterface::NetworkInterfaceHelper::statisticsToPrometheusText($self->getStatistics());
+	}
+	/** Returns the name of the organization the OUI of the MAC address is assigned to, or an empty string if unknown */
+	static std::string getMacAddressVendorName(la::networkInterface::MacAddress const& macAddress) noexcept
+	{
+		return std::string{ la::networkInterface::NetworkInterfaceHelper::getMacAddressVendor(macAddress) };
+	}
+};
 %feature("director") la::networkInterface::NetworkInterfaceHelper::Observer;
 %feature("director") la::networkInterface::NetworkInterfaceHelper::DefaultedObserver;
+#if defined(SWIGCSHARP)
+// Bulk export of the interfaces in a single native call (the managed buffer is pinned, not copied, by the marshaller)
+%apply unsigned char OUTPUT[] { unsigned char* buffer };
+%extend la::networkInterface::NetworkInterfaceHelper
+{
+	/** Copies a snapshot of all interfaces (InterfacesSnapshot layout) into 'buffer'. Returns the size of the snapshot (nothing is copied if 'bufferSize' is too small). */
+	std::uint32_t copySnapshot(unsigned char* buffer, std::uint32_t const bufferSize) const noexcept
+	{
+		auto const snapshot = $self->takeSnapshot();
+		if (snapshot.size() != 0 && snapshot.size() <= bufferSize)
+		{
+			std::memcpy(buffer, snapshot.data(), snapshot.size());
+		}
+		return static_cast<std::uint32_t>(snapshot.size());
+	}
+};
+%typemap(cscode) la::networkInterface::NetworkInterfaceHelper
+%{
+	/// Takes a snapshot of all interfaces in a single native call. 'buffer' is reused if large enough (the view is only valid until the buffer is reused).
+	public InterfacesSnapshotView takeSnapshot(ref byte[] buffer)
+	{
+		while (true)
+		{
+			if (buffer == null)
+			{
+				buffer = new byte[4096];
+			}
+			var size = copySnapshot(buffer, (uint)buffer.Length);
+			if (size <= buffer.Length)
+			{
+				return new InterfacesSnapshotView(buffer, (int)size);
+			}
+			// Buffer too small (interfaces may have changed in between, so try again with the returned size)
+			buffer = new byte[size];
+		}
+	}
+
+	/// Takes a snapshot of all interfaces in a single native call.
+	public InterfacesSnapshotView takeSnapshot()
+	{
+		byte[] buffer = null;
+		return takeSnapshot(ref buffer);
+	}
+%}
+#endif
 
 %include "la/networkInterfaceHelper/networkInterfaceHelper.hpp"
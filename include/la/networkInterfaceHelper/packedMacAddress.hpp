@@ -0,0 +1,497 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+* @file packedMacAddress.hpp
+* @author Christophe Calmejane
+* @brief 48-bit MAC address packed in an integer, and sorted flat containers of them.
+*/
+
+#pragma once
+
+#include "networkInterfaceHelper.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <iterator>
+
+namespace la
+{
+namespace networkInterface
+{
+/* ************************************************************ */
+/* PackedMacAddress class declaration                           */
+/* ************************************************************ */
+/** MacAddress packed in the 48 least significant bits of an integer (first byte of the MacAddress being the most significant), so it can be compared, masked and incremented as a number */
+class PackedMacAddress final
+{
+public:
+	using value_type = std::uint64_t;
+
+	static constexpr value_type ValueMask = 0x0000FFFFFFFFFFFFull;
+	static constexpr std::uint8_t BitsCount = 48u;
+
+	/** Default constructor (00:00:00:00:00:00). */
+	constexpr PackedMacAddress() noexcept = default;
+
+	/** Constructor from a packed value (bits above the 48th are ignored). */
+	constexpr explicit PackedMacAddress(value_type const value) noexcept
+		: _value{ value & ValueMask }
+	{
+	}
+
+	/** Constructor from a MacAddress. */
+	constexpr explicit PackedMacAddress(MacAddress const& macAddress) noexcept
+		: _value{ (value_type{ macAddress[0] } << 40) | (value_type{ macAddress[1] } << 32) | (value_type{ macAddress[2] } << 24) | (value_type{ macAddress[3] } << 16) | (value_type{ macAddress[4] } << 8) | value_type{ macAddress[5] } }
+	{
+	}
+
+	/** Returns the packed value. */
+	constexpr value_type getValue() const noexcept
+	{
+		return _value;
+	}
+
+	/** Returns the unpacked MacAddress. */
+	constexpr MacAddress toMacAddress() const noexcept
+	{
+		return MacAddress{ static_cast<std::uint8_t>(_value >> 40), static_cast<std::uint8_t>(_value >> 32), static_cast<std::uint8_t>(_value >> 24), static_cast<std::uint8_t>(_value >> 16), static_cast<std::uint8_t>(_value >> 8), static_cast<std::uint8_t>(_value) };
+	}
+
+	/** Returns true if the address is not 00:00:00:00:00:00 (same as NetworkInterfaceHelper::isMacAddressValid). */
+	constexpr bool isValid() const noexcept
+	{
+		return _value != 0u;
+	}
+
+	/** Returns true if the Individual/Group bit is set (multicast or broadcast address). */
+	constexpr bool isMulticast() const noexcept
+	{
+		return (_value & (value_type{ 0x01 } << 40)) != 0u;
+	}
+
+	/** Returns true if the address is FF:FF:FF:FF:FF:FF. */
+	constexpr bool isBroadcast() const noexcept
+	{
+		return _value == ValueMask;
+	}
+
+	/** Returns true if the Universal/Local bit is set (locally administered address). */
+	constexpr bool isLocallyAdministered() const noexcept
+	{
+		return (_value & (value_type{ 0x02 } << 40)) != 0u;
+	}
+
+	/** Returns the Organizationally Unique Identifier (24 most significant bits). */
+	constexpr std::uint32_t getOUI() const noexcept
+	{
+		return static_cast<std::uint32_t>(_value >> 24);
+	}
+
+	/** Returns a mask of the 'prefixLength' most significant bits (clamped to 48). */
+	static constexpr PackedMacAddress makeMask(std::uint8_t const prefixLength) noexcept
+	{
+		if (prefixLength == 0u)
+		{
+			return PackedMacAddress{};
+		}
+		if (prefixLength >= BitsCount)
+		{
+			return PackedMacAddress{ ValueMask };
+		}
+		return PackedMacAddress{ ValueMask << (BitsCount - prefixLength) };
+	}
+
+	/** Returns true if the 'prefixLength' most significant bits of this address match the ones of 'prefix' (eg. 24 to check an OUI). */
+	constexpr bool matches(PackedMacAddress const prefix, std::uint8_t const prefixLength) const noexcept
+	{
+		auto const mask = makeMask(prefixLength)._value;
+		return (_value & mask) == (prefix._value & mask);
+	}
+
+	/** Returns the first address sharing the 'prefixLength' most significant bits of this address. */
+	constexpr PackedMacAddress getFirstAddress(std::uint8_t const prefixLength) const noexcept
+	{
+		return PackedMacAddress{ _value & makeMask(prefixLength)._value };
+	}
+
+	/** Returns the last address sharing the 'prefixLength' most significant bits of this address. */
+	constexpr PackedMacAddress getLastAddress(std::uint8_t const prefixLength) const noexcept
+	{
+		return PackedMacAddress{ _value | ~makeMask(prefixLength)._value };
+	}
+
+	/** Comparison operators. */
+	friend constexpr bool operator==(PackedMacAddress const lhs, PackedMacAddress const rhs) noexcept
+	{
+		return lhs._value == rhs._value;
+	}
+	friend constexpr bool operator!=(PackedMacAddress const lhs, PackedMacAddress const rhs) noexcept
+	{
+		return lhs._value != rhs._value;
+	}
+	friend constexpr bool operator<(PackedMacAddress const lhs, PackedMacAddress const rhs) noexcept
+	{
+		return lhs._value < rhs._value;
+	}
+	friend constexpr bool operator<=(PackedMacAddress const lhs, PackedMacAddress const rhs) noexcept
+	{
+		return lhs._value <= rhs._value;
+	}
+	friend constexpr bool operator>(PackedMacAddress const lhs, PackedMacAddress const rhs) noexcept
+	{
+		return lhs._value > rhs._value;
+	}
+	friend constexpr bool operator>=(PackedMacAddress const lhs, PackedMacAddress const rhs) noexcept
+	{
+		return lhs._value >= rhs._value;
+	}
+
+	/** Arithmetic operators (modulo 2^48). */
+	friend constexpr PackedMacAddress operator+(PackedMacAddress const lhs, value_type const value) noexcept
+	{
+		return PackedMacAddress{ lhs._value + value };
+	}
+	friend constexpr PackedMacAddress operator-(PackedMacAddress const lhs, value_type const value) noexcept
+	{
+		return PackedMacAddress{ lhs._value - value };
+	}
+	/** Returns the number of addresses from 'rhs' to 'lhs' (modulo 2^48). */
+	friend constexpr value_type operator-(PackedMacAddress const lhs, PackedMacAddress const rhs) noexcept
+	{
+		return (lhs._value - rhs._value) & ValueMask;
+	}
+	friend constexpr PackedMacAddress& operator++(PackedMacAddress& lhs) noexcept
+	{
+		lhs = lhs + 1u;
+		return lhs;
+	}
+	friend constexpr PackedMacAddress& operator--(PackedMacAddress& lhs) noexcept
+	{
+		lhs = lhs - 1u;
+		return lhs;
+	}
+
+	/** Bitwise operators. */
+	friend constexpr PackedMacAddress operator&(PackedMacAddress const lhs, PackedMacAddress const rhs) noexcept
+	{
+		return PackedMacAddress{ lhs._value & rhs._value };
+	}
+	friend constexpr PackedMacAddress operator|(PackedMacAddress const lhs, PackedMacAddress const rhs) noexcept
+	{
+		return PackedMacAddress{ lhs._value | rhs._value };
+	}
+	friend constexpr PackedMacAddress operator^(PackedMacAddress const lhs, PackedMacAddress const rhs) noexcept
+	{
+		return PackedMacAddress{ lhs._value ^ rhs._value };
+	}
+	friend constexpr PackedMacAddress operator~(PackedMacAddress const lhs) noexcept
+	{
+		return PackedMacAddress{ ~lhs._value };
+	}
+
+	/** Hash functor to be used for std::hash */
+	struct hash
+	{
+		std::size_t operator()(PackedMacAddress const mac) const noexcept
+		{
+			// 64-bit mix (murmur3 finalizer), so consecutive addresses spread over buckets
+			auto h = mac._value;
+			h ^= h >> 33;
+			h *= 0xff51afd7ed558ccdull;
+			h ^= h >> 33;
+			return static_cast<std::size_t>(h);
+		}
+	};
+
+private:
+	value_type _value{ 0u };
+};
+
+/* ************************************************************ */
+/* MacAddressFlatSet class declaration                          */
+/* ************************************************************ */
+/** Set of PackedMacAddress stored in a sorted vector: compact, cache friendly, with fast bulk membership and range queries. Single insertions and removals are O(n), prefer bulk insertion. */
+class MacAddressFlatSet final
+{
+public:
+	using value_type = PackedMacAddress;
+	using container_type = std::vector<PackedMacAddress>;
+	using const_iterator = container_type::const_iterator;
+	using Range = std::pair<const_iterator, const_iterator>;
+
+	MacAddressFlatSet() noexcept = default;
+
+	/** Constructor from unsorted addresses (sorted and deduplicated once). */
+	explicit MacAddressFlatSet(container_type addresses);
+
+	/** Inserts an address. Returns false if already present. */
+	bool insert(PackedMacAddress const address);
+
+	/** Inserts a bulk of unsorted addresses (sorted and merged once). */
+	void insert(container_type addresses);
+
+	/** Removes an address. Returns false if not present. */
+	bool erase(PackedMacAddress const address) noexcept;
+
+	/** Returns true if the address is present. */
+	bool contains(PackedMacAddress const address) const noexcept;
+
+	/** Checks the membership of 'count' addresses, writing the result of each one in 'results'. Faster when the addresses are sorted. Returns the number of present addresses. */
+	std::size_t contains(PackedMacAddress const* const addresses, std::size_t const count, bool* const results) const noexcept;
+
+	/** Returns the present addresses within [first, last]. */
+	Range getRange(PackedMacAddress const first, PackedMacAddress const last) const noexcept;
+
+	/** Returns the present addresses sharing the 'prefixLength' most significant bits of 'prefix' (eg. 24 for all addresses of an OUI). */
+	Range getPrefixRange(PackedMacAddress const prefix, std::uint8_t const prefixLength) const noexcept;
+
+	/** Returns the first address of a block of 'count' consecutive addresses within [first, last] that are not present (eg. to allocate addresses), or std::nullopt if there is none. */
+	std::optional<PackedMacAddress> findFreeBlock(PackedMacAddress const first, PackedMacAddress const last, PackedMacAddress::value_type const count) const noexcept;
+
+	const_iterator begin() const noexcept
+	{
+		return _addresses.begin();
+	}
+	const_iterator end() const noexcept
+	{
+		return _addresses.end();
+	}
+	std::size_t size() const noexcept
+	{
+		return _addresses.size();
+	}
+	bool empty() const noexcept
+	{
+		return _addresses.empty();
+	}
+	void clear() noexcept
+	{
+		_addresses.clear();
+	}
+	void reserve(std::size_t const capacity)
+	{
+		_addresses.reserve(capacity);
+	}
+	/** Returns the sorted addresses. */
+	container_type const& getAddresses() const noexcept
+	{
+		return _addresses;
+	}
+
+private:
+	container_type _addresses{};
+};
+
+/* ************************************************************ */
+/* MacAddressFlatMap class declaration                          */
+/* ************************************************************ */
+/** Map from PackedMacAddress to T stored in a sorted vector: compact, cache friendly, with fast lookups and range queries. Single insertions and removals are O(n), prefer bulk insertion. */
+template<typename T>
+class MacAddressFlatMap final
+{
+public:
+	using key_type = PackedMacAddress;
+	using mapped_type = T;
+	using value_type = std::pair<PackedMacAddress, T>;
+	using container_type = std::vector<value_type>;
+	using iterator = typename container_type::iterator;
+	using const_iterator = typename container_type::const_iterator;
+	using Range = std::pair<const_iterator, const_iterator>;
+
+	MacAddressFlatMap() noexcept = default;
+
+	/** Constructor from unsorted entries (sorted once). For duplicated addresses, the first entry is kept. */
+	explicit MacAddressFlatMap(container_type entries)
+		: _entries{ std::move(entries) }
+	{
+		sortAndDeduplicate();
+	}
+
+	/** Inserts an entry, or assigns the value if the address is already present. Returns true if inserted. */
+	bool insertOrAssign(PackedMacAddress const address, T value)
+	{
+		auto const it = lowerBound(address);
+		if (it != _entries.end() && it->first == address)
+		{
+			it->second = std::move(value);
+			return false;
+		}
+		_entries.emplace(it, address, std::move(value));
+		return true;
+	}
+
+	/** Inserts a bulk of unsorted entries (sorted and merged once). Already present addresses are kept. */
+	void insert(container_type entries)
+	{
+		auto const previousSize = _entries.size();
+		_entries.insert(_entries.end(), std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+		// Stable sort of the new entries, then merge (previous ones coming first, so they are kept by deduplication)
+		std::stable_sort(_entries.begin() + previousSize, _entries.end(), compareEntries);
+		std::inplace_merge(_entries.begin(), _entries.begin() + previousSize, _entries.end(), compareEntries);
+		removeDuplicates();
+	}
+
+	/** Removes an entry. Returns false if not present. */
+	bool erase(PackedMacAddress const address) noexcept
+	{
+		auto const it = lowerBound(address);
+		if (it == _entries.end() || it->first != address)
+		{
+			return false;
+		}
+		_entries.erase(it);
+		return true;
+	}
+
+	/** Returns the entry of the address, or end() if not present. */
+	iterator find(PackedMacAddress const address) noexcept
+	{
+		auto const it = lowerBound(address);
+		return (it != _entries.end() && it->first == address) ? it : _entries.end();
+	}
+	const_iterator find(PackedMacAddress const address) const noexcept
+	{
+		auto const it = lowerBound(address);
+		return (it != _entries.end() && it->first == address) ? it : _entries.end();
+	}
+
+	/** Returns true if the address is present. */
+	bool contains(PackedMacAddress const address) const noexcept
+	{
+		return find(address) != _entries.end();
+	}
+
+	/** Returns the entries within [first, last]. */
+	Range getRange(PackedMacAddress const first, PackedMacAddress const last) const noexcept
+	{
+		if (last < first)
+		{
+			return { _entries.end(), _entries.end() };
+		}
+		auto const begin = lowerBound(first);
+		auto const end = std::upper_bound(begin, _entries.cend(), last,
+			[](PackedMacAddress const address, value_type const& entry)
+			{
+				return address < entry.first;
+			});
+		return { begin, end };
+	}
+
+	/** Returns the entries sharing the 'prefixLength' most significant bits of 'prefix' (eg. 24 for all addresses of an OUI). */
+	Range getPrefixRange(PackedMacAddress const prefix, std::uint8_t const prefixLength) const noexcept
+	{
+		return getRange(prefix.getFirstAddress(prefixLength), prefix.getLastAddress(prefixLength));
+	}
+
+	iterator begin() noexcept
+	{
+		return _entries.begin();
+	}
+	iterator end() noexcept
+	{
+		return _entries.end();
+	}
+	const_iterator begin() const noexcept
+	{
+		return _entries.begin();
+	}
+	const_iterator end() const noexcept
+	{
+		return _entries.end();
+	}
+	std::size_t size() const noexcept
+	{
+		return _entries.size();
+	}
+	bool empty() const noexcept
+	{
+		return _entries.empty();
+	}
+	void clear() noexcept
+	{
+		_entries.clear();
+	}
+	void reserve(std::size_t const capacity)
+	{
+		_entries.reserve(capacity);
+	}
+
+private:
+	static bool compareEntries(value_type const& lhs, value_type const& rhs) noexcept
+	{
+		return lhs.first < rhs.first;
+	}
+
+	iterator lowerBound(PackedMacAddress const address) noexcept
+	{
+		return std::lower_bound(_entries.begin(), _entries.end(), address,
+			[](value_type const& entry, PackedMacAddress const value)
+			{
+				return entry.first < value;
+			});
+	}
+	const_iterator lowerBound(PackedMacAddress const address) const noexcept
+	{
+		return std::lower_bound(_entries.cbegin(), _entries.cend(), address,
+			[](value_type const& entry, PackedMacAddress const value)
+			{
+				return entry.first < value;
+			});
+	}
+
+	void sortAndDeduplicate()
+	{
+		std::stable_sort(_entries.begin(), _entries.end(), compareEntries);
+		removeDuplicates();
+	}
+
+	void removeDuplicates()
+	{
+		_entries.erase(std::unique(_entries.begin(), _entries.end(),
+										 [](value_type const& lhs, value_type const& rhs)
+										 {
+											 return lhs.first == rhs.first;
+										 }),
+			_entries.end());
+	}
+
+	container_type _entries{};
+};
+
+} // namespace networkInterface
+} // namespace la
@@ -0,0 +1,125 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+* @file tracing.hpp
+* @author Christophe Calmejane
+* @brief Trace points around enumeration, refresh, diff and observer callbacks (only emitted when the library is built with ENABLE_NIH_TRACING).
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <memory>
+
+namespace la
+{
+namespace networkInterface
+{
+namespace tracing
+{
+enum class Category : std::uint8_t
+{
+	Enumeration = 0, /**< Waiting for the first enumeration of the interfaces */
+	Refresh = 1, /**< OS query of all the interfaces, or a single one */
+	Diff = 2, /**< Comparison of refreshed interfaces with the previous ones (excluding observers notification) */
+	ObserverCallback = 3, /**< Single observer callback */
+};
+
+/** A completed span of time */
+struct Event
+{
+	char const* name{ nullptr }; /**< Always points to a string literal */
+	Category category{ Category::Enumeration }; /**< Kind of span */
+	std::uint64_t startTime{ 0u }; /**< Steady clock time, in nanoseconds */
+	std::uint64_t duration{ 0u }; /**< In nanoseconds */
+	std::uint64_t threadID{ 0u }; /**< Sequential ID assigned to each thread emitting events (starting at 1) */
+	void const* context{ nullptr }; /**< The helper for most categories, the observer for ObserverCallback */
+};
+
+/** Receives trace events. Called from any thread (including while the helper lock is held) so must be thread-safe and fast. */
+class Sink
+{
+public:
+	virtual ~Sink() noexcept = default;
+
+	virtual void onEvent(Event const& event) noexcept = 0;
+};
+
+/** Lock-free sink keeping the last 'capacity' events (rounded up to a power of 2, older ones being overwritten). An event is dropped if its slot is still being written by another thread when wrapping around. */
+class RingBufferSink final : public Sink
+{
+public:
+	explicit RingBufferSink(std::size_t const capacity = 4096u);
+	virtual ~RingBufferSink() noexcept override;
+
+	virtual void onEvent(Event const& event) noexcept override;
+
+	/** Returns the recorded events (oldest first), skipping the ones being written during the call */
+	std::vector<Event> getEvents() const noexcept;
+	/** Discards all recorded events */
+	void clear() noexcept;
+	/** Returns the recorded events in the Chrome trace event JSON format (can be loaded in chrome://tracing or ui.perfetto.dev) */
+	std::string toChromeTraceJson() const noexcept;
+
+	// Deleted compiler auto-generated methods
+	RingBufferSink(RingBufferSink const&) = delete;
+	RingBufferSink(RingBufferSink&&) = delete;
+	RingBufferSink& operator=(RingBufferSink const&) = delete;
+	RingBufferSink& operator=(RingBufferSink&&) = delete;
+
+private:
+	struct Slot;
+
+	std::size_t const _capacity{ 0u };
+	std::unique_ptr<Slot[]> _slots{};
+	std::atomic<std::uint64_t> _writeIndex{ 0u };
+	std::atomic<std::uint64_t> _firstIndex{ 0u };
+};
+
+/** Returns true if the library has been built with trace points (ENABLE_NIH_TRACING CMake option), otherwise no event is ever emitted */
+bool isCompiledIn() noexcept;
+/** Returns the default sink, a RingBufferSink keeping the last 4096 events */
+RingBufferSink& getDefaultSink() noexcept;
+/** Sets the sink receiving all trace events (nullptr to disable tracing at runtime). The sink must outlive its use, the previous one might still receive events emitted concurrently with the call. */
+void setSink(Sink* const sink) noexcept;
+/** Formats the specified events in the Chrome trace event JSON format */
+std::string eventsToChromeTraceJson(std::vector<Event> const& events) noexcept;
+
+} // namespace tracing
+} // namespace networkInterface
+} // namespace la
@@ -42,11 +42,289 @@
 
 #include <cstdlib>
 #include <cstring> // memcpy
+#include <cstddef> // offsetof
+#include <algorithm> // min
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <stdexcept>
 
 #ifdef _WIN32
 #	define strdup _strdup
+#else // !_WIN32
+#	include <unistd.h>
+#	include <fcntl.h>
 #endif // _WIN32
 
+// Snapshot IP addresses are directly returned as nih_ip_address_t
+static_assert(sizeof(nih_ip_address_t) == sizeof(la::networkInterface::InterfacesSnapshot::IPAddressEntry), "nih_ip_address_t must match IPAddressEntry");
+static_assert(offsetof(nih_ip_address_t, family) == offsetof(la::networkInterface::InterfacesSnapshot::IPAddressEntry, type), "nih_ip_address_t must match IPAddressEntry");
+static_assert(offsetof(nih_ip_address_t, prefix_length) == offsetof(la::networkInterface::InterfacesSnapshot::IPAddressEntry, prefixLength), "nih_ip_address_t must match IPAddressEntry");
+static_assert(offsetof(nih_ip_address_t, bytes) == offsetof(la::networkInterface::InterfacesSnapshot::IPAddressEntry, bytes), "nih_ip_address_t must match IPAddressEntry");
+static_assert(static_cast<int>(nih_ip_address_family_V4) == static_cast<int>(la::networkInterface::IPAddress::Type::V4) && static_cast<int>(nih_ip_address_family_V6) == static_cast<int>(la::networkInterface::IPAddress::Type::V6), "nih_ip_address_family_t must match IPAddress::Type");
+
+struct nih_snapshot_s
+{
+	la::networkInterface::InterfacesSnapshot snapshot{};
+};
+
+struct nih_monitor_s final : public la::networkInterface::NetworkInterfaceHelper::Observer
+{
+	struct Event
+	{
+		nih_event_kind_t kind{ nih_event_kind_InterfaceAdded };
+		la::networkInterface::Interface intfc{};
+	};
+	using Events = std::vector<Event>;
+
+	static constexpr size_t MaxPendingEvents = 1024u;
+
+	nih_monitor_s(nih_monitor_events_cb const onEvents, void* const userData, bool const isPollable)
+		: _onEvents{ onEvents }
+		, _userData{ userData }
+		, _isPollable{ isPollable }
+	{
+#ifndef _WIN32
+		if (_isPollable)
+		{
+			int fds[2];
+			if (::pipe(fds) != 0)
+			{
+				throw std::runtime_error("Failed to create pipe");
+			}
+			for (auto const fd : fds)
+			{
+				::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+				::fcntl(fd, F_SETFD, FD_CLOEXEC);
+			}
+			_readFileDescriptor = fds[0];
+			_writeFileDescriptor = fds[1];
+		}
+#endif // !_WIN32
+	}
+
+	~nih_monitor_s() noexcept
+	{
+		// Unregister now (before our members are destroyed), this also waits for a running notification to complete
+		la::networkInterface::NetworkInterfaceHelper::getInstance().unregisterObserver(this);
+
+#ifndef _WIN32
+		if (_readFileDescriptor != -1)
+		{
+			::close(_readFileDescriptor);
+			::close(_writeFileDescriptor);
+		}
+#endif // !_WIN32
+	}
+
+	int getFileDescriptor() const noexcept
+	{
+		return _readFileDescriptor;
+	}
+
+	size_t processEvents() noexcept
+	{
+		return deliverPendingEvents(_completedEvents);
+	}
+
+	size_t getDroppedEventsCount() const noexcept
+	{
+		// Lock
+		auto const lg = std::lock_guard(_lock);
+
+		return _droppedEventsCount;
+	}
+
+	// Deleted compiler auto-generated methods
+	nih_monitor_s(nih_monitor_s const&) = delete;
+	nih_monitor_s(nih_monitor_s&&) = delete;
+	nih_monitor_s& operator=(nih_monitor_s const&) = delete;
+	nih_monitor_s& operator=(nih_monitor_s&&) = delete;
+
+private:
+	struct DeliveryBuffers
+	{
+		Events events{};
+		std::vector<la::networkInterface::Interface const*> interfaces{};
+		std::vector<nih_event_t> podEvents{};
+		nih_snapshot_s snapshot{};
+	};
+
+	/** Delivers the specified pending events (protected by _lock), reusing the buffers of the previous delivery. Returns the number of delivered events. */
+	size_t deliverPendingEvents(Events& pendingEvents) noexcept
+	{
+		// Reuse the buffers, unless already delivering (from another thread, or from the callback itself)
+		auto const isReusingBuffers = !_isDelivering.exchange(true);
+		auto localBuffers = DeliveryBuffers{};
+		auto& buffers = isReusingBuffers ? _deliveryBuffers : localBuffers;
+		{
+			// Lock
+			auto const lg = std::lock_guard(_lock);
+
+			// Swap so both vectors keep their capacity
+			buffers.events.swap(pendingEvents);
+
+#ifndef _WIN32
+			// Drain the pipe
+			if (_isSignaled)
+			{
+				char buffer[16];
+				while (::read(_readFileDescriptor, buffer, sizeof(buffer)) > 0)
+				{
+				}
+				_isSignaled = false;
+			}
+#endif // !_WIN32
+		}
+
+		// Deliver outside the lock
+		deliver(buffers);
+
+		auto const count = buffers.events.size();
+		buffers.events.clear();
+		if (isReusingBuffers)
+		{
+			_isDelivering = false;
+		}
+		return count;
+	}
+
+	void deliver(DeliveryBuffers& buffers) const noexcept
+	{
+		if (buffers.events.empty())
+		{
+			return;
+		}
+
+		try
+		{
+			// Build a snapshot of the interfaces (one per event, as it was right after the change) and the POD events
+			buffers.interfaces.clear();
+			buffers.podEvents.clear();
+			for (auto const& event : buffers.events)
+			{
+				buffers.podEvents.push_back(nih_event_t{ event.kind, buffers.interfaces.size() });
+				buffers.interfaces.push_back(&event.intfc);
+			}
+			la::networkInterface::InterfacesSnapshot::build(buffers.interfaces, buffers.snapshot.snapshot);
+
+			_onEvents(_userData, buffers.podEvents.data(), buffers.podEvents.size(), &buffers.snapshot);
+		}
+		catch (...)
+		{
+			// Ignore exceptions
+		}
+	}
+
+	void pushEvent(nih_event_kind_t const kind, la::networkInterface::Interface const& intfc) noexcept
+	{
+		try
+		{
+			// Lock
+			auto const lg = std::lock_guard(_lock);
+
+			_currentEvents.push_back(Event{ kind, intfc });
+		}
+		catch (...)
+		{
+			// Ignore exceptions
+		}
+	}
+
+	// la::networkInterface::NetworkInterfaceHelper::Observer overrides
+	virtual void onInterfaceAdded(la::networkInterface::Interface const& intfc) noexcept override
+	{
+		pushEvent(nih_event_kind_InterfaceAdded, intfc);
+	}
+	virtual void onInterfaceRemoved(la::networkInterface::Interface const& intfc) noexcept override
+	{
+		pushEvent(nih_event_kind_InterfaceRemoved, intfc);
+	}
+	virtual void onInterfaceEnabledStateChanged(la::networkInterface::Interface const& intfc, bool const /*isEnabled*/) noexcept override
+	{
+		pushEvent(nih_event_kind_EnabledStateChanged, intfc);
+	}
+	virtual void onInterfaceConnectedStateChanged(la::networkInterface::Interface const& intfc, bool const /*isConnected*/) noexcept override
+	{
+		pushEvent(nih_event_kind_ConnectedStateChanged, intfc);
+	}
+	virtual void onInterfaceAliasChanged(la::networkInterface::Interface const& intfc, std::string const& /*alias*/) noexcept override
+	{
+		pushEvent(nih_event_kind_AliasChanged, intfc);
+	}
+	virtual void onInterfaceIPAddressInfosChanged(la::networkInterface::Interface const& intfc, la::networkInterface::Interface::IPAddressInfos const& /*ipAddressInfos*/) noexcept override
+	{
+		pushEvent(nih_event_kind_IPAddressesChanged, intfc);
+	}
+	virtual void onInterfaceGateWaysChanged(la::networkInterface::Interface const& intfc, la::networkInterface::Interface::Gateways const& /*gateways*/) noexcept override
+	{
+		pushEvent(nih_event_kind_GatewaysChanged, intfc);
+	}
+	virtual void onChangesCompleted() noexcept override
+	{
+		if (!_isPollable)
+		{
+			deliverPendingEvents(_currentEvents);
+			return;
+		}
+
+		// Lock
+		auto const lg = std::lock_guard(_lock);
+
+		if (_currentEvents.empty())
+		{
+			return;
+		}
+
+		// Move the batch to the completed events, they will be delivered during the next call to processEvents
+		try
+		{
+			_completedEvents.reserve(_completedEvents.size() + _currentEvents.size());
+			for (auto& event : _currentEvents)
+			{
+				_completedEvents.push_back(std::move(event));
+			}
+		}
+		catch (...)
+		{
+			// Ignore exceptions
+		}
+		_currentEvents.clear();
+
+		// Drop the oldest events if the poller doesn't keep up
+		if (_completedEvents.size() > MaxPendingEvents)
+		{
+			auto const droppedCount = _completedEvents.size() - MaxPendingEvents;
+			_completedEvents.erase(_completedEvents.begin(), _completedEvents.begin() + static_cast<Events::difference_type>(droppedCount));
+			_droppedEventsCount += droppedCount;
+		}
+
+#ifndef _WIN32
+		// Wake up the poller
+		if (!_isSignaled)
+		{
+			auto const c = char{ 1 };
+			_isSignaled = ::write(_writeFileDescriptor, &c, 1) == 1;
+		}
+#endif // !_WIN32
+	}
+
+	// Private members
+	nih_monitor_events_cb _onEvents{ nullptr };
+	void* _userData{ nullptr };
+	bool _isPollable{ false };
+	int _readFileDescriptor{ -1 };
+	int _writeFileDescriptor{ -1 };
+	mutable std::mutex _lock{};
+	Events _currentEvents{}; // Events of the batch being notified
+	Events _completedEvents{}; // Completed batches waiting for processEvents (pollable only, at most MaxPendingEvents)
+	size_t _droppedEventsCount{ 0u }; // Events dropped from _completedEvents since the creation of the monitor
+	bool _isSignaled{ false };
+	std::atomic_bool _isDelivering{ false }; // True while _deliveryBuffers are used
+	DeliveryBuffers _deliveryBuffers{};
+};
+
 
 static void set_macAddress(la::networkInterface::MacAddress const& source, nih_mac_address_t& macAddress) noexcept
 {
@@ -62,6 +340,35 @@ static la::networkInterface::MacAddress make_macAddress(nih_mac_address_cp const
 	return adrs;
 }
 
+static void set_ipAddress(la::networkInterface::InterfacesSnapshot::IPAddressEntry const& source, nih_ip_address_t& address) noexcept
+{
+	std::memcpy(&address, &source, sizeof(address));
+}
+
+static la::networkInterface::IPAddress make_ipAddress(nih_ip_address_t const& address)
+{
+	switch (address.family)
+	{
+		case nih_ip_address_family_V4:
+		{
+			auto ip = la::networkInterface::IPAddress::value_type_v4{};
+			std::memcpy(ip.data(), address.bytes, ip.size());
+			return la::networkInterface::IPAddress{ ip };
+		}
+		case nih_ip_address_family_V6:
+		{
+			auto ip = la::networkInterface::IPAddress::value_type_v6{};
+			for (auto i = 0u; i < ip.size(); ++i)
+			{
+				ip[i] = static_cast<std::uint16_t>((address.bytes[i * 2] << 8) | address.bytes[i * 2 + 1]);
+			}
+			return la::networkInterface::IPAddress{ ip };
+		}
+		default:
+			return la::networkInterface::IPAddress{};
+	}
+}
+
 static nih_network_interface_p make_nih_network_interface(la::networkInterface::Interface const& intfc) noexcept
 {
 	auto ifc = new nih_network_interface_t();
@@ -102,6 +409,32 @@ static nih_network_interface_p make_nih_network_interface(la::networkInterface::
 	ifc->is_enabled = static_cast<nih_bool_t>(intfc.isEnabled);
 	ifc->is_connected = static_cast<nih_bool_t>(intfc.isConnected);
 	ifc->is_virtual = static_cast<nih_bool_t>(intfc.isVirtual);
+	ifc->ip_address_infos_count = intfc.ipAddressInfos.size();
+	if (intfc.ipAddressInfos.empty())
+	{
+		ifc->ip_address_infos = nullptr;
+	}
+	else
+	{
+		ifc->ip_address_infos = new nih_ip_address_t[ifc->ip_address_infos_count];
+		for (auto i = 0u; i < ifc->ip_address_infos_count; ++i)
+		{
+			set_ipAddress(la::networkInterface::InterfacesSnapshot::makeIPAddressEntry(intfc.ipAddressInfos[i]), ifc->ip_address_infos[i]);
+		}
+	}
+	ifc->gateway_addresses_count = intfc.gateways.size();
+	if (intfc.gateways.empty())
+	{
+		ifc->gateway_addresses = nullptr;
+	}
+	else
+	{
+		ifc->gateway_addresses = new nih_ip_address_t[ifc->gateway_addresses_count];
+		for (auto i = 0u; i < ifc->gateway_addresses_count; ++i)
+		{
+			set_ipAddress(la::networkInterface::InterfacesSnapshot::makeIPAddressEntry(intfc.gateways[i], 0u), ifc->gateway_addresses[i]);
+		}
+	}
 
 	return ifc;
 }
@@ -133,6 +466,8 @@ static void delete_nih_network_interface(nih_network_interface_p ifc) noexcept
 		}
 		delete[] ifc->gateways;
 	}
+	delete[] ifc->ip_address_infos;
+	delete[] ifc->gateway_addresses;
 
 	delete ifc;
 }
@@ -169,7 +504,206 @@ LA_NIH_BINDINGS_C_API nih_bool_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_isMacA
 	return static_cast<nih_bool_t>(la::networkInterface::NetworkInterfaceHelper::isMacAddressValid(make_macAddress(macAddress)));
 }
 
+LA_NIH_BINDINGS_C_API nih_const_string_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_getMacAddressVendor(nih_mac_address_cp const macAddress)
+{
+	auto const vendor = la::networkInterface::NetworkInterfaceHelper::getMacAddressVendor(make_macAddress(macAddress));
+	// Vendor names are null-terminated static strings
+	return vendor.empty() ? nullptr : vendor.data();
+}
+
+LA_NIH_BINDINGS_C_API nih_string_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_ipAddressToString(nih_ip_address_cp const address, nih_bool_t const withPrefixLength)
+{
+	if (address == nullptr)
+	{
+		return nullptr;
+	}
+
+	try
+	{
+		auto const ip = make_ipAddress(*address);
+		if (!ip)
+		{
+			return nullptr;
+		}
+		auto str = static_cast<std::string>(ip);
+		if (withPrefixLength)
+		{
+			str += "/" + std::to_string(address->prefix_length);
+		}
+		return strdup(str.c_str());
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+
+LA_NIH_BINDINGS_C_API nih_bool_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_isIPAddressInSubnet(nih_ip_address_cp const subnet, nih_ip_address_cp const address)
+{
+	if (subnet == nullptr || address == nullptr || subnet->family != address->family)
+	{
+		return nih_bool_false;
+	}
+
+	auto maxPrefixLength = 0u;
+	switch (subnet->family)
+	{
+		case nih_ip_address_family_V4:
+			maxPrefixLength = 32u;
+			break;
+		case nih_ip_address_family_V6:
+			maxPrefixLength = 128u;
+			break;
+		default:
+			return nih_bool_false;
+	}
+
+	// Compare full bytes, then remaining bits
+	auto const prefixLength = std::min(static_cast<unsigned int>(subnet->prefix_length), maxPrefixLength);
+	auto const fullBytes = prefixLength / 8u;
+	if (std::memcmp(subnet->bytes, address->bytes, fullBytes) != 0)
+	{
+		return nih_bool_false;
+	}
+	if (auto const remainingBits = prefixLength % 8u; remainingBits != 0u)
+	{
+		auto const mask = static_cast<unsigned char>(0xFF << (8u - remainingBits));
+		if ((subnet->bytes[fullBytes] & mask) != (address->bytes[fullBytes] & mask))
+		{
+			return nih_bool_false;
+		}
+	}
+	return nih_bool_true;
+}
+
+LA_NIH_BINDINGS_C_API void LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_freeString(nih_string_t str)
+{
+	std::free(str);
+}
+
 LA_NIH_BINDINGS_C_API void LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_freeNetworkInterface(nih_network_interface_p intfc)
 {
 	delete_nih_network_interface(intfc);
 }
+
+static nih_string_view_t make_nih_string_view(std::string_view const& str) noexcept
+{
+	return nih_string_view_t{ str.data(), str.size() };
+}
+
+LA_NIH_BINDINGS_C_API nih_snapshot_p LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_takeSnapshot(void)
+{
+	try
+	{
+		auto snapshot = la::networkInterface::NetworkInterfaceHelper::getInstance().takeSnapshot();
+		if (snapshot.data() == nullptr)
+		{
+			return nullptr;
+		}
+		return new nih_snapshot_s{ std::move(snapshot) };
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+
+LA_NIH_BINDINGS_C_API size_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_getSnapshotInterfacesCount(nih_snapshot_cp const snapshot)
+{
+	if (snapshot == nullptr)
+	{
+		return 0u;
+	}
+	return snapshot->snapshot.getInterfacesCount();
+}
+
+LA_NIH_BINDINGS_C_API nih_bool_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_getSnapshotInterface(nih_snapshot_cp const snapshot, size_t const index, nih_snapshot_interface_p const intfc)
+{
+	if (snapshot == nullptr || intfc == nullptr || index >= snapshot->snapshot.getInterfacesCount())
+	{
+		return nih_bool_false;
+	}
+
+	auto const& s = snapshot->snapshot;
+	auto const& entry = s.getInterface(index);
+	intfc->id = make_nih_string_view(s.getString(entry.id));
+	intfc->description = make_nih_string_view(s.getString(entry.description));
+	intfc->alias = make_nih_string_view(s.getString(entry.alias));
+	set_macAddress(entry.macAddress, intfc->mac_address);
+	intfc->ip_addresses = reinterpret_cast<nih_ip_address_cp>(s.getIPAddresses(entry));
+	intfc->ip_addresses_count = entry.ipAddressesCount;
+	intfc->gateways = reinterpret_cast<nih_ip_address_cp>(s.getGateways(entry));
+	intfc->gateways_count = entry.gatewaysCount;
+	intfc->type = static_cast<nih_network_interface_type_t>(entry.type);
+	intfc->is_enabled = static_cast<nih_bool_t>(entry.isEnabled);
+	intfc->is_connected = static_cast<nih_bool_t>(entry.isConnected);
+	intfc->is_virtual = static_cast<nih_bool_t>(entry.isVirtual);
+
+	return nih_bool_true;
+}
+
+LA_NIH_BINDINGS_C_API void LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_freeSnapshot(nih_snapshot_p snapshot)
+{
+	delete snapshot;
+}
+
+static nih_monitor_p create_nih_monitor(nih_monitor_events_cb const onEvents, void* const user_data, bool const isPollable) noexcept
+{
+	if (onEvents == nullptr)
+	{
+		return nullptr;
+	}
+
+	try
+	{
+		auto* monitor = new nih_monitor_s{ onEvents, user_data, isPollable };
+		la::networkInterface::NetworkInterfaceHelper::getInstance().registerObserver(monitor);
+		return monitor;
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+
+LA_NIH_BINDINGS_C_API nih_monitor_p LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_createMonitor(nih_monitor_events_cb const onEvents, void* const user_data)
+{
+	return create_nih_monitor(onEvents, user_data, false);
+}
+
+LA_NIH_BINDINGS_C_API nih_monitor_p LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_createPollableMonitor(nih_monitor_events_cb const onEvents, void* const user_data)
+{
+	return create_nih_monitor(onEvents, user_data, true);
+}
+
+LA_NIH_BINDINGS_C_API int LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_getMonitorFileDescriptor(nih_monitor_cp const monitor)
+{
+	if (monitor == nullptr)
+	{
+		return -1;
+	}
+	return monitor->getFileDescriptor();
+}
+
+LA_NIH_BINDINGS_C_API size_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_processMonitorEvents(nih_monitor_p const monitor)
+{
+	if (monitor == nullptr)
+	{
+		return 0u;
+	}
+	return monitor->processEvents();
+}
+
+LA_NIH_BINDINGS_C_API size_t LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_getMonitorDroppedEventsCount(nih_monitor_cp const monitor)
+{
+	if (monitor == nullptr)
+	{
+		return 0u;
+	}
+	return monitor->getDroppedEventsCount();
+}
+
+LA_NIH_BINDINGS_C_API void LA_NIH_BINDINGS_C_CALL_CONVENTION LA_NIH_destroyMonitor(nih_monitor_p monitor)
+{
+	delete monitor;
+}
@@ -0,0 +1,133 @@
+# Generates the OUI vendor database header from an IEEE MA-L CSV file (https://standards-oui.ieee.org/oui/oui.csv)
+# Usage: cmake -DINPUT_FILE=<oui.csv> -DOUTPUT_FILE=<ouiDatabase.hpp> -P generateOuiDatabase.cmake
+#
+# Entries are stored in buckets (indexed by a multiplicative hash of the OUI, 1 or 2 entries per bucket) so the lookup is done in constant time.
+# Vendor names are deduplicated (a single organization can own hundreds of OUIs).
+
+cmake_minimum_required(VERSION 3.22)
+
+if(NOT INPUT_FILE OR NOT OUTPUT_FILE)
+	message(FATAL_ERROR "Usage: cmake -DINPUT_FILE=<oui.csv> -DOUTPUT_FILE=<ouiDatabase.hpp> -P generateOuiDatabase.cmake")
+endif()
+
+# Fibonacci hashing (32-bit), must match hashOui in ouiDatabase.cpp
+set(HASH_MULTIPLIER 2654435761)
+
+# Read the file and protect list special characters (restored when writing vendor names)
+file(READ "${INPUT_FILE}" _content)
+string(ASCII 29 _semicolonMarker)
+string(ASCII 30 _openBracketMarker)
+string(ASCII 31 _closeBracketMarker)
+string(REPLACE ";" "${_semicolonMarker}" _content "${_content}")
+string(REPLACE "[" "${_openBracketMarker}" _content "${_content}")
+string(REPLACE "]" "${_closeBracketMarker}" _content "${_content}")
+string(REPLACE "\r" "" _content "${_content}")
+string(REPLACE "\n" ";" _lines "${_content}")
+
+# Parse MA-L entries, deduplicating vendor names
+set(_entries "")
+set(_vendorNames "")
+set(_vendorsCount 0)
+foreach(_line IN LISTS _lines)
+	if(NOT _line MATCHES "^MA-L,([0-9A-Fa-f][0-9A-Fa-f][0-9A-Fa-f][0-9A-Fa-f][0-9A-Fa-f][0-9A-Fa-f]),(.*)$")
+		continue()
+	endif()
+	string(TOUPPER "${CMAKE_MATCH_1}" _oui)
+	set(_remaining "${CMAKE_MATCH_2}")
+	if(_remaining MATCHES "^\"(([^\"]|\"\")*)\"")
+		string(REPLACE "\"\"" "\"" _name "${CMAKE_MATCH_1}")
+	elseif(_remaining MATCHES "^([^,]*)")
+		set(_name "${CMAKE_MATCH_1}")
+	endif()
+	string(STRIP "${_name}" _name)
+
+	string(MD5 _nameKey "${_name}")
+	if(NOT DEFINED _vendorIndex_${_nameKey})
+		set(_vendorIndex_${_nameKey} ${_vendorsCount})
+		math(EXPR _vendorsCount "${_vendorsCount} + 1")
+		# Escape for a C string literal, then restore protected characters
+		string(REPLACE "\\" "\\\\" _name "${_name}")
+		string(REPLACE "\"" "\\\"" _name "${_name}")
+		string(REPLACE "${_openBracketMarker}" "[" _name "${_name}")
+		string(REPLACE "${_closeBracketMarker}" "]" _name "${_name}")
+		string(APPEND _vendorNames "\t\"${_name}\",\n")
+	endif()
+	list(APPEND _entries "${_oui}:${_vendorIndex_${_nameKey}}")
+endforeach()
+string(REPLACE "${_semicolonMarker}" ";" _vendorNames "${_vendorNames}")
+
+list(LENGTH _entries _entriesCount)
+if(_entriesCount EQUAL 0)
+	message(FATAL_ERROR "No MA-L entry found in ${INPUT_FILE}")
+endif()
+if(_vendorsCount GREATER 65535)
+	message(FATAL_ERROR "Too many vendors in ${INPUT_FILE} (${_vendorsCount}), vendor indexes are stored on 16 bits")
+endif()
+
+# Use half as many buckets as entries (rounded up to a power of 2)
+set(_bucketBits 1)
+math(EXPR _bucketsCount "1 << ${_bucketBits}")
+while(_bucketsCount LESS _entriesCount)
+	math(EXPR _bucketBits "${_bucketBits} + 1")
+	math(EXPR _bucketsCount "1 << ${_bucketBits}")
+endwhile()
+if(_bucketBits GREATER 1)
+	math(EXPR _bucketBits "${_bucketBits} - 1")
+	math(EXPR _bucketsCount "1 << ${_bucketBits}")
+endif()
+
+# Prefix each entry with its (zero-padded) bucket so sorting groups them
+set(_sortableEntries "")
+foreach(_entry IN LISTS _entries)
+	string(SUBSTRING "${_entry}" 0 6 _oui)
+	math(EXPR _bucket "((0x${_oui} * ${HASH_MULTIPLIER}) & 0xFFFFFFFF) >> (32 - ${_bucketBits})")
+	string(LENGTH "${_bucket}" _length)
+	math(EXPR _padding "8 - ${_length}")
+	string(REPEAT "0" ${_padding} _zeros)
+	list(APPEND _sortableEntries "${_zeros}${_bucket}:${_entry}")
+endforeach()
+list(SORT _sortableEntries)
+
+# Generate the tables
+set(_ouis "")
+set(_vendorIndexes "")
+set(_bucketStarts "")
+set(_currentBucket 0)
+set(_index 0)
+foreach(_entry IN LISTS _sortableEntries)
+	string(REPLACE ":" ";" _fields "${_entry}")
+	list(GET _fields 0 _bucket)
+	list(GET _fields 1 _oui)
+	list(GET _fields 2 _vendorIndex)
+	math(EXPR _bucket "${_bucket}") # Remove padding
+	while(NOT _currentBucket GREATER _bucket)
+		string(APPEND _bucketStarts "${_index},")
+		math(EXPR _currentBucket "${_currentBucket} + 1")
+	endwhile()
+	string(APPEND _ouis "0x${_oui},")
+	string(APPEND _vendorIndexes "${_vendorIndex},")
+	math(EXPR _index "${_index} + 1")
+endforeach()
+while(NOT _currentBucket GREATER _bucketsCount)
+	string(APPEND _bucketStarts "${_index},")
+	math(EXPR _currentBucket "${_currentBucket} + 1")
+endwhile()
+
+# Write the header (only if changed, to prevent useless rebuilds)
+file(WRITE "${OUTPUT_FILE}.tmp"
+"// Generated by generateOuiDatabase.cmake from ${INPUT_FILE}, do not edit
+// ${_entriesCount} OUIs, ${_vendorsCount} vendors
+
+#pragma once
+
+#include <cstdint>
+
+static constexpr std::uint8_t OuiBucketBits = ${_bucketBits};
+static constexpr std::uint32_t OuiBucketStarts[] = { ${_bucketStarts} };
+static constexpr std::uint32_t Ouis[] = { ${_ouis} };
+static constexpr std::uint16_t OuiVendorIndexes[] = { ${_vendorIndexes} };
+static constexpr char const* OuiVendorNames[] = {
+${_vendorNames}};
+")
+configure_file("${OUTPUT_FILE}.tmp" "${OUTPUT_FILE}" COPYONLY)
+file(REMOVE "${OUTPUT_FILE}.tmp")
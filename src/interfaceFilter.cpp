@@ -0,0 +1,124 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+ * @file interfaceFilter.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "networkInterfaceHelper_common.hpp"
+
+#include <algorithm> // any_of
+
+namespace la
+{
+namespace networkInterface
+{
+namespace utils
+{
+bool matchesPattern(std::string const& str, std::string const& pattern) noexcept
+{
+	auto strPos = size_t{ 0u };
+	auto patternPos = size_t{ 0u };
+	// Position of the last '*' in the pattern (and the matching position in str), to backtrack in case of mismatch
+	auto starPos = std::string::npos;
+	auto starMatchPos = size_t{ 0u };
+
+	while (strPos < str.size())
+	{
+		if (patternPos < pattern.size() && (pattern[patternPos] == '?' || pattern[patternPos] == str[strPos]))
+		{
+			++strPos;
+			++patternPos;
+		}
+		else if (patternPos < pattern.size() && pattern[patternPos] == '*')
+		{
+			starPos = patternPos++;
+			starMatchPos = strPos;
+		}
+		else if (starPos != std::string::npos)
+		{
+			// Let the last '*' match one more char
+			patternPos = starPos + 1;
+			strPos = ++starMatchPos;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	// Remaining pattern chars must all be '*'
+	while (patternPos < pattern.size() && pattern[patternPos] == '*')
+	{
+		++patternPos;
+	}
+	return patternPos == pattern.size();
+}
+} // namespace utils
+
+bool InterfaceFilter::matches(Interface const& intfc) const noexcept
+{
+	if ((types & typeMask(intfc.type)) == 0)
+	{
+		return false;
+	}
+	if ((physicalOnly && intfc.isVirtual) || (virtualOnly && !intfc.isVirtual))
+	{
+		return false;
+	}
+	if ((enabledOnly && !intfc.isEnabled) || (connectedOnly && !intfc.isConnected))
+	{
+		return false;
+	}
+	if (!namePattern.empty() && !utils::matchesPattern(intfc.id, namePattern) && !utils::matchesPattern(intfc.alias, namePattern))
+	{
+		return false;
+	}
+	if (addressType != IPAddress::Type::None)
+	{
+		auto const hasAddressType = std::any_of(intfc.ipAddressInfos.begin(), intfc.ipAddressInfos.end(),
+			[this](auto const& info)
+			{
+				return info.address.getType() == addressType;
+			});
+		if (!hasAddressType)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace networkInterface
+} // namespace la
@@ -0,0 +1,250 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+ * @file interfacesSnapshot.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "networkInterfaceHelper_common.hpp"
+
+#include <cstring> // memcpy / memset
+#include <new> // placement new
+#include <limits>
+#include <type_traits>
+#include <bitset>
+
+namespace la
+{
+namespace networkInterface
+{
+static_assert(std::is_trivially_copyable_v<InterfacesSnapshot::Header> && std::is_standard_layout_v<InterfacesSnapshot::Header>, "Header must be a POD");
+static_assert(std::is_trivially_copyable_v<InterfacesSnapshot::InterfaceEntry> && std::is_standard_layout_v<InterfacesSnapshot::InterfaceEntry>, "InterfaceEntry must be a POD");
+static_assert(std::is_trivially_copyable_v<InterfacesSnapshot::IPAddressEntry> && std::is_standard_layout_v<InterfacesSnapshot::IPAddressEntry>, "IPAddressEntry must be a POD");
+static_assert(sizeof(InterfacesSnapshot::Header) % alignof(InterfacesSnapshot::InterfaceEntry) == 0, "InterfaceEntry array must be aligned");
+
+static std::uint8_t getPrefixLength(IPAddress const& netmask) noexcept
+{
+	switch (netmask.getType())
+	{
+		case IPAddress::Type::V4:
+			return static_cast<std::uint8_t>(std::bitset<32>{ netmask.getIPV4Packed() }.count());
+		case IPAddress::Type::V6:
+			return IPAddress::prefixLengthFromPackedV6(netmask.getIPV6Packed());
+		default:
+			return 0u;
+	}
+}
+
+InterfacesSnapshot::IPAddressEntry InterfacesSnapshot::makeIPAddressEntry(IPAddress const& address, std::uint8_t const prefixLength) noexcept
+{
+	auto entry = InterfacesSnapshot::IPAddressEntry{};
+	entry.type = static_cast<std::uint8_t>(address.getType());
+	entry.prefixLength = prefixLength;
+	switch (address.getType())
+	{
+		case IPAddress::Type::V4:
+		{
+			auto const ip = address.getIPV4();
+			std::memcpy(entry.bytes.data(), ip.data(), ip.size());
+			break;
+		}
+		case IPAddress::Type::V6:
+		{
+			auto const ip = address.getIPV6();
+			for (auto i = 0u; i < ip.size(); ++i)
+			{
+				entry.bytes[i * 2] = static_cast<std::uint8_t>(ip[i] >> 8);
+				entry.bytes[i * 2 + 1] = static_cast<std::uint8_t>(ip[i] & 0xFF);
+			}
+			break;
+		}
+		default:
+			break;
+	}
+	return entry;
+}
+
+InterfacesSnapshot::IPAddressEntry InterfacesSnapshot::makeIPAddressEntry(IPAddressInfo const& info) noexcept
+{
+	return makeIPAddressEntry(info.address, getPrefixLength(info.netmask));
+}
+
+InterfacesSnapshot InterfacesSnapshot::build(std::vector<Interface const*> const& interfaces)
+{
+	auto snapshot = InterfacesSnapshot{};
+	build(interfaces, snapshot);
+	return snapshot;
+}
+
+void InterfacesSnapshot::build(std::vector<Interface const*> const& interfaces, InterfacesSnapshot& snapshot)
+{
+	// Compute the size of each section
+	auto ipAddressesCount = std::size_t{ 0u };
+	auto stringsSize = std::size_t{ 0u };
+	for (auto const* const intfc : interfaces)
+	{
+		ipAddressesCount += intfc->ipAddressInfos.size() + intfc->gateways.size();
+		stringsSize += intfc->id.size() + intfc->description.size() + intfc->alias.size() + 3; // Including NULL characters
+	}
+	auto const interfacesOffset = sizeof(Header);
+	auto const ipAddressesOffset = interfacesOffset + interfaces.size() * sizeof(InterfaceEntry);
+	auto const stringsOffset = ipAddressesOffset + ipAddressesCount * sizeof(IPAddressEntry);
+	auto const totalSize = stringsOffset + stringsSize;
+	if (totalSize > std::numeric_limits<std::uint32_t>::max())
+	{
+		throw std::invalid_argument("Too much data for an InterfacesSnapshot");
+	}
+
+	// Single allocation for the whole snapshot, unless the previous buffer is large enough (zero initialized, so strings are NULL-terminated)
+	if (totalSize > snapshot._capacity)
+	{
+		snapshot._buffer = std::make_unique<std::uint8_t[]>(totalSize);
+		snapshot._capacity = totalSize;
+	}
+	else
+	{
+		std::memset(snapshot._buffer.get(), 0, totalSize);
+	}
+	snapshot._size = totalSize;
+	auto* const buffer = snapshot._buffer.get();
+
+	auto nextIPAddressOffset = ipAddressesOffset;
+	auto nextStringOffset = stringsOffset;
+	auto const writeString = [buffer, &nextStringOffset](std::string const& str)
+	{
+		auto const entry = StringEntry{ static_cast<std::uint32_t>(nextStringOffset), static_cast<std::uint32_t>(str.size()) };
+		std::memcpy(buffer + nextStringOffset, str.data(), str.size());
+		nextStringOffset += str.size() + 1;
+		return entry;
+	};
+	auto const writeIPAddress = [buffer, &nextIPAddressOffset](IPAddressEntry const& entry)
+	{
+		new (buffer + nextIPAddressOffset) IPAddressEntry{ entry };
+		nextIPAddressOffset += sizeof(IPAddressEntry);
+	};
+
+	// Header
+	auto header = Header{};
+	header.size = static_cast<std::uint32_t>(totalSize);
+	header.interfacesOffset = static_cast<std::uint32_t>(interfacesOffset);
+	header.interfacesCount = static_cast<std::uint32_t>(interfaces.size());
+	new (buffer) Header{ header };
+
+	// Interfaces
+	for (auto i = 0u; i < interfaces.size(); ++i)
+	{
+		auto const& intfc = *interfaces[i];
+		auto entry = InterfaceEntry{};
+		entry.id = writeString(intfc.id);
+		entry.description = writeString(intfc.description);
+		entry.alias = writeString(intfc.alias);
+		entry.ipAddressesOffset = static_cast<std::uint32_t>(nextIPAddressOffset);
+		entry.ipAddressesCount = static_cast<std::uint32_t>(intfc.ipAddressInfos.size());
+		for (auto const& info : intfc.ipAddressInfos)
+		{
+			writeIPAddress(makeIPAddressEntry(info));
+		}
+		entry.gatewaysOffset = static_cast<std::uint32_t>(nextIPAddressOffset);
+		entry.gatewaysCount = static_cast<std::uint32_t>(intfc.gateways.size());
+		for (auto const& gateway : intfc.gateways)
+		{
+			writeIPAddress(makeIPAddressEntry(gateway, 0u));
+		}
+		entry.macAddress = intfc.macAddress;
+		entry.type = static_cast<std::uint8_t>(intfc.type);
+		entry.isEnabled = static_cast<std::uint8_t>(intfc.isEnabled);
+		entry.isConnected = static_cast<std::uint8_t>(intfc.isConnected);
+		entry.isVirtual = static_cast<std::uint8_t>(intfc.isVirtual);
+		new (buffer + interfacesOffset + i * sizeof(InterfaceEntry)) InterfaceEntry{ entry };
+	}
+}
+
+std::size_t InterfacesSnapshot::getInterfacesCount() const noexcept
+{
+	if (!_buffer)
+	{
+		return 0u;
+	}
+	return reinterpret_cast<Header const*>(_buffer.get())->interfacesCount;
+}
+
+InterfacesSnapshot::InterfaceEntry const& InterfacesSnapshot::getInterface(std::size_t const index) const
+{
+	if (index >= getInterfacesCount())
+	{
+		throw std::invalid_argument("InterfacesSnapshot index out of range");
+	}
+	auto const* const header = reinterpret_cast<Header const*>(_buffer.get());
+	return reinterpret_cast<InterfaceEntry const*>(_buffer.get() + header->interfacesOffset)[index];
+}
+
+std::string_view InterfacesSnapshot::getString(StringEntry const& str) const noexcept
+{
+	if (!_buffer)
+	{
+		return {};
+	}
+	return std::string_view{ reinterpret_cast<char const*>(_buffer.get() + str.offset), str.length };
+}
+
+InterfacesSnapshot::IPAddressEntry const* InterfacesSnapshot::getIPAddresses(InterfaceEntry const& intfc) const noexcept
+{
+	if (!_buffer)
+	{
+		return nullptr;
+	}
+	return reinterpret_cast<IPAddressEntry const*>(_buffer.get() + intfc.ipAddressesOffset);
+}
+
+InterfacesSnapshot::IPAddressEntry const* InterfacesSnapshot::getGateways(InterfaceEntry const& intfc) const noexcept
+{
+	if (!_buffer)
+	{
+		return nullptr;
+	}
+	return reinterpret_cast<IPAddressEntry const*>(_buffer.get() + intfc.gatewaysOffset);
+}
+
+std::uint8_t const* InterfacesSnapshot::data() const noexcept
+{
+	return _buffer.get();
+}
+
+std::size_t InterfacesSnapshot::size() const noexcept
+{
+	return _size;
+}
+
+} // namespace networkInterface
+} // namespace la
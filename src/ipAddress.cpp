@@ -38,15 +38,14 @@
 
 #include "networkInterfaceHelper_common.hpp"
 
-#include <sstream>
 #include <stdexcept> // invalid_argument
 #include <algorithm> // copy
 #include <string>
-#include <vector>
-#include <cstring> // strncmp
-#include <cassert>
-#include <limits> // numeric_limits
+#include <array>
+#include <cstring> // strlen
 #include <optional>
+#include <system_error> // errc
+#include <iterator> // begin / end
 
 #if !defined(__GNUC__) || __GNUC__ >= 10 /* <version> is not present in earier versions of gcc (not sure which version exactly, using 10 here) */
 #	include <version>
@@ -62,87 +61,6 @@ namespace la
 {
 namespace networkInterface
 {
-namespace utils
-{
-inline std::vector<std::string> tokenizeString(std::string const& inputString, char const separator, bool const emptyIsToken) noexcept
-{
-	auto const* const str = inputString.c_str();
-	auto const pathLen = inputString.length();
-
-	auto tokensArray = std::vector<std::string>{};
-	auto startPos = size_t{ 0u };
-	auto currentPos = size_t{ 0u };
-	while (currentPos < pathLen)
-	{
-		// Check if we found our char
-		while (str[currentPos] == separator && currentPos < pathLen)
-		{
-			auto const foundPos = currentPos;
-			if (!emptyIsToken)
-			{
-				// And trim consecutive chars
-				while (str[currentPos] == separator)
-				{
-					currentPos++;
-				}
-			}
-			else
-			{
-				currentPos++;
-			}
-			auto const subStr = inputString.substr(startPos, foundPos - startPos);
-			if (!subStr.empty() || emptyIsToken)
-			{
-				tokensArray.push_back(subStr);
-			}
-			startPos = currentPos;
-		}
-		currentPos++;
-	}
-
-	// Add what remains as a token (except if empty and !emptyIsToken)
-	auto const subStr = inputString.substr(startPos, pathLen - startPos);
-	if (!subStr.empty() || emptyIsToken)
-	{
-		tokensArray.push_back(subStr);
-	}
-
-	return tokensArray;
-}
-
-/** Useful template to convert the string representation of any integer to its underlying type. */
-template<typename T>
-T convertFromString(char const* const str)
-{
-	static_assert(sizeof(T) > 1, "convertFromString<T> must not be char type");
-
-	if (std::strncmp(str, "0b", 2) == 0)
-	{
-		char* endptr = nullptr;
-		auto c = std::strtoll(str + 2, &endptr, 2);
-		if (endptr != nullptr && *endptr) // Conversion failed
-		{
-			throw std::invalid_argument(str);
-		}
-		return static_cast<T>(c);
-	}
-	std::stringstream ss;
-	if (std::strncmp(str, "0x", 2) == 0 || std::strncmp(str, "0X", 2) == 0)
-	{
-		ss << std::hex;
-	}
-
-	ss << str;
-	T out;
-	ss >> out;
-	if (ss.fail())
-	{
-		throw std::invalid_argument(str);
-	}
-	return out;
-}
-} // namespace utils
-
 constexpr auto MaxTokensV6 = 8u;
 constexpr auto EmbeddedIPv4Mask = IPAddress::value_type_packed_v6{ 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000000 };
 constexpr auto EmbeddedIPv4CompatibleValue = IPAddress::value_type_packed_v6{ 0x0000000000000000, 0x0000000000000000 };
@@ -193,154 +111,32 @@ IPAddress::IPAddress(value_type_packed_v6 const ipv6) noexcept
 
 IPAddress::IPAddress(std::string const& ipString)
 {
-	auto const parseIPV4 = [](auto const& ipString)
-	{
-		auto tokens = utils::tokenizeString(ipString, '.', false);
-
-		value_type_v4 ip{};
-		if (tokens.size() != ip.size())
-		{
-			throw std::invalid_argument("Invalid IPV4 format");
-		}
-		for (auto i = 0u; i < ip.size(); ++i)
-		{
-			// Using std::uint16_t for convertFromString since it's not possible to use 'char' type for this method
-			auto const tokenValue = utils::convertFromString<std::uint16_t>(tokens[i].c_str());
-			// Check if parsed value doesn't exceed max value for a value_type_v4 single element
-			if (tokenValue > std::integral_constant<decltype(tokenValue), std::numeric_limits<decltype(ip)::value_type>::max()>::value)
-			{
-				throw std::invalid_argument("Invalid IPV4 value");
-			}
-			ip[i] = static_cast<decltype(ip)::value_type>(tokenValue);
-		}
-		return ip;
-	};
-
-	auto tokensV6 = utils::tokenizeString(ipString, ':', true);
-	// If we have at least 2 tokens, we have an IPV6: since IPV4 is at most 1 token (the separator is '.') and IPV6 is at least 2 tokens even if only '::' (which would count as 3 tokens)
-	if (tokensV6.size() >= 2)
+	// Spaces around the elements have always been tolerated, strip them before parsing
+	auto buffer = std::array<char, IPAddressCharsMaxLength>{};
+	auto length = std::size_t{ 0u };
+	for (auto const c : ipString)
 	{
-		auto const packValue = [](value_type_packed_v6& packedIP, std::uint16_t const value, auto const index)
-		{
-			// Index 0 is the MSB
-			// Check index doesn't go beyond the packedIP size
-			if (index >= MaxTokensV6)
-			{
-				throw std::invalid_argument("Invalid IPV6 format");
-			}
-			// Compute which part of packedIP we need to update
-			if (index < 4)
-			{
-				packedIP.first |= static_cast<value_type_packed_v6::first_type>(value) << (48 - (index * 16));
-			}
-			else
-			{
-				packedIP.second |= static_cast<value_type_packed_v6::second_type>(value) << (48 - ((index - 4) * 16));
-			}
-		};
-
-		// Special case to handle where the first token was empty, immediatelly followed by another empty token (ie. "::xxx").
-		if (tokensV6[0].empty() && tokensV6[1].empty())
-		{
-			// Remove the first empty token
-			tokensV6.erase(tokensV6.begin());
-		}
-
-		// Special case to handle where the last token was empty, immediatelly preceeded by another empty token (ie. "xxx::").
-		if (tokensV6[tokensV6.size() - 1].empty() && tokensV6[tokensV6.size() - 2].empty())
-		{
-			// Remove the last empty token
-			tokensV6.erase(tokensV6.end() - 1);
-		}
-
-		// Compute the number of empty token sequences we have (get the index and length of the sequence) and check if we have an IPV4 embedded
-		auto emptyTokenCount = 0u;
-		auto emptyTokens = std::optional<std::pair<size_t, size_t>>{}; // First: index of the empty token, Second: number of empty tokens
-		auto isLastTokenIPv4 = false;
-		for (auto i = 0u; i < tokensV6.size(); ++i)
-		{
-			auto const& token = tokensV6[i];
-			// Check if we have an empty token
-			if (token.empty())
-			{
-				emptyTokenCount++;
-				emptyTokens = { i, MaxTokensV6 - tokensV6.size() + 1 };
-			}
-			// Check if it looks like an IPv4
-			if (tokensV6[i].find('.') != std::string::npos)
-			{
-				// Only allowed for the last token
-				if (i == tokensV6.size() - 1)
-				{
-					isLastTokenIPv4 = true;
-					// If we have a sequence of empty tokens, we need to decrement the empty tokens count (an IPv4 counts as 2 tokens, 32 bits)
-					if (emptyTokens.has_value())
-					{
-						emptyTokens->second--;
-					}
-				}
-				else
-				{
-					throw std::invalid_argument("Invalid IPV6 format");
-				}
-			}
-		}
-
-		// Sanity checks
+		if (c == ' ' || c == '\t')
 		{
-			// Only one empty token sequence is allowed
-			if (emptyTokenCount > 1)
-			{
-				throw std::invalid_argument("Invalid IPV6 format");
-			}
-			// If we don't have any empty token check for tokens count
-			if (!emptyTokens.has_value())
-			{
-				// If we don't have an embedded IPv4, we need to have exactly 8 tokens
-				if (!isLastTokenIPv4 && tokensV6.size() != MaxTokensV6)
-				{
-					throw std::invalid_argument("Invalid IPV6 format");
-				}
-				// If we have an embedded IPv4, we need to have exactly 7 tokens
-				if (isLastTokenIPv4 && tokensV6.size() != MaxTokensV6 - 1)
-				{
-					throw std::invalid_argument("Invalid IPV6 format");
-				}
-			}
+			continue;
 		}
-
-		auto ip = value_type_packed_v6{};
-		auto packPosition = 0u;
-		for (auto i = 0u; i < tokensV6.size(); ++i)
+		if (length == buffer.size())
 		{
-			// Check if we are inside the empty tokens range
-			if (emptyTokens.has_value() && i == emptyTokens->first)
-			{
-				// Nothing to do, we are in the empty tokens range ('ip' is already 0)
-				packPosition += static_cast<decltype(packPosition)>(emptyTokens->second);
-				continue;
-			}
-			// For the last token, check if we have an IPV4 embedded
-			if ((i == tokensV6.size() - 1) && isLastTokenIPv4)
-			{
-				assert(packPosition == MaxTokensV6 - 2 && "Invalid pack position");
-				auto const ipv4 = pack(parseIPV4(tokensV6[i]));
-				// Pack the IPV4 into the last 2 elements of the IPV6
-				packValue(ip, static_cast<std::uint16_t>(ipv4 >> 16), packPosition++);
-				packValue(ip, static_cast<std::uint16_t>(ipv4 & 0xFFFF), packPosition++);
-				continue;
-			}
-			// Read the token
-			auto const tokenValue = utils::convertFromString<std::uint16_t>(("0x" + tokensV6[i]).c_str());
-			packValue(ip, tokenValue, packPosition++);
+			throw std::invalid_argument("Invalid IP address format");
 		}
-		setValue(ip);
+		buffer[length++] = c;
 	}
-	// Try to parse IPV4
-	else
+
+	auto const* const first = buffer.data();
+	auto const* const last = first + length;
+	auto ip = IPAddress{};
+	auto const [end, ec] = NetworkInterfaceHelper::ipAddressFromChars(first, last, ip);
+	// The whole string must be a valid IP address
+	if (ec != std::errc{} || end != last)
 	{
-		setValue(parseIPV4(ipString));
+		throw std::invalid_argument("Invalid IP address format");
 	}
+	*this = ip;
 }
 
 IPAddress::IPAddress(IPAddress const& ipv4, CompatibleV6Tag)
@@ -573,76 +369,36 @@ bool operator<=(IPAddress const& lhs, IPAddress const& rhs)
 }
 
 IPAddress operator+(IPAddress const& lhs, std::uint32_t const value)
+{
+	return lhs + UInt128{ value };
+}
+
+IPAddress operator-(IPAddress const& lhs, std::uint32_t const value)
+{
+	return lhs - UInt128{ value };
+}
+
+IPAddress operator+(IPAddress const& lhs, UInt128 const& value)
 {
 	switch (lhs._type)
 	{
 		case IPAddress::Type::V4:
-			return IPAddress{ lhs.getIPV4Packed() + value };
+			return IPAddress{ IPAddress::add(lhs.getIPV4Packed(), value) };
 		case IPAddress::Type::V6:
-		{
-			auto v = lhs.getIPV6Packed();
-			// Check if adding value to the lower part of the IPV6 will overflow (ie. if we need to carry)
-			if ((std::numeric_limits<decltype(v.second)>::max() - v.second) < value)
-			{
-				auto lowerPart = std::numeric_limits<decltype(v.second)>::min();
-				auto const carry = value - (std::numeric_limits<decltype(v.second)>::max() - v.second);
-				// Check if adding carry to the upper part of the IPV6 will overflow (ie. if we need to carry back to the lower part)
-				if ((std::numeric_limits<decltype(v.first)>::max() - v.first) < carry)
-				{
-					auto const carryBack = carry - (std::numeric_limits<decltype(v.first)>::max() - v.first) - 1 /* Already incremented the lower part */;
-					v.first = std::numeric_limits<decltype(v.first)>::min();
-					lowerPart = carryBack;
-				}
-				else
-				{
-					v.first = static_cast<decltype(v.first)>(v.first + carry);
-				}
-				v.second = static_cast<decltype(v.second)>(lowerPart);
-			}
-			else
-			{
-				v.second = static_cast<decltype(v.second)>(v.second + value);
-			}
-			return IPAddress{ v };
-		}
+			return IPAddress{ IPAddress::add(lhs.getIPV6Packed(), value) };
 		default:
 			throw std::invalid_argument("Invalid Type");
 	}
 }
 
-IPAddress operator-(IPAddress const& lhs, std::uint32_t const value)
+IPAddress operator-(IPAddress const& lhs, UInt128 const& value)
 {
 	switch (lhs._type)
 	{
 		case IPAddress::Type::V4:
-			return IPAddress{ lhs.getIPV4Packed() - value };
+			return IPAddress{ IPAddress::subtract(lhs.getIPV4Packed(), value) };
 		case IPAddress::Type::V6:
-		{
-			auto v = lhs.getIPV6Packed();
-			// Check if subtracting value from the lower part of the IPV6 will underflow (ie. if we need to borrow)
-			if (v.second < value)
-			{
-				auto lowerPart = std::numeric_limits<decltype(v.second)>::max();
-				auto const borrow = value - v.second;
-				// Check if subtracting borrow from the upper part of the IPV6 will underflow (ie. if we need to borrow back to the lower part)
-				if (v.first < borrow)
-				{
-					auto const borrowBack = borrow - v.first - 1 /* Already decremented the lower part */;
-					v.first = std::numeric_limits<decltype(v.first)>::max();
-					lowerPart = static_cast<decltype(v.second)>(lowerPart - borrowBack);
-				}
-				else
-				{
-					v.first = static_cast<decltype(v.first)>(v.first - borrow);
-				}
-				v.second = static_cast<decltype(v.second)>(lowerPart);
-			}
-			else
-			{
-				v.second = static_cast<decltype(v.second)>(v.second - value);
-			}
-			return IPAddress{ v };
-		}
+			return IPAddress{ IPAddress::subtract(lhs.getIPV6Packed(), value) };
 		default:
 			throw std::invalid_argument("Invalid Type");
 	}
@@ -770,6 +526,49 @@ IPAddress::value_type_v6 IPAddress::unpack(value_type_packed_v6 const ipv6) noex
 	return ip;
 }
 
+IPAddress IPAddress::addSaturated(IPAddress const& ip, UInt128 const& offset)
+{
+	switch (ip._type)
+	{
+		case Type::V4:
+			return IPAddress{ addSaturated(ip.getIPV4Packed(), offset) };
+		case Type::V6:
+			return IPAddress{ addSaturated(ip.getIPV6Packed(), offset) };
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+}
+
+IPAddress IPAddress::subtractSaturated(IPAddress const& ip, UInt128 const& offset)
+{
+	switch (ip._type)
+	{
+		case Type::V4:
+			return IPAddress{ subtractSaturated(ip.getIPV4Packed(), offset) };
+		case Type::V6:
+			return IPAddress{ subtractSaturated(ip.getIPV6Packed(), offset) };
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+}
+
+UInt128 IPAddress::distance(IPAddress const& lhs, IPAddress const& rhs)
+{
+	if (lhs._type != rhs._type)
+	{
+		throw std::invalid_argument("lhs and rhs not of the same Type");
+	}
+	switch (lhs._type)
+	{
+		case Type::V4:
+			return distance(lhs.getIPV4Packed(), rhs.getIPV4Packed());
+		case Type::V6:
+			return distance(lhs.getIPV6Packed(), rhs.getIPV6Packed());
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+}
+
 IPAddress::value_type_packed_v6 IPAddress::packedV6FromPrefixLength(std::uint8_t const length) noexcept
 {
 	if (length == 64)
@@ -851,90 +650,66 @@ std::size_t IPAddress::hash::operator()(IPAddress const& ip) const
 	return h;
 }
 
-static std::string buildIPV4String(IPAddress::value_type_v4 const& ipv4) noexcept
+/** Writes the dotted-decimal representation of the IPV4 (at most 15 characters). Returns the end of the written characters. */
+static char* writeIPV4(char* out, IPAddress::value_type_v4 const& ipv4) noexcept
 {
-	auto ip = std::string{};
-
-	for (auto const v : ipv4)
+	for (auto i = 0u; i < ipv4.size(); ++i)
 	{
-		if (!ip.empty())
+		if (i != 0u)
 		{
-			ip.append(".");
+			*out++ = '.';
 		}
-		ip.append(std::to_string(v));
+		out = std::to_chars(out, out + 3, ipv4[i]).ptr;
 	}
-
-	return ip;
+	return out;
 }
 
-#if defined(__GNUC__) && !defined(__clang__)
-#	pragma GCC diagnostic push
-#	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
-// For some reason, GCC thinks some variables in this method are not initialized
-#endif
-static std::string buildIPV6String(IPAddress::value_type_v6 const& ipv6, IPAddress::value_type_packed_v6 const& packedIP, bool const displayAsEmbeddedIPV4) noexcept
+/** Writes the RFC 5952 representation of the IPV6 (at most 39 characters). Returns the end of the written characters. */
+static char* writeIPV6(char* out, IPAddress::value_type_v6 const& ipv6, bool const displayAsEmbeddedIPV4) noexcept
 {
-	// Special case for unspecified address
-	if (packedIP.first == 0 && packedIP.second == 0)
-	{
-		return "::";
-	}
-	// Special case for loopback address
-	if (packedIP.first == 0 && packedIP.second == 1)
-	{
-		return "::1";
-	}
-
 	// First pass - Get the longest sequence of 0 and its position
-	auto longestZeroSeq = std::optional<std::pair<size_t, size_t>>{};
-	auto currentZeroSeq = std::optional<std::pair<size_t, size_t>>{};
-	for (auto i = 0u; i < ipv6.size(); ++i)
+	auto longestZeroSeqStart = ipv6.size();
+	auto longestZeroSeqLength = size_t{ 0u };
+	auto currentZeroSeqStart = ipv6.size();
+	for (auto i = 0u; i <= ipv6.size(); ++i)
 	{
 		// We have a 0
-		if (ipv6[i] == 0)
+		if (i < ipv6.size() && ipv6[i] == 0)
 		{
 			// Start a new sequence at this position if not already started
-			if (!currentZeroSeq.has_value())
+			if (currentZeroSeqStart == ipv6.size())
 			{
-				currentZeroSeq = { i, 0u };
+				currentZeroSeqStart = i;
 			}
-			// Increment the sequence length
-			currentZeroSeq->second++;
 		}
-		// We don't have a 0
+		// We don't have a 0 (or we reached the end)
 		else
 		{
 			// If we have an active sequence, check if it's (strictly) the longest
-			if (currentZeroSeq.has_value() && (!longestZeroSeq.has_value() || currentZeroSeq->second > longestZeroSeq->second))
+			if (currentZeroSeqStart != ipv6.size() && (i - currentZeroSeqStart) > longestZeroSeqLength)
 			{
-				longestZeroSeq = currentZeroSeq;
+				longestZeroSeqStart = currentZeroSeqStart;
+				longestZeroSeqLength = i - currentZeroSeqStart;
 			}
-			currentZeroSeq = std::nullopt;
+			currentZeroSeqStart = ipv6.size();
 		}
 	}
-	// Check if the last sequence is the longest
-	if (currentZeroSeq.has_value() && (!longestZeroSeq.has_value() || currentZeroSeq->second > longestZeroSeq->second))
-	{
-		longestZeroSeq = currentZeroSeq;
-	}
 	// If the longest sequence is only 1 in length, it's not a sequence
-	if (longestZeroSeq.has_value() && longestZeroSeq->second == 1)
+	if (longestZeroSeqLength == 1)
 	{
-		longestZeroSeq = std::nullopt;
+		longestZeroSeqStart = ipv6.size();
 	}
 
 	// Second pass - Print the IPV6 address
 	auto mustAppendColon = false;
-	std::stringstream ss;
-	ss << std::hex;
-
 	for (auto i = 0u; i < ipv6.size(); ++i)
 	{
 		// Check if we have a sequence at this position
-		if (longestZeroSeq.has_value() && i == longestZeroSeq->first)
+		if (i == longestZeroSeqStart)
 		{
-			ss << "::";
-			i += static_cast<decltype(i)>(longestZeroSeq->second - 1);
+			*out++ = ':';
+			*out++ = ':';
+			i += static_cast<decltype(i)>(longestZeroSeqLength - 1);
 			mustAppendColon = false; // Reset the flag, we already added the double colon
 			continue;
 		}
@@ -945,58 +720,241 @@ static std::string buildIPV6String(IPAddress::value_type_v6 const& ipv6, IPAddre
 		}
 		else
 		{
-			ss << ":";
+			*out++ = ':';
 		}
 
 		// Check if we must display the embedded IPV4 (the last 2 elements)
 		if (displayAsEmbeddedIPV4 && i == ipv6.size() - 2)
 		{
-			ss << std::dec;
-			ss << (ipv6[6] >> 8) << "." << (ipv6[6] & 0xFF) << "." << (ipv6[7] >> 8) << "." << (ipv6[7] & 0xFF);
-			break; // We are done
+			return writeIPV4(out, IPAddress::value_type_v4{ static_cast<std::uint8_t>(ipv6[6] >> 8), static_cast<std::uint8_t>(ipv6[6] & 0xFF), static_cast<std::uint8_t>(ipv6[7] >> 8), static_cast<std::uint8_t>(ipv6[7] & 0xFF) });
 		}
 		// Print the element
-		ss << ipv6[i];
+		out = std::to_chars(out, out + 4, ipv6[i], 16).ptr;
 	}
 
-	return ss.str();
+	return out;
 }
-#if defined(__GNUC__) && !defined(__clang__)
-#	pragma GCC diagnostic pop
-#endif
 
-void IPAddress::buildIPString() noexcept
+/** Writes the representation of a valid IPAddress (at most IPAddressCharsMaxLength characters). Returns the end of the written characters. */
+static char* writeIPAddress(char* out, IPAddress::Type const type, IPAddress::value_type_v4 const& ipv4, IPAddress::value_type_v6 const& ipv6) noexcept
+{
+	switch (type)
+	{
+		case IPAddress::Type::V4:
+			return writeIPV4(out, ipv4);
+		case IPAddress::Type::V6:
+		{
+			auto const packedIP = IPAddress::pack(ipv6);
+			return writeIPV6(out, ipv6, isEmbeddedIPv4Compatible(packedIP) || isEmbeddedIPv4Mapped(packedIP));
+		}
+		default:
+			return out;
+	}
+}
+
+/** Parses a dotted-decimal IPV4 from the beginning of [in, last). Returns the end of the parsed characters, or nullptr if not valid. */
+static char const* readIPV4(char const* in, char const* const last, IPAddress::value_type_packed_v4& ipv4) noexcept
 {
-	std::string ip;
+	auto result = IPAddress::value_type_packed_v4{ 0u };
+	for (auto i = 0u; i < 4u; ++i)
+	{
+		if (i != 0u)
+		{
+			if (in == last || *in != '.')
+			{
+				return nullptr;
+			}
+			++in;
+		}
+		auto value = 0u;
+		auto digits = 0u;
+		while (in != last && *in >= '0' && *in <= '9')
+		{
+			// At most 3 digits per element
+			if (++digits > 3u)
+			{
+				return nullptr;
+			}
+			value = value * 10u + static_cast<unsigned>(*in - '0');
+			++in;
+		}
+		// Leading zeros are not allowed (ambiguous octal notation)
+		if (digits == 0u || value > 255u || (digits > 1u && *(in - digits) == '0'))
+		{
+			return nullptr;
+		}
+		result = (result << 8) | value;
+	}
+	ipv4 = result;
+	return in;
+}
 
-	switch (_type)
+/** Parses an IPV6 (RFC 4291 text representation, with optional embedded IPV4) from the beginning of [in, last). Returns the end of the parsed characters, or nullptr if not valid. */
+static char const* readIPV6(char const* in, char const* const last, IPAddress::value_type_packed_v6& ipv6) noexcept
+{
+	auto const isHexDigit = [last](char const* const c)
 	{
-		case Type::V4:
+		return c != last && HexDigitValues[static_cast<unsigned char>(*c)] != InvalidHexDigit;
+	};
+	auto const isDoubleColon = [last](char const* const c)
+	{
+		return (last - c) >= 2 && c[0] == ':' && c[1] == ':';
+	};
+
+	auto groups = IPAddress::value_type_v6{};
+	auto count = 0u;
+	auto compressedIndex = std::optional<unsigned>{}; // Index of the group following the '::' (if compressed)
+	auto mustReadGroup = true; // A group is mandatory at the beginning and after a single ':'
+
+	if (isDoubleColon(in))
+	{
+		compressedIndex = 0u;
+		mustReadGroup = false;
+		in += 2;
+	}
+
+	while (count < MaxTokensV6)
+	{
+		if (!isHexDigit(in))
 		{
-			ip = buildIPV4String(_ipv4);
+			if (mustReadGroup)
+			{
+				return nullptr;
+			}
 			break;
 		}
-		case Type::V6:
+
+		auto const* const groupStart = in;
+		auto value = 0u;
+		auto digits = 0u;
+		while (isHexDigit(in) && digits < 4u)
+		{
+			value = (value << 4) | HexDigitValues[static_cast<unsigned char>(*in)];
+			++in;
+			++digits;
+		}
+
+		// Embedded IPV4 (only allowed for the last 32 bits)
+		if (in != last && *in == '.')
 		{
-			auto const packedIP = pack(_ipv6);
-			auto const displayAsEmbeddedIPV4 = isEmbeddedIPv4Compatible(packedIP) || isEmbeddedIPv4Mapped(packedIP);
-			ip = buildIPV6String(_ipv6, packedIP, displayAsEmbeddedIPV4);
+			auto ipv4 = IPAddress::value_type_packed_v4{};
+			if ((count + 2u) > MaxTokensV6 || (in = readIPV4(groupStart, last, ipv4)) == nullptr)
+			{
+				return nullptr;
+			}
+			groups[count++] = static_cast<std::uint16_t>(ipv4 >> 16);
+			groups[count++] = static_cast<std::uint16_t>(ipv4 & 0xFFFF);
 			break;
 		}
-		default:
-			ip = "Invalid IPAddress";
+		// At most 4 digits per group
+		if (isHexDigit(in))
+		{
+			return nullptr;
+		}
+		groups[count++] = static_cast<std::uint16_t>(value);
+
+		if (isDoubleColon(in))
+		{
+			// Only one '::' is allowed
+			if (compressedIndex)
+			{
+				return nullptr;
+			}
+			compressedIndex = count;
+			mustReadGroup = false;
+			in += 2;
+		}
+		else if (in != last && *in == ':')
+		{
+			// No group can follow the last one
+			if (count == MaxTokensV6)
+			{
+				return nullptr;
+			}
+			mustReadGroup = true;
+			++in;
+		}
+		else
+		{
 			break;
+		}
 	}
 
-	auto len = ip.size();
-	if (len >= _ipString.size())
+	// Without '::' all groups must be present, with '::' at least one group must be compressed
+	if (!compressedIndex ? (count != MaxTokensV6) : (count >= MaxTokensV6))
+	{
+		return nullptr;
+	}
+
+	// Move the groups following the '::' to the end
+	auto result = IPAddress::value_type_v6{};
+	auto const compressedCount = MaxTokensV6 - count;
+	for (auto i = 0u; i < count; ++i)
+	{
+		result[(!compressedIndex || i < *compressedIndex) ? i : i + compressedCount] = groups[i];
+	}
+	ipv6 = IPAddress::pack(result);
+	return in;
+}
+
+std::to_chars_result NetworkInterfaceHelper::ipAddressToChars(char* const first, char* const last, IPAddress const& ip) noexcept
+{
+	if (!ip.isValid())
 	{
-		assert(len < _ipString.size() && "String length greater than IPStringMaxLength");
-		len = _ipString.size() - 1;
-		ip.resize(len);
+		return { first, std::errc::invalid_argument };
 	}
-	std::copy(ip.begin(), ip.end(), _ipString.begin());
-	_ipString[len] = 0;
+
+	// The string has already been built when the value was set
+	auto const* const str = ip._ipString.data();
+	auto const length = std::strlen(str);
+	if (static_cast<std::size_t>(last - first) < length)
+	{
+		return { last, std::errc::value_too_large };
+	}
+	return { std::copy(str, str + length, first), std::errc{} };
+}
+
+std::from_chars_result NetworkInterfaceHelper::ipAddressFromChars(char const* const first, char const* const last, IPAddress& ip) noexcept
+{
+	// Try IPV4 first (an IPV6 always has a ':' before any '.')
+	auto ipv4 = IPAddress::value_type_packed_v4{};
+	if (auto const* const end = readIPV4(first, last, ipv4); end != nullptr)
+	{
+		ip = IPAddress{ ipv4 };
+		return { end, std::errc{} };
+	}
+
+	auto ipv6 = IPAddress::value_type_packed_v6{};
+	if (auto const* const end = readIPV6(first, last, ipv6); end != nullptr)
+	{
+		ip = IPAddress{ ipv6 };
+		return { end, std::errc{} };
+	}
+
+	return { first, std::errc::invalid_argument };
+}
+
+void IPAddress::buildIPString() noexcept
+{
+	auto* end = _ipString.data();
+
+	switch (_type)
+	{
+		case Type::V4:
+		case Type::V6:
+		{
+			end = writeIPAddress(end, _type, _ipv4, _ipv6);
+			break;
+		}
+		default:
+		{
+			constexpr char InvalidString[] = "Invalid IPAddress";
+			end = std::copy(std::begin(InvalidString), std::end(InvalidString) - 1, end);
+			break;
+		}
+	}
+
+	*end = 0;
 }
 
 
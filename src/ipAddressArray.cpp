@@ -0,0 +1,611 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+ * @file ipAddressArray.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "la/networkInterfaceHelper/ipAddressArray.hpp"
+#include "networkInterfaceHelper_common.hpp"
+
+#include <stdexcept> // invalid_argument
+#include <array>
+#include <cstring> // memcpy
+
+#if defined(__AVX2__)
+#	include <immintrin.h>
+#	define NIH_IPADDRESSARRAY_AVX2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#	include <arm_neon.h>
+#	define NIH_IPADDRESSARRAY_NEON
+#endif
+
+namespace la
+{
+namespace networkInterface
+{
+/* ************************************************************ */
+/* Kernels                                                      */
+/* ************************************************************ */
+struct SubnetV4
+{
+	std::uint32_t mask{ 0u };
+	std::uint32_t network{ 0u };
+};
+
+struct SubnetV6
+{
+	std::uint64_t maskHigh{ 0u };
+	std::uint64_t maskLow{ 0u };
+	std::uint64_t networkHigh{ 0u };
+	std::uint64_t networkLow{ 0u };
+};
+
+#if defined(NIH_IPADDRESSARRAY_AVX2)
+/** For each 8-bit value, the 8 bytes (little endian) set to the value of the matching bit (0 or 1) */
+static constexpr std::array<std::uint64_t, 256> makeBitsToBytes() noexcept
+{
+	auto table = std::array<std::uint64_t, 256>{};
+	for (auto bits = 0u; bits < 256u; ++bits)
+	{
+		auto bytes = std::uint64_t{ 0u };
+		for (auto bit = 0u; bit < 8u; ++bit)
+		{
+			bytes |= static_cast<std::uint64_t>((bits >> bit) & 1u) << (bit * 8u);
+		}
+		table[bits] = bytes;
+	}
+	return table;
+}
+static constexpr auto s_BitsToBytes = makeBitsToBytes();
+
+/** Writes 'count' result bytes from a movemask and returns the number of set bits */
+static inline std::size_t storeResults(int const bits, std::uint8_t* const results, std::size_t const count) noexcept
+{
+	auto const bytes = s_BitsToBytes[static_cast<std::size_t>(bits)];
+	std::memcpy(results, &bytes, count);
+	// Sum of the bytes (each being 0 or 1)
+	return static_cast<std::size_t>((bytes * 0x0101010101010101ull) >> 56);
+}
+#endif // NIH_IPADDRESSARRAY_AVX2
+
+static void maskV4(std::uint32_t* const data, std::size_t const count, std::uint32_t const mask) noexcept
+{
+	auto index = std::size_t{ 0u };
+#if defined(NIH_IPADDRESSARRAY_AVX2)
+	auto const m = _mm256_set1_epi32(static_cast<int>(mask));
+	for (; index + 8u <= count; index += 8u)
+	{
+		auto* const ptr = reinterpret_cast<__m256i*>(data + index);
+		_mm256_storeu_si256(ptr, _mm256_and_si256(_mm256_loadu_si256(ptr), m));
+	}
+#elif defined(NIH_IPADDRESSARRAY_NEON)
+	auto const m = vdupq_n_u32(mask);
+	for (; index + 4u <= count; index += 4u)
+	{
+		vst1q_u32(data + index, vandq_u32(vld1q_u32(data + index), m));
+	}
+#endif
+	for (; index < count; ++index)
+	{
+		data[index] &= mask;
+	}
+}
+
+static void maskV6(std::uint64_t* const high, std::uint64_t* const low, std::size_t const count, std::uint64_t const maskHigh, std::uint64_t const maskLow) noexcept
+{
+	auto index = std::size_t{ 0u };
+#if defined(NIH_IPADDRESSARRAY_AVX2)
+	auto const mh = _mm256_set1_epi64x(static_cast<long long>(maskHigh));
+	auto const ml = _mm256_set1_epi64x(static_cast<long long>(maskLow));
+	for (; index + 4u <= count; index += 4u)
+	{
+		auto* const h = reinterpret_cast<__m256i*>(high + index);
+		auto* const l = reinterpret_cast<__m256i*>(low + index);
+		_mm256_storeu_si256(h, _mm256_and_si256(_mm256_loadu_si256(h), mh));
+		_mm256_storeu_si256(l, _mm256_and_si256(_mm256_loadu_si256(l), ml));
+	}
+#elif defined(NIH_IPADDRESSARRAY_NEON)
+	auto const mh = vdupq_n_u64(maskHigh);
+	auto const ml = vdupq_n_u64(maskLow);
+	for (; index + 2u <= count; index += 2u)
+	{
+		vst1q_u64(high + index, vandq_u64(vld1q_u64(high + index), mh));
+		vst1q_u64(low + index, vandq_u64(vld1q_u64(low + index), ml));
+	}
+#endif
+	for (; index < count; ++index)
+	{
+		high[index] &= maskHigh;
+		low[index] &= maskLow;
+	}
+}
+
+static bool equalsAnyV4(std::uint32_t const* const data, std::size_t const count, std::uint32_t const value) noexcept
+{
+	auto index = std::size_t{ 0u };
+#if defined(NIH_IPADDRESSARRAY_AVX2)
+	auto const v = _mm256_set1_epi32(static_cast<int>(value));
+	// Only test for a match every 32 addresses
+	for (; index + 32u <= count; index += 32u)
+	{
+		auto const* const ptr = reinterpret_cast<__m256i const*>(data + index);
+		auto const c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256(ptr), v);
+		auto const c1 = _mm256_cmpeq_epi32(_mm256_loadu_si256(ptr + 1), v);
+		auto const c2 = _mm256_cmpeq_epi32(_mm256_loadu_si256(ptr + 2), v);
+		auto const c3 = _mm256_cmpeq_epi32(_mm256_loadu_si256(ptr + 3), v);
+		auto const any = _mm256_or_si256(_mm256_or_si256(c0, c1), _mm256_or_si256(c2, c3));
+		if (!_mm256_testz_si256(any, any))
+		{
+			return true;
+		}
+	}
+#elif defined(NIH_IPADDRESSARRAY_NEON)
+	auto const v = vdupq_n_u32(value);
+	// Only test for a match every 16 addresses
+	for (; index + 16u <= count; index += 16u)
+	{
+		auto const c0 = vceqq_u32(vld1q_u32(data + index), v);
+		auto const c1 = vceqq_u32(vld1q_u32(data + index + 4u), v);
+		auto const c2 = vceqq_u32(vld1q_u32(data + index + 8u), v);
+		auto const c3 = vceqq_u32(vld1q_u32(data + index + 12u), v);
+		if (vmaxvq_u32(vorrq_u32(vorrq_u32(c0, c1), vorrq_u32(c2, c3))) != 0u)
+		{
+			return true;
+		}
+	}
+#endif
+	for (; index < count; ++index)
+	{
+		if (data[index] == value)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool equalsAnyV6(std::uint64_t const* const high, std::uint64_t const* const low, std::size_t const count, std::uint64_t const valueHigh, std::uint64_t const valueLow) noexcept
+{
+	auto index = std::size_t{ 0u };
+#if defined(NIH_IPADDRESSARRAY_AVX2)
+	auto const vh = _mm256_set1_epi64x(static_cast<long long>(valueHigh));
+	auto const vl = _mm256_set1_epi64x(static_cast<long long>(valueLow));
+	// Only test for a match every 8 addresses
+	for (; index + 8u <= count; index += 8u)
+	{
+		auto const* const h = reinterpret_cast<__m256i const*>(high + index);
+		auto const* const l = reinterpret_cast<__m256i const*>(low + index);
+		auto const c0 = _mm256_and_si256(_mm256_cmpeq_epi64(_mm256_loadu_si256(h), vh), _mm256_cmpeq_epi64(_mm256_loadu_si256(l), vl));
+		auto const c1 = _mm256_and_si256(_mm256_cmpeq_epi64(_mm256_loadu_si256(h + 1), vh), _mm256_cmpeq_epi64(_mm256_loadu_si256(l + 1), vl));
+		auto const any = _mm256_or_si256(c0, c1);
+		if (!_mm256_testz_si256(any, any))
+		{
+			return true;
+		}
+	}
+#elif defined(NIH_IPADDRESSARRAY_NEON)
+	auto const vh = vdupq_n_u64(valueHigh);
+	auto const vl = vdupq_n_u64(valueLow);
+	// Only test for a match every 4 addresses
+	for (; index + 4u <= count; index += 4u)
+	{
+		auto const c0 = vandq_u64(vceqq_u64(vld1q_u64(high + index), vh), vceqq_u64(vld1q_u64(low + index), vl));
+		auto const c1 = vandq_u64(vceqq_u64(vld1q_u64(high + index + 2u), vh), vceqq_u64(vld1q_u64(low + index + 2u), vl));
+		if (vmaxvq_u32(vreinterpretq_u32_u64(vorrq_u64(c0, c1))) != 0u)
+		{
+			return true;
+		}
+	}
+#endif
+	for (; index < count; ++index)
+	{
+		if (high[index] == valueHigh && low[index] == valueLow)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static std::size_t inSubnetV4(std::uint32_t const* const data, std::size_t const count, SubnetV4 const& subnet, std::uint8_t* const results) noexcept
+{
+	auto found = std::size_t{ 0u };
+	auto index = std::size_t{ 0u };
+#if defined(NIH_IPADDRESSARRAY_AVX2)
+	auto const m = _mm256_set1_epi32(static_cast<int>(subnet.mask));
+	auto const n = _mm256_set1_epi32(static_cast<int>(subnet.network));
+	for (; index + 8u <= count; index += 8u)
+	{
+		auto const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + index));
+		auto const c = _mm256_cmpeq_epi32(_mm256_and_si256(v, m), n);
+		found += storeResults(_mm256_movemask_ps(_mm256_castsi256_ps(c)), results + index, 8u);
+	}
+#elif defined(NIH_IPADDRESSARRAY_NEON)
+	auto const m = vdupq_n_u32(subnet.mask);
+	auto const n = vdupq_n_u32(subnet.network);
+	for (; index + 8u <= count; index += 8u)
+	{
+		// Each lane is either 0 or 1
+		auto const c0 = vshrq_n_u32(vceqq_u32(vandq_u32(vld1q_u32(data + index), m), n), 31);
+		auto const c1 = vshrq_n_u32(vceqq_u32(vandq_u32(vld1q_u32(data + index + 4u), m), n), 31);
+		vst1_u8(results + index, vmovn_u16(vcombine_u16(vmovn_u32(c0), vmovn_u32(c1))));
+		found += vaddvq_u32(vaddq_u32(c0, c1));
+	}
+#endif
+	for (; index < count; ++index)
+	{
+		auto const isInSubnet = (data[index] & subnet.mask) == subnet.network;
+		results[index] = static_cast<std::uint8_t>(isInSubnet);
+		found += static_cast<std::size_t>(isInSubnet);
+	}
+	return found;
+}
+
+static std::size_t inSubnetV6(std::uint64_t const* const high, std::uint64_t const* const low, std::size_t const count, SubnetV6 const& subnet, std::uint8_t* const results) noexcept
+{
+	auto found = std::size_t{ 0u };
+	auto index = std::size_t{ 0u };
+#if defined(NIH_IPADDRESSARRAY_AVX2)
+	auto const mh = _mm256_set1_epi64x(static_cast<long long>(subnet.maskHigh));
+	auto const ml = _mm256_set1_epi64x(static_cast<long long>(subnet.maskLow));
+	auto const nh = _mm256_set1_epi64x(static_cast<long long>(subnet.networkHigh));
+	auto const nl = _mm256_set1_epi64x(static_cast<long long>(subnet.networkLow));
+	for (; index + 4u <= count; index += 4u)
+	{
+		auto const h = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(high + index));
+		auto const l = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(low + index));
+		auto const c = _mm256_and_si256(_mm256_cmpeq_epi64(_mm256_and_si256(h, mh), nh), _mm256_cmpeq_epi64(_mm256_and_si256(l, ml), nl));
+		found += storeResults(_mm256_movemask_pd(_mm256_castsi256_pd(c)), results + index, 4u);
+	}
+#elif defined(NIH_IPADDRESSARRAY_NEON)
+	auto const mh = vdupq_n_u64(subnet.maskHigh);
+	auto const ml = vdupq_n_u64(subnet.maskLow);
+	auto const nh = vdupq_n_u64(subnet.networkHigh);
+	auto const nl = vdupq_n_u64(subnet.networkLow);
+	for (; index + 2u <= count; index += 2u)
+	{
+		// Each lane is either 0 or 1
+		auto const c = vshrq_n_u64(vandq_u64(vceqq_u64(vandq_u64(vld1q_u64(high + index), mh), nh), vceqq_u64(vandq_u64(vld1q_u64(low + index), ml), nl)), 63);
+		results[index] = static_cast<std::uint8_t>(vgetq_lane_u64(c, 0));
+		results[index + 1u] = static_cast<std::uint8_t>(vgetq_lane_u64(c, 1));
+		found += static_cast<std::size_t>(vaddvq_u64(c));
+	}
+#endif
+	for (; index < count; ++index)
+	{
+		auto const isInSubnet = ((high[index] & subnet.maskHigh) == subnet.networkHigh) & ((low[index] & subnet.maskLow) == subnet.networkLow);
+		results[index] = static_cast<std::uint8_t>(isInSubnet);
+		found += static_cast<std::size_t>(isInSubnet);
+	}
+	return found;
+}
+
+static std::size_t countInSubnetsV4(std::uint32_t const* const data, std::size_t const count, std::vector<SubnetV4> const& subnets) noexcept
+{
+	auto found = std::size_t{ 0u };
+	auto index = std::size_t{ 0u };
+#if defined(NIH_IPADDRESSARRAY_AVX2)
+	for (; index + 8u <= count; index += 8u)
+	{
+		auto const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + index));
+		auto any = _mm256_setzero_si256();
+		for (auto const& subnet : subnets)
+		{
+			any = _mm256_or_si256(any, _mm256_cmpeq_epi32(_mm256_and_si256(v, _mm256_set1_epi32(static_cast<int>(subnet.mask))), _mm256_set1_epi32(static_cast<int>(subnet.network))));
+		}
+		auto const bits = static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(any)));
+		found += static_cast<std::size_t>((s_BitsToBytes[bits] * 0x0101010101010101ull) >> 56);
+	}
+#elif defined(NIH_IPADDRESSARRAY_NEON)
+	for (; index + 4u <= count; index += 4u)
+	{
+		auto const v = vld1q_u32(data + index);
+		auto any = vdupq_n_u32(0u);
+		for (auto const& subnet : subnets)
+		{
+			any = vorrq_u32(any, vceqq_u32(vandq_u32(v, vdupq_n_u32(subnet.mask)), vdupq_n_u32(subnet.network)));
+		}
+		found += vaddvq_u32(vshrq_n_u32(any, 31));
+	}
+#endif
+	for (; index < count; ++index)
+	{
+		auto any = false;
+		for (auto const& subnet : subnets)
+		{
+			any |= (data[index] & subnet.mask) == subnet.network;
+		}
+		found += static_cast<std::size_t>(any);
+	}
+	return found;
+}
+
+static std::size_t countInSubnetsV6(std::uint64_t const* const high, std::uint64_t const* const low, std::size_t const count, std::vector<SubnetV6> const& subnets) noexcept
+{
+	auto found = std::size_t{ 0u };
+	auto index = std::size_t{ 0u };
+#if defined(NIH_IPADDRESSARRAY_AVX2)
+	for (; index + 4u <= count; index += 4u)
+	{
+		auto const h = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(high + index));
+		auto const l = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(low + index));
+		auto any = _mm256_setzero_si256();
+		for (auto const& subnet : subnets)
+		{
+			auto const ch = _mm256_cmpeq_epi64(_mm256_and_si256(h, _mm256_set1_epi64x(static_cast<long long>(subnet.maskHigh))), _mm256_set1_epi64x(static_cast<long long>(subnet.networkHigh)));
+			auto const cl = _mm256_cmpeq_epi64(_mm256_and_si256(l, _mm256_set1_epi64x(static_cast<long long>(subnet.maskLow))), _mm256_set1_epi64x(static_cast<long long>(subnet.networkLow)));
+			any = _mm256_or_si256(any, _mm256_and_si256(ch, cl));
+		}
+		auto const bits = static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(any)));
+		found += static_cast<std::size_t>((s_BitsToBytes[bits] * 0x0101010101010101ull) >> 56);
+	}
+#elif defined(NIH_IPADDRESSARRAY_NEON)
+	for (; index + 2u <= count; index += 2u)
+	{
+		auto const h = vld1q_u64(high + index);
+		auto const l = vld1q_u64(low + index);
+		auto any = vdupq_n_u64(0u);
+		for (auto const& subnet : subnets)
+		{
+			auto const ch = vceqq_u64(vandq_u64(h, vdupq_n_u64(subnet.maskHigh)), vdupq_n_u64(subnet.networkHigh));
+			auto const cl = vceqq_u64(vandq_u64(l, vdupq_n_u64(subnet.maskLow)), vdupq_n_u64(subnet.networkLow));
+			any = vorrq_u64(any, vandq_u64(ch, cl));
+		}
+		found += static_cast<std::size_t>(vaddvq_u64(vshrq_n_u64(any, 63)));
+	}
+#endif
+	for (; index < count; ++index)
+	{
+		auto any = false;
+		for (auto const& subnet : subnets)
+		{
+			any |= ((high[index] & subnet.maskHigh) == subnet.networkHigh) & ((low[index] & subnet.maskLow) == subnet.networkLow);
+		}
+		found += static_cast<std::size_t>(any);
+	}
+	return found;
+}
+
+static SubnetV4 makeSubnetV4(IPAddressInfo const& subnet)
+{
+	auto const mask = subnet.netmask.getIPV4Packed();
+	return SubnetV4{ mask, subnet.address.getIPV4Packed() & mask };
+}
+
+static SubnetV6 makeSubnetV6(IPAddressInfo const& subnet)
+{
+	auto const mask = subnet.netmask.getIPV6Packed();
+	auto const address = subnet.address.getIPV6Packed();
+	return SubnetV6{ mask.first, mask.second, address.first & mask.first, address.second & mask.second };
+}
+
+/* ************************************************************ */
+/* IPAddressArray class definition                              */
+/* ************************************************************ */
+IPAddressArray::IPAddressArray(std::vector<IPAddress> const& addresses)
+{
+	for (auto const& ip : addresses)
+	{
+		add(ip);
+	}
+}
+
+void IPAddressArray::add(IPAddress const& ip)
+{
+	switch (ip.getType())
+	{
+		case IPAddress::Type::V4:
+			addV4(ip.getIPV4Packed());
+			break;
+		case IPAddress::Type::V6:
+			addV6(ip.getIPV6Packed());
+			break;
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+}
+
+void IPAddressArray::addV4(IPAddress::value_type_packed_v4 const ipv4)
+{
+	_v4.push_back(ipv4);
+}
+
+void IPAddressArray::addV6(IPAddress::value_type_packed_v6 const& ipv6)
+{
+	_v6High.push_back(ipv6.first);
+	_v6Low.push_back(ipv6.second);
+}
+
+void IPAddressArray::reserve(std::size_t const v4Count, std::size_t const v6Count)
+{
+	_v4.reserve(v4Count);
+	_v6High.reserve(v6Count);
+	_v6Low.reserve(v6Count);
+}
+
+void IPAddressArray::clear() noexcept
+{
+	_v4.clear();
+	_v6High.clear();
+	_v6Low.clear();
+}
+
+std::size_t IPAddressArray::size() const noexcept
+{
+	return _v4.size() + _v6High.size();
+}
+
+bool IPAddressArray::empty() const noexcept
+{
+	return _v4.empty() && _v6High.empty();
+}
+
+std::size_t IPAddressArray::getCount(IPAddress::Type const type) const noexcept
+{
+	switch (type)
+	{
+		case IPAddress::Type::V4:
+			return _v4.size();
+		case IPAddress::Type::V6:
+			return _v6High.size();
+		default:
+			return 0u;
+	}
+}
+
+IPAddress IPAddressArray::getV4(std::size_t const index) const
+{
+	if (index >= _v4.size())
+	{
+		throw std::invalid_argument("Invalid index");
+	}
+	return IPAddress{ _v4[index] };
+}
+
+IPAddress IPAddressArray::getV6(std::size_t const index) const
+{
+	if (index >= _v6High.size())
+	{
+		throw std::invalid_argument("Invalid index");
+	}
+	return IPAddress{ IPAddress::value_type_packed_v6{ _v6High[index], _v6Low[index] } };
+}
+
+IPAddress::value_type_packed_v4 const* IPAddressArray::getV4Data() const noexcept
+{
+	return _v4.data();
+}
+
+std::uint64_t const* IPAddressArray::getV6HighData() const noexcept
+{
+	return _v6High.data();
+}
+
+std::uint64_t const* IPAddressArray::getV6LowData() const noexcept
+{
+	return _v6Low.data();
+}
+
+void IPAddressArray::maskAll(IPAddress const& netmask)
+{
+	switch (netmask.getType())
+	{
+		case IPAddress::Type::V4:
+			maskV4(_v4.data(), _v4.size(), netmask.getIPV4Packed());
+			break;
+		case IPAddress::Type::V6:
+		{
+			auto const mask = netmask.getIPV6Packed();
+			maskV6(_v6High.data(), _v6Low.data(), _v6High.size(), mask.first, mask.second);
+			break;
+		}
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+}
+
+bool IPAddressArray::equalsAny(IPAddress const& ip) const noexcept
+{
+	switch (ip.getType())
+	{
+		case IPAddress::Type::V4:
+			return equalsAnyV4(_v4.data(), _v4.size(), ip.getIPV4Packed());
+		case IPAddress::Type::V6:
+		{
+			auto const value = ip.getIPV6Packed();
+			return equalsAnyV6(_v6High.data(), _v6Low.data(), _v6High.size(), value.first, value.second);
+		}
+		default:
+			return false;
+	}
+}
+
+std::size_t IPAddressArray::inSubnet(IPAddressInfo const& subnet, std::uint8_t* const results) const
+{
+	switch (validateIPAddressInfo(subnet.address, subnet.netmask))
+	{
+		case IPAddress::Type::V4:
+			return inSubnetV4(_v4.data(), _v4.size(), makeSubnetV4(subnet), results);
+		case IPAddress::Type::V6:
+			return inSubnetV6(_v6High.data(), _v6Low.data(), _v6High.size(), makeSubnetV6(subnet), results);
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+}
+
+std::size_t IPAddressArray::countInSubnets(std::vector<IPAddressInfo> const& subnets) const
+{
+	auto subnetsV4 = std::vector<SubnetV4>{};
+	auto subnetsV6 = std::vector<SubnetV6>{};
+	for (auto const& subnet : subnets)
+	{
+		switch (validateIPAddressInfo(subnet.address, subnet.netmask))
+		{
+			case IPAddress::Type::V4:
+				subnetsV4.push_back(makeSubnetV4(subnet));
+				break;
+			case IPAddress::Type::V6:
+				subnetsV6.push_back(makeSubnetV6(subnet));
+				break;
+			default:
+				throw std::invalid_argument("Invalid Type");
+		}
+	}
+
+	auto found = std::size_t{ 0u };
+	if (!subnetsV4.empty())
+	{
+		found += countInSubnetsV4(_v4.data(), _v4.size(), subnetsV4);
+	}
+	if (!subnetsV6.empty())
+	{
+		found += countInSubnetsV6(_v6High.data(), _v6Low.data(), _v6High.size(), subnetsV6);
+	}
+	return found;
+}
+
+char const* IPAddressArray::getKernelsInstructionSet() noexcept
+{
+#if defined(NIH_IPADDRESSARRAY_AVX2)
+	return "AVX2";
+#elif defined(NIH_IPADDRESSARRAY_NEON)
+	return "NEON";
+#else
+	return "Scalar";
+#endif
+}
+
+} // namespace networkInterface
+} // namespace la
@@ -39,37 +39,19 @@
 #include "networkInterfaceHelper_common.hpp"
 
 #include <stdexcept> // invalid_argument
+#include <system_error> // errc
+#include <optional>
+#include <array>
+#include <algorithm> // copy / min
+#include <charconv> // to_chars / from_chars
 
 namespace la
 {
 namespace networkInterface
 {
-static void checkValidIPAddressInfo(IPAddress const& address, IPAddress const& netmask)
-{
-	// Check if address and netmask types are identical
-	auto const addressType = address.getType();
-	if (addressType != netmask.getType())
-	{
-		throw std::invalid_argument("address and netmask not of the same Type");
-	}
-
-	// Check if netmask is contiguous
-	switch (addressType)
-	{
-		case IPAddress::Type::V4:
-			validateNetmaskV4(netmask);
-			break;
-		case IPAddress::Type::V6:
-			validateNetmaskV6(netmask);
-			break;
-		default:
-			throw std::invalid_argument("Invalid Type");
-	}
-}
-
 IPAddress IPAddressInfo::getNetworkBaseAddress() const
 {
-	checkValidIPAddressInfo(address, netmask);
+	validateIPAddressInfo(address, netmask);
 
 	switch (address.getType())
 	{
@@ -84,7 +66,7 @@ IPAddress IPAddressInfo::getNetworkBaseAddress() const
 
 IPAddress IPAddressInfo::getBroadcastAddress() const
 {
-	checkValidIPAddressInfo(address, netmask);
+	validateIPAddressInfo(address, netmask);
 
 	switch (address.getType())
 	{
@@ -101,7 +83,7 @@ IPAddress IPAddressInfo::getBroadcastAddress() const
 
 bool IPAddressInfo::isPrivateNetworkAddress() const
 {
-	checkValidIPAddressInfo(address, netmask);
+	validateIPAddressInfo(address, netmask);
 
 	switch (address.getType())
 	{
@@ -141,6 +123,106 @@ bool IPAddressInfo::isPrivateNetworkAddress() const
 	}
 }
 
+/** Returns the prefix length of a valid IPAddressInfo (same Type, contiguous netmask), without throwing */
+static std::optional<std::uint8_t> getPrefixLength(IPAddressInfo const& ipAddressInfo) noexcept
+{
+	auto const type = ipAddressInfo.address.getType();
+	if (type != ipAddressInfo.netmask.getType())
+	{
+		return std::nullopt;
+	}
+
+	switch (type)
+	{
+		case IPAddress::Type::V4:
+		{
+			auto const mask = ipAddressInfo.netmask.getIPV4Packed();
+			auto length = std::uint8_t{ 0u };
+			while (length < 32u && (mask & (IPAddress::value_type_packed_v4{ 0x80000000 } >> length)) != 0)
+			{
+				++length;
+			}
+			// Check the mask is contiguous (and not empty) by rebuilding it
+			if (length == 0u || makePackedMaskV4(length) != mask)
+			{
+				return std::nullopt;
+			}
+			return length;
+		}
+		case IPAddress::Type::V6:
+		{
+			auto const mask = ipAddressInfo.netmask.getIPV6Packed();
+			auto const length = IPAddress::prefixLengthFromPackedV6(mask);
+			// Check the mask is contiguous by rebuilding it
+			if (makePackedMaskV6(length) != mask)
+			{
+				return std::nullopt;
+			}
+			return length;
+		}
+		default:
+			return std::nullopt;
+	}
+}
+
+std::to_chars_result NetworkInterfaceHelper::ipAddressInfoToChars(char* const first, char* const last, IPAddressInfo const& ipAddressInfo) noexcept
+{
+	auto const prefixLength = getPrefixLength(ipAddressInfo);
+	if (!prefixLength)
+	{
+		return { first, std::errc::invalid_argument };
+	}
+
+	auto const [addressEnd, ec] = ipAddressToChars(first, last, ipAddressInfo.address);
+	if (ec != std::errc{})
+	{
+		return { addressEnd, ec };
+	}
+
+	// Separator and up to 3 digits
+	auto suffix = std::array<char, 4>{ '/' };
+	auto* const suffixEnd = std::to_chars(suffix.data() + 1, suffix.data() + suffix.size(), *prefixLength).ptr;
+	if ((last - addressEnd) < (suffixEnd - suffix.data()))
+	{
+		return { last, std::errc::value_too_large };
+	}
+	return { std::copy(suffix.data(), suffixEnd, addressEnd), std::errc{} };
+}
+
+std::from_chars_result NetworkInterfaceHelper::ipAddressInfoFromChars(char const* const first, char const* const last, IPAddressInfo& ipAddressInfo) noexcept
+{
+	auto address = IPAddress{};
+	auto const [addressEnd, ec] = ipAddressFromChars(first, last, address);
+	if (ec != std::errc{})
+	{
+		return { first, ec };
+	}
+
+	auto const isV4 = address.getType() == IPAddress::Type::V4;
+	auto const maxLength = isV4 ? 32u : 128u;
+	auto prefixLength = maxLength;
+	auto const* end = addressEnd;
+	if (end != last && *end == '/')
+	{
+		// Up to 3 digits, not followed by another digit, without leading zeros (only "0" itself may start with one)
+		auto const [lengthEnd, lengthEc] = std::from_chars(end + 1, std::min(last, end + 4), prefixLength);
+		if (lengthEc != std::errc{} || prefixLength > maxLength || (lengthEnd != last && *lengthEnd >= '0' && *lengthEnd <= '9') || (end[1] == '0' && lengthEnd != end + 2))
+		{
+			return { first, std::errc::invalid_argument };
+		}
+		end = lengthEnd;
+	}
+	// An empty V4 netmask is not valid
+	if (prefixLength == 0u && isV4)
+	{
+		return { first, std::errc::invalid_argument };
+	}
+
+	auto const length = static_cast<std::uint8_t>(prefixLength);
+	ipAddressInfo = IPAddressInfo{ address, isV4 ? IPAddress{ makePackedMaskV4(length) } : IPAddress{ makePackedMaskV6(length) } };
+	return { end, std::errc{} };
+}
+
 bool operator==(IPAddressInfo const& lhs, IPAddressInfo const& rhs) noexcept
 {
 	return (lhs.address == rhs.address) && (lhs.netmask == rhs.netmask);
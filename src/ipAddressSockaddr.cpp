@@ -0,0 +1,205 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+
+/**
+ * @file ipAddressSockaddr.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "networkInterfaceHelper_common.hpp"
+
+#include <stdexcept> // invalid_argument
+#include <cstring> // memcpy
+#include <array>
+
+#if defined(_WIN32)
+#	include <WinSock2.h>
+#	include <ws2tcpip.h>
+#else // !_WIN32
+#	include <sys/socket.h>
+#	include <netinet/in.h>
+#endif // _WIN32
+
+namespace la
+{
+namespace networkInterface
+{
+// Only the address bytes (always in network byte order) are accessed, so no byte order function (nor socket library) is required
+static_assert(sizeof(in_addr) == sizeof(IPAddress::value_type_v4), "Unexpected in_addr size");
+static_assert(sizeof(in6_addr) == 16u, "Unexpected in6_addr size");
+
+static IPAddress makeIPAddress(in6_addr const& ipv6, bool const normalizeMappedV4) noexcept
+{
+	auto bytes = std::array<std::uint8_t, 16>{};
+	std::memcpy(bytes.data(), &ipv6, bytes.size());
+
+	auto ip = IPAddress::value_type_v6{};
+	for (auto i = 0u; i < ip.size(); ++i)
+	{
+		ip[i] = static_cast<IPAddress::value_type_v6::value_type>((bytes[i * 2] << 8) | bytes[i * 2 + 1]);
+	}
+
+	// IPV4 mapped address (::ffff:a.b.c.d)
+	if (normalizeMappedV4 && ip[0] == 0 && ip[1] == 0 && ip[2] == 0 && ip[3] == 0 && ip[4] == 0 && ip[5] == 0xFFFF)
+	{
+		return IPAddress{ IPAddress::value_type_v4{ bytes[12], bytes[13], bytes[14], bytes[15] } };
+	}
+	return IPAddress{ ip };
+}
+
+static IPAddress makeIPAddress(sockaddr const& address, bool const normalizeMappedV4)
+{
+	switch (address.sa_family)
+	{
+		case AF_INET:
+			return IPAddress{ reinterpret_cast<sockaddr_in const&>(address) };
+		case AF_INET6:
+			return IPAddress{ reinterpret_cast<sockaddr_in6 const&>(address), normalizeMappedV4 };
+		default:
+			throw std::invalid_argument("Unsupported address family");
+	}
+}
+
+/** Writes the port in network byte order */
+template<typename PortType>
+static void setPort(PortType& out, std::uint16_t const port) noexcept
+{
+	static_assert(sizeof(PortType) == sizeof(port), "Unexpected port size");
+	auto const bytes = std::array<std::uint8_t, 2>{ static_cast<std::uint8_t>(port >> 8), static_cast<std::uint8_t>(port & 0xFF) };
+	std::memcpy(&out, bytes.data(), bytes.size());
+}
+
+IPAddress::IPAddress(in_addr const& ipv4) noexcept
+{
+	auto ip = value_type_v4{};
+	std::memcpy(ip.data(), &ipv4, ip.size());
+	setValue(ip);
+}
+
+IPAddress::IPAddress(in6_addr const& ipv6, bool const normalizeMappedV4) noexcept
+	: IPAddress{ makeIPAddress(ipv6, normalizeMappedV4) }
+{
+}
+
+IPAddress::IPAddress(sockaddr_in const& address) noexcept
+	: IPAddress{ address.sin_addr }
+{
+}
+
+IPAddress::IPAddress(sockaddr_in6 const& address, bool const normalizeMappedV4) noexcept
+	: IPAddress{ makeIPAddress(address.sin6_addr, normalizeMappedV4) }
+{
+}
+
+IPAddress::IPAddress(sockaddr const& address, bool const normalizeMappedV4)
+	: IPAddress{ makeIPAddress(address, normalizeMappedV4) }
+{
+}
+
+IPAddress::IPAddress(sockaddr_storage const& address, bool const normalizeMappedV4)
+	: IPAddress{ makeIPAddress(reinterpret_cast<sockaddr const&>(address), normalizeMappedV4) }
+{
+}
+
+in_addr IPAddress::getInAddr() const
+{
+	auto const ip = getIPV4();
+	auto addr = in_addr{};
+	std::memcpy(&addr, ip.data(), ip.size());
+	return addr;
+}
+
+in6_addr IPAddress::getIn6Addr() const
+{
+	auto const ip = getIPV6();
+	auto bytes = std::array<std::uint8_t, 16>{};
+	for (auto i = 0u; i < ip.size(); ++i)
+	{
+		bytes[i * 2] = static_cast<std::uint8_t>(ip[i] >> 8);
+		bytes[i * 2 + 1] = static_cast<std::uint8_t>(ip[i] & 0xFF);
+	}
+	auto addr = in6_addr{};
+	std::memcpy(&addr, bytes.data(), bytes.size());
+	return addr;
+}
+
+sockaddr_in IPAddress::getSockaddrIn(std::uint16_t const port) const
+{
+	auto address = sockaddr_in{};
+#if defined(__APPLE__)
+	address.sin_len = sizeof(address);
+#endif // __APPLE__
+	address.sin_family = AF_INET;
+	address.sin_addr = getInAddr();
+	setPort(address.sin_port, port);
+	return address;
+}
+
+sockaddr_in6 IPAddress::getSockaddrIn6(std::uint16_t const port) const
+{
+	auto address = sockaddr_in6{};
+#if defined(__APPLE__)
+	address.sin6_len = sizeof(address);
+#endif // __APPLE__
+	address.sin6_family = AF_INET6;
+	address.sin6_addr = getIn6Addr();
+	setPort(address.sin6_port, port);
+	return address;
+}
+
+sockaddr_storage IPAddress::getSockaddrStorage(std::uint16_t const port) const
+{
+	auto storage = sockaddr_storage{};
+	switch (_type)
+	{
+		case Type::V4:
+		{
+			auto const address = getSockaddrIn(port);
+			std::memcpy(&storage, &address, sizeof(address));
+			break;
+		}
+		case Type::V6:
+		{
+			auto const address = getSockaddrIn6(port);
+			std::memcpy(&storage, &address, sizeof(address));
+			break;
+		}
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+	return storage;
+}
+
+} // namespace networkInterface
+} // namespace la
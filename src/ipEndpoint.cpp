@@ -0,0 +1,291 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+ * @file ipEndpoint.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "la/networkInterfaceHelper/ipEndpoint.hpp"
+#include "networkInterfaceHelper_common.hpp"
+
+#include <stdexcept> // invalid_argument
+#include <cstring> // memcpy
+#include <algorithm> // find
+#include <array>
+#include <charconv> // to_chars / from_chars
+
+#if defined(_WIN32)
+#	include <WinSock2.h>
+#	include <ws2tcpip.h>
+#else // !_WIN32
+#	include <sys/socket.h>
+#	include <netinet/in.h>
+#endif // _WIN32
+
+namespace la
+{
+namespace networkInterface
+{
+/** Reads a port stored in network byte order */
+template<typename PortType>
+static std::uint16_t readPort(PortType const& port) noexcept
+{
+	static_assert(sizeof(PortType) == sizeof(std::uint16_t), "Unexpected port size");
+	auto bytes = std::array<std::uint8_t, 2>{};
+	std::memcpy(bytes.data(), &port, bytes.size());
+	return static_cast<std::uint16_t>((bytes[0] << 8) | bytes[1]);
+}
+
+static IPEndpoint makeIPEndpoint(sockaddr const& address, bool const normalizeMappedV4)
+{
+	switch (address.sa_family)
+	{
+		case AF_INET:
+			return IPEndpoint{ reinterpret_cast<sockaddr_in const&>(address) };
+		case AF_INET6:
+			return IPEndpoint{ reinterpret_cast<sockaddr_in6 const&>(address), normalizeMappedV4 };
+		default:
+			throw std::invalid_argument("Unsupported address family");
+	}
+}
+
+IPEndpoint::IPEndpoint(IPAddress const& address, std::uint16_t const port, std::uint32_t const scopeId)
+	: _address{ address }
+	, _port{ port }
+	, _scopeId{ scopeId }
+{
+	switch (address.getType())
+	{
+		case IPAddress::Type::V4:
+			if (scopeId != 0u)
+			{
+				throw std::invalid_argument("Scope id is only supported for V6 addresses");
+			}
+			break;
+		case IPAddress::Type::V6:
+			break;
+		default:
+			throw std::invalid_argument("Invalid IPAddress");
+	}
+}
+
+IPEndpoint::IPEndpoint(sockaddr_in const& address) noexcept
+	: _address{ address.sin_addr }
+	, _port{ readPort(address.sin_port) }
+{
+}
+
+IPEndpoint::IPEndpoint(sockaddr_in6 const& address, bool const normalizeMappedV4) noexcept
+	: _address{ address.sin6_addr, normalizeMappedV4 }
+	, _port{ readPort(address.sin6_port) }
+{
+	// The scope id is meaningless for a normalized V4 address
+	if (_address.getType() == IPAddress::Type::V6)
+	{
+		_scopeId = address.sin6_scope_id;
+	}
+}
+
+IPEndpoint::IPEndpoint(sockaddr const& address, bool const normalizeMappedV4)
+	: IPEndpoint{ makeIPEndpoint(address, normalizeMappedV4) }
+{
+}
+
+IPEndpoint::IPEndpoint(sockaddr_storage const& address, bool const normalizeMappedV4)
+	: IPEndpoint{ makeIPEndpoint(reinterpret_cast<sockaddr const&>(address), normalizeMappedV4) }
+{
+}
+
+sockaddr_storage IPEndpoint::getSockaddrStorage() const
+{
+	auto storage = _address.getSockaddrStorage(_port);
+	if (_address.getType() == IPAddress::Type::V6)
+	{
+		auto address = sockaddr_in6{};
+		std::memcpy(&address, &storage, sizeof(address));
+		address.sin6_scope_id = _scopeId;
+		std::memcpy(&storage, &address, sizeof(address));
+	}
+	return storage;
+}
+
+std::size_t IPEndpoint::getSockaddrLength() const noexcept
+{
+	switch (_address.getType())
+	{
+		case IPAddress::Type::V4:
+			return sizeof(sockaddr_in);
+		case IPAddress::Type::V6:
+			return sizeof(sockaddr_in6);
+		default:
+			return 0u;
+	}
+}
+
+std::to_chars_result NetworkInterfaceHelper::ipEndpointToChars(char* const first, char* const last, IPEndpoint const& endpoint) noexcept
+{
+	if (!endpoint.isValid())
+	{
+		return { first, std::errc::invalid_argument };
+	}
+
+	auto const tooLarge = std::to_chars_result{ last, std::errc::value_too_large };
+	auto const isV6 = endpoint.getAddress().getType() == IPAddress::Type::V6;
+	auto* ptr = first;
+
+	if (isV6)
+	{
+		if (ptr == last)
+		{
+			return tooLarge;
+		}
+		*ptr++ = '[';
+	}
+
+	auto const result = ipAddressToChars(ptr, last, endpoint.getAddress());
+	if (result.ec != std::errc{})
+	{
+		return result;
+	}
+	ptr = result.ptr;
+
+	if (isV6)
+	{
+		if (endpoint.getScopeId() != 0u)
+		{
+			if (ptr == last)
+			{
+				return tooLarge;
+			}
+			*ptr++ = '%';
+			auto const [scopeEnd, ec] = std::to_chars(ptr, last, endpoint.getScopeId());
+			if (ec != std::errc{})
+			{
+				return tooLarge;
+			}
+			ptr = scopeEnd;
+		}
+		if (ptr == last)
+		{
+			return tooLarge;
+		}
+		*ptr++ = ']';
+	}
+
+	if (ptr == last)
+	{
+		return tooLarge;
+	}
+	*ptr++ = ':';
+	auto const [portEnd, ec] = std::to_chars(ptr, last, endpoint.getPort());
+	if (ec != std::errc{})
+	{
+		return tooLarge;
+	}
+	return { portEnd, std::errc{} };
+}
+
+std::from_chars_result NetworkInterfaceHelper::ipEndpointFromChars(char const* const first, char const* const last, IPEndpoint& endpoint) const noexcept
+{
+	auto const invalid = std::from_chars_result{ first, std::errc::invalid_argument };
+	auto address = IPAddress{};
+	auto scopeId = std::uint32_t{ 0u };
+	auto const* ptr = first;
+
+	// V6 addresses must be bracketed (the port separator being ambiguous otherwise)
+	if (ptr != last && *ptr == '[')
+	{
+		auto const result = ipAddressFromChars(ptr + 1, last, address);
+		if (result.ec != std::errc{} || address.getType() != IPAddress::Type::V6)
+		{
+			return invalid;
+		}
+		ptr = result.ptr;
+
+		// Optional zone, either a numeric scope id or the name of an interface
+		if (ptr != last && *ptr == '%')
+		{
+			auto const* const zoneFirst = ptr + 1;
+			auto const* const zoneLast = std::find(zoneFirst, last, ']');
+			if (zoneLast == zoneFirst || zoneLast == last)
+			{
+				return invalid;
+			}
+			auto const [zoneEnd, ec] = std::from_chars(zoneFirst, zoneLast, scopeId);
+			if (ec != std::errc{} || zoneEnd != zoneLast)
+			{
+				scopeId = getInterfaceIndex(std::string_view{ zoneFirst, static_cast<std::size_t>(zoneLast - zoneFirst) });
+			}
+			if (scopeId == 0u)
+			{
+				return invalid;
+			}
+			ptr = zoneLast;
+		}
+
+		if (ptr == last || *ptr != ']')
+		{
+			return invalid;
+		}
+		++ptr;
+	}
+	else
+	{
+		auto const result = ipAddressFromChars(ptr, last, address);
+		if (result.ec != std::errc{} || address.getType() != IPAddress::Type::V4)
+		{
+			return invalid;
+		}
+		ptr = result.ptr;
+	}
+
+	// Port
+	if (ptr == last || *ptr != ':')
+	{
+		return invalid;
+	}
+	++ptr;
+	auto port = std::uint16_t{ 0u };
+	auto const [portEnd, ec] = std::from_chars(ptr, last, port);
+	if (ec != std::errc{})
+	{
+		return invalid;
+	}
+
+	endpoint = IPEndpoint{ address, port, scopeId };
+	return { portEnd, std::errc{} };
+}
+
+} // namespace networkInterface
+} // namespace la
@@ -0,0 +1,163 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+
+/**
+ * @file ipPrefix.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "la/networkInterfaceHelper/ipPrefix.hpp"
+#include "networkInterfaceHelper_common.hpp"
+
+#include <stdexcept> // invalid_argument
+
+namespace la
+{
+namespace networkInterface
+{
+static IPPrefix makePrefix(IPAddress const& address, std::uint8_t const prefixLength)
+{
+	switch (address.getType())
+	{
+		case IPAddress::Type::V4:
+			return IPPrefix::fromPackedV4(address.getIPV4Packed(), prefixLength);
+		case IPAddress::Type::V6:
+			return IPPrefix::fromPackedV6(address.getIPV6Packed(), prefixLength);
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+}
+
+static std::uint8_t prefixLengthFromNetmask(IPAddress const& netmask)
+{
+	// Netmask has already been validated (contiguous)
+	switch (netmask.getType())
+	{
+		case IPAddress::Type::V4:
+		{
+			auto packed = netmask.getIPV4Packed();
+			auto length = std::uint8_t{ 0u };
+			while (packed != 0)
+			{
+				++length;
+				packed <<= 1;
+			}
+			return length;
+		}
+		case IPAddress::Type::V6:
+			return IPAddress::prefixLengthFromPackedV6(netmask.getIPV6Packed());
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+}
+
+static IPPrefix makePrefix(IPAddressInfo const& info)
+{
+	validateIPAddressInfo(info.address, info.netmask);
+	return makePrefix(info.address, prefixLengthFromNetmask(info.netmask));
+}
+
+static IPAddress makeIPAddress(IPAddress::Type const type, UInt128 const& value) noexcept
+{
+	switch (type)
+	{
+		case IPAddress::Type::V4:
+			return IPAddress{ static_cast<IPAddress::value_type_packed_v4>(value.low) };
+		case IPAddress::Type::V6:
+			return IPAddress{ IPAddress::value_type_packed_v6{ value.high, value.low } };
+		default:
+			return IPAddress{};
+	}
+}
+
+IPPrefix::IPPrefix(IPAddress const& address, std::uint8_t const prefixLength)
+	: IPPrefix{ makePrefix(address, prefixLength) }
+{
+}
+
+IPPrefix::IPPrefix(IPAddressInfo const& info)
+	: IPPrefix{ makePrefix(info) }
+{
+}
+
+bool IPPrefix::contains(IPAddress const& ip) const noexcept
+{
+	switch (ip.getType())
+	{
+		case IPAddress::Type::V4:
+			return contains(ip.getIPV4Packed());
+		case IPAddress::Type::V6:
+			return contains(ip.getIPV6Packed());
+		default:
+			return false;
+	}
+}
+
+IPAddress IPPrefix::getAddress() const noexcept
+{
+	return makeIPAddress(_type, getAddressValue());
+}
+
+IPAddress IPPrefix::getNetmask() const noexcept
+{
+	return makeIPAddress(_type, getNetmaskValue());
+}
+
+IPAddress IPPrefix::getNetworkAddress() const noexcept
+{
+	return makeIPAddress(_type, getNetworkValue());
+}
+
+IPAddress IPPrefix::getBroadcastAddress() const noexcept
+{
+	return makeIPAddress(_type, getBroadcastValue());
+}
+
+IPAddress IPPrefix::getFirstHostAddress() const noexcept
+{
+	return makeIPAddress(_type, getFirstHostValue());
+}
+
+IPAddress IPPrefix::getLastHostAddress() const noexcept
+{
+	return makeIPAddress(_type, getLastHostValue());
+}
+
+IPAddressInfo IPPrefix::toIPAddressInfo() const noexcept
+{
+	return IPAddressInfo{ getAddress(), getNetmask() };
+}
+
+} // namespace networkInterface
+} // namespace la
@@ -0,0 +1,238 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+ * @file macAddress.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "networkInterfaceHelper_common.hpp"
+#include "la/networkInterfaceHelper/packedMacAddress.hpp"
+
+#include <stdexcept> // invalid_argument
+#include <system_error> // errc
+#include <array>
+
+namespace la
+{
+namespace networkInterface
+{
+/** Separator and number of bytes between separators of a notation */
+struct NotationFormat
+{
+	char separator{ '\0' };
+	std::size_t bytesPerGroup{ 0u };
+};
+
+static constexpr NotationFormat getNotationFormat(MacAddressNotation const notation) noexcept
+{
+	switch (notation)
+	{
+		case MacAddressNotation::Colon:
+			return { ':', 1u };
+		case MacAddressNotation::Dash:
+			return { '-', 1u };
+		case MacAddressNotation::CiscoDotted:
+			return { '.', 2u };
+		default:
+			return { '\0', 6u };
+	}
+}
+
+/** Writes the hex digits of the MAC address, inserting 'separator' (if not \0) every 'bytesPerGroup' bytes. Returns the end of the written characters. */
+static char* writeMacAddress(char* out, MacAddress const& macAddress, bool const upperCase, char const separator, std::size_t const bytesPerGroup) noexcept
+{
+	auto const* const digits = upperCase ? UpperHexDigits : LowerHexDigits;
+	for (auto index = 0u; index < macAddress.size(); ++index)
+	{
+		if (index != 0u && separator != '\0' && (index % bytesPerGroup) == 0u)
+		{
+			*out++ = separator;
+		}
+		*out++ = digits[macAddress[index] >> 4];
+		*out++ = digits[macAddress[index] & 0x0F];
+	}
+	return out;
+}
+
+/** Reads the hex digits of a MAC address written by writeMacAddress (the caller must ensure enough characters are available). Returns false if any character is not valid. */
+static bool readMacAddress(char const* in, MacAddress& macAddress, char const separator, std::size_t const bytesPerGroup) noexcept
+{
+	auto result = MacAddress{};
+	for (auto index = 0u; index < result.size(); ++index)
+	{
+		if (index != 0u && separator != '\0' && (index % bytesPerGroup) == 0u)
+		{
+			if (*in++ != separator)
+			{
+				return false;
+			}
+		}
+		auto const high = HexDigitValues[static_cast<unsigned char>(*in++)];
+		auto const low = HexDigitValues[static_cast<unsigned char>(*in++)];
+		if (high == InvalidHexDigit || low == InvalidHexDigit)
+		{
+			return false;
+		}
+		result[index] = static_cast<std::uint8_t>((high << 4) | low);
+	}
+	macAddress = result;
+	return true;
+}
+
+std::string NetworkInterfaceHelper::macAddressToString(MacAddress const& macAddress, bool const upperCase, char const separator) noexcept
+{
+	try
+	{
+		auto buffer = std::array<char, 17>{};
+		auto* const end = writeMacAddress(buffer.data(), macAddress, upperCase, separator, 1u);
+		return std::string(buffer.data(), end);
+	}
+	catch (...)
+	{
+		return {};
+	}
+}
+
+MacAddress NetworkInterfaceHelper::stringToMacAddress(std::string const& macAddressAsString, char const separator)
+{
+	auto const expectedLength = separator == '\0' ? std::size_t{ 12u } : std::size_t{ 17u };
+
+	auto out = MacAddress{};
+	if (macAddressAsString.size() != expectedLength || !readMacAddress(macAddressAsString.data(), out, separator, 1u))
+	{
+		throw std::invalid_argument("Invalid MacAddress representation: " + macAddressAsString);
+	}
+
+	return out;
+}
+
+bool NetworkInterfaceHelper::isMacAddressValid(MacAddress const& macAddress) noexcept
+{
+	return PackedMacAddress{ macAddress }.isValid();
+}
+
+std::to_chars_result NetworkInterfaceHelper::macAddressToChars(char* const first, char* const last, MacAddress const& macAddress, MacAddressNotation const notation, bool const upperCase) noexcept
+{
+	auto const length = getMacAddressCharsLength(notation);
+	if (length == 0u || static_cast<std::size_t>(last - first) < length)
+	{
+		return { last, std::errc::value_too_large };
+	}
+
+	auto const format = getNotationFormat(notation);
+	return { writeMacAddress(first, macAddress, upperCase, format.separator, format.bytesPerGroup), std::errc{} };
+}
+
+std::from_chars_result NetworkInterfaceHelper::macAddressFromChars(char const* const first, char const* const last, MacAddress& macAddress, MacAddressNotation const notation) noexcept
+{
+	auto const length = getMacAddressCharsLength(notation);
+	auto const format = getNotationFormat(notation);
+	if (length == 0u || static_cast<std::size_t>(last - first) < length || !readMacAddress(first, macAddress, format.separator, format.bytesPerGroup))
+	{
+		return { first, std::errc::invalid_argument };
+	}
+
+	return { first + length, std::errc{} };
+}
+
+std::from_chars_result NetworkInterfaceHelper::macAddressFromChars(char const* const first, char const* const last, MacAddress& macAddress) noexcept
+{
+	auto const available = static_cast<std::size_t>(last - first);
+
+	// Detect the notation from the first separator
+	auto notation = MacAddressNotation::Bare;
+	if (available > 2u && first[2] == ':')
+	{
+		notation = MacAddressNotation::Colon;
+	}
+	else if (available > 2u && first[2] == '-')
+	{
+		notation = MacAddressNotation::Dash;
+	}
+	else if (available > 4u && first[4] == '.')
+	{
+		notation = MacAddressNotation::CiscoDotted;
+	}
+
+	return macAddressFromChars(first, last, macAddress, notation);
+}
+
+std::to_chars_result NetworkInterfaceHelper::macAddressesToChars(char* const first, char* const last, MacAddress const* const macAddresses, std::size_t const count, char const delimiter, MacAddressNotation const notation, bool const upperCase) noexcept
+{
+	auto const length = getMacAddressCharsLength(notation);
+	if (length == 0u || static_cast<std::size_t>(last - first) / (length + 1u) < count)
+	{
+		return { last, std::errc::value_too_large };
+	}
+
+	auto const format = getNotationFormat(notation);
+	auto* out = first;
+	for (auto index = std::size_t{ 0u }; index < count; ++index)
+	{
+		out = writeMacAddress(out, macAddresses[index], upperCase, format.separator, format.bytesPerGroup);
+		*out++ = delimiter;
+	}
+	return { out, std::errc{} };
+}
+
+std::size_t NetworkInterfaceHelper::macAddressesFromChars(char const* const first, char const* const last, MacAddress* const macAddresses, std::size_t const count, char const delimiter, MacAddressNotation const notation) noexcept
+{
+	auto const length = getMacAddressCharsLength(notation);
+	auto const format = getNotationFormat(notation);
+	auto const* in = first;
+	auto parsed = std::size_t{ 0u };
+	while (parsed < count && length != 0u && static_cast<std::size_t>(last - in) >= length)
+	{
+		if (!readMacAddress(in, macAddresses[parsed], format.separator, format.bytesPerGroup))
+		{
+			break;
+		}
+		in += length;
+		++parsed;
+
+		// Each record must be followed by the delimiter, except at the end of the buffer
+		if (in != last)
+		{
+			if (*in != delimiter)
+			{
+				break;
+			}
+			++in;
+		}
+	}
+	return parsed;
+}
+
+} // namespace networkInterface
+} // namespace la
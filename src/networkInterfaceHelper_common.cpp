@@ -37,16 +37,24 @@
  */
 
 #include "networkInterfaceHelper_common.hpp"
+#include "tracePoints.hpp"
 
-#include <sstream>
 #include <stdexcept> // invalid_argument
-#include <iomanip> // setfill
-#include <ios> // uppercase
-#include <algorithm> // remove / copy
+#include <algorithm> // sort / max
 #include <string>
 #include <mutex>
 #include <vector>
-#include <set>
+#include <map>
+#include <unordered_set>
+#include <optional>
+#include <condition_variable>
+#include <chrono>
+#include <atomic>
+#include <array>
+#include <deque>
+#include <thread>
+#include <functional>
+#include <tuple> // apply
 
 #if defined(_WIN32)
 #	include <Windows.h>
@@ -100,12 +108,283 @@ void setCurrentThreadName(std::string const& name) noexcept
 }
 } // namespace utils
 
+class NetworkInterfaceHelperImpl;
+
+/** All living helper instances, so an Observer can unregister itself from all of them */
+struct HelperInstances
+{
+	std::mutex lock{};
+	std::condition_variable unregistrationsCompleted{};
+	std::unordered_set<NetworkInterfaceHelperImpl*> helpers{};
+	std::size_t pendingUnregistrations{ 0u }; /** Number of Observers currently unregistering from a copy of 'helpers' (outside the lock) */
+};
+
+static HelperInstances& getHelperInstances() noexcept
+{
+	// Never destroyed, so Observers can safely be destroyed during static destruction
+	static auto* const s_Instances = new HelperInstances{};
+
+	return *s_Instances;
+}
+
+/** Recursive mutex able to tell if it is held by the calling thread (to detect calls that would deadlock, like waiting from an Observer) */
+class OwnedRecursiveMutex
+{
+public:
+	void lock()
+	{
+		_mutex.lock();
+		setOwned();
+	}
+
+	bool try_lock()
+	{
+		if (!_mutex.try_lock())
+		{
+			return false;
+		}
+		setOwned();
+		return true;
+	}
+
+	void unlock()
+	{
+		if (--_depth == 0u)
+		{
+			_owner.store(std::thread::id{}, std::memory_order_relaxed);
+		}
+		_mutex.unlock();
+	}
+
+	bool isOwnedByCurrentThread() const noexcept
+	{
+		// Only the owning thread can have stored its own id
+		return _owner.load(std::memory_order_relaxed) == std::this_thread::get_id();
+	}
+
+private:
+	void setOwned() noexcept
+	{
+		if (_depth++ == 0u)
+		{
+			_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+		}
+	}
+
+	std::recursive_mutex _mutex{};
+	std::size_t _depth{ 0u }; // Only accessed while holding _mutex
+	std::atomic<std::thread::id> _owner{};
+};
+
+/** Lock-free version of Statistics::Histogram, values can be recorded from any thread */
+class AtomicHistogram
+{
+public:
+	using Histogram = NetworkInterfaceHelper::Statistics::Histogram;
+
+	void record(std::chrono::nanoseconds const duration) noexcept
+	{
+		auto const value = static_cast<std::uint64_t>(std::max(duration.count(), decltype(duration.count()){ 0 }));
+		_buckets[Histogram::getBucketIndex(value)].fetch_add(1u, std::memory_order_relaxed);
+		_count.fetch_add(1u, std::memory_order_relaxed);
+		_sum.fetch_add(value, std::memory_order_relaxed);
+		auto previousMax = _max.load(std::memory_order_relaxed);
+		while (previousMax < value && !_max.compare_exchange_weak(previousMax, value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	/** Returns a copy of the histogram (not atomic as a whole, values recorded during the copy may be partially accounted) */
+	Histogram load() const noexcept
+	{
+		auto histogram = Histogram{};
+		histogram.count = _count.load(std::memory_order_relaxed);
+		histogram.sum = _sum.load(std::memory_order_relaxed);
+		histogram.max = _max.load(std::memory_order_relaxed);
+		for (auto index = 0u; index < Histogram::BucketsCount; ++index)
+		{
+			histogram.buckets[index] = _buckets[index].load(std::memory_order_relaxed);
+		}
+		return histogram;
+	}
+
+private:
+	std::atomic<std::uint64_t> _count{ 0u };
+	std::atomic<std::uint64_t> _sum{ 0u };
+	std::atomic<std::uint64_t> _max{ 0u };
+	std::array<std::atomic<std::uint64_t>, Histogram::BucketsCount> _buckets{};
+};
+
+/** Internal metrics of a helper, exposed through NetworkInterfaceHelper::getStatistics */
+struct Metrics
+{
+	std::atomic<std::uint64_t> fullRefreshCount{ 0u };
+	std::atomic<std::uint64_t> interfaceRefreshCount{ 0u };
+	AtomicHistogram refreshDurations{};
+	AtomicHistogram diffDurations{};
+	AtomicHistogram lockWaitDurations{};
+	std::atomic<std::uint64_t> interfaceAddedEvents{ 0u };
+	std::atomic<std::uint64_t> interfaceRemovedEvents{ 0u };
+	std::atomic<std::uint64_t> enabledStateChangedEvents{ 0u };
+	std::atomic<std::uint64_t> connectedStateChangedEvents{ 0u };
+	std::atomic<std::uint64_t> aliasChangedEvents{ 0u };
+	std::atomic<std::uint64_t> ipAddressInfosChangedEvents{ 0u };
+	std::atomic<std::uint64_t> gatewaysChangedEvents{ 0u };
+};
+
+/** Dispatches the notifications of an isolated observer from its own thread, so it cannot block the helper and the other observers anymore */
+class IsolatedObserverDispatcher
+{
+public:
+	using Task = std::function<void()>;
+
+	static constexpr std::size_t MaxPendingTasks = 1024u;
+
+	/** Starts the dispatch thread, 'firstTask' being run before any pushed task. Throws if the thread cannot be created. */
+	explicit IsolatedObserverDispatcher(Task&& firstTask)
+	{
+		_state->tasks.push_back(std::move(firstTask));
+		_thread = std::thread(
+			[state = _state]()
+			{
+				utils::setCurrentThreadName("networkInterfaceHelper::IsolatedObserver");
+
+				// Lock
+				auto lock = std::unique_lock(state->lock);
+				while (true)
+				{
+					state->condition.wait(lock,
+						[&state]()
+						{
+							return state->shouldTerminate || !state->tasks.empty();
+						});
+					if (state->shouldTerminate)
+					{
+						return;
+					}
+
+					// Run the task outside the lock, so new ones can be pushed meanwhile
+					auto task = std::move(state->tasks.front());
+					state->tasks.pop_front();
+					lock.unlock();
+					try
+					{
+						task();
+					}
+					catch (...)
+					{
+						// Ignore exceptions
+					}
+					lock.lock();
+				}
+			});
+	}
+
+	/** Stops the dispatch thread, discarding pending tasks. Waits for the running task to complete, unless called from that task. */
+	~IsolatedObserverDispatcher() noexcept
+	{
+		{
+			// Lock
+			auto const lg = std::lock_guard(_state->lock);
+			_state->shouldTerminate = true;
+			_state->tasks.clear();
+		}
+		_state->condition.notify_all();
+
+		// The state is shared with the thread, so it can safely complete the running task after being detached
+		if (_thread.get_id() == std::this_thread::get_id())
+		{
+			_thread.detach();
+		}
+		else
+		{
+			_thread.join();
+		}
+	}
+
+	/** Queues a task. If MaxPendingTasks tasks are already pending (the observer doesn't keep up), the oldest one is dropped. */
+	void push(Task&& task) noexcept
+	{
+		{
+			// Lock
+			auto const lg = std::lock_guard(_state->lock);
+			try
+			{
+				_state->tasks.push_back(std::move(task));
+				if (_state->tasks.size() > MaxPendingTasks)
+				{
+					_state->tasks.pop_front();
+					++_state->droppedTasksCount;
+				}
+			}
+			catch (...)
+			{
+				// Failed to allocate, the notification is lost
+				++_state->droppedTasksCount;
+			}
+		}
+		_state->condition.notify_one();
+	}
+
+	/** Returns the number of tasks dropped because the queue was full */
+	std::uint64_t getDroppedTasksCount() const noexcept
+	{
+		// Lock
+		auto const lg = std::lock_guard(_state->lock);
+		return _state->droppedTasksCount;
+	}
+
+	// Deleted compiler auto-generated methods
+	IsolatedObserverDispatcher(IsolatedObserverDispatcher const&) = delete;
+	IsolatedObserverDispatcher(IsolatedObserverDispatcher&&) = delete;
+	IsolatedObserverDispatcher& operator=(IsolatedObserverDispatcher const&) = delete;
+	IsolatedObserverDispatcher& operator=(IsolatedObserverDispatcher&&) = delete;
+
+private:
+	struct State
+	{
+		std::mutex lock{};
+		std::condition_variable condition{};
+		std::deque<Task> tasks{}; // At most MaxPendingTasks
+		std::uint64_t droppedTasksCount{ 0u };
+		bool shouldTerminate{ false };
+	};
+
+	std::shared_ptr<State> _state{ std::make_shared<State>() };
+	std::thread _thread{};
+};
+
 class NetworkInterfaceHelperImpl final : public NetworkInterfaceHelper, public CommonDelegate
 {
 public:
-	NetworkInterfaceHelperImpl() noexcept {}
+	NetworkInterfaceHelperImpl() noexcept
+	{
+		addToHelperInstances();
+	}
+
+	/** Constructor using the specified factory to create the OS-dependent delegate (which may throw) */
+	template<typename DelegateFactory>
+	explicit NetworkInterfaceHelperImpl(DelegateFactory&& factory)
+		: _osDependentDelegate{ factory(*this) }
+	{
+		addToHelperInstances();
+	}
+
 	virtual ~NetworkInterfaceHelperImpl() noexcept
 	{
+		// Remove from the instances first, so destroyed Observers don't try to access us anymore, then wait for Observers still unregistering from a previous copy of the instances
+		{
+			auto& instances = getHelperInstances();
+			// Lock
+			auto lock = std::unique_lock(instances.lock);
+			instances.helpers.erase(this);
+			instances.unregistrationsCompleted.wait(lock,
+				[&instances]()
+				{
+					return instances.pendingUnregistrations == 0u;
+				});
+		}
+
 		// Destroy OS-Dependent delegate, preventing any new events from triggering after we get destroyed
 		_osDependentDelegate = nullptr;
 	}
@@ -118,10 +397,10 @@ public:
 		}
 
 		// Wait until first enumeration occured
-		_osDependentDelegate->waitForFirstEnumeration();
+		waitForFirstEnumeration();
 
 		// Lock
-		auto const lg = std::lock_guard(_lock);
+		auto const lg = lockAndMeasureWait();
 
 		// Now enumerate all interfaces
 		for (auto const& intfcKV : _networkInterfaces)
@@ -140,10 +419,10 @@ public:
 	Interface getInterfaceByName(std::string const& name) const
 	{
 		// Wait until first enumeration occured
-		_osDependentDelegate->waitForFirstEnumeration();
+		waitForFirstEnumeration();
 
 		// Lock
-		auto const lg = std::lock_guard(_lock);
+		auto const lg = lockAndMeasureWait();
 
 		// Search specified interface name in the list
 		auto const it = _networkInterfaces.find(name);
@@ -154,15 +433,64 @@ public:
 		return it->second;
 	}
 
-	void registerObserver(Observer* const observer) noexcept
+	std::uint32_t getInterfaceIndex(std::string_view const name) const
 	{
 		// Wait until first enumeration occured
-		_osDependentDelegate->waitForFirstEnumeration();
+		waitForFirstEnumeration();
+
+		// Lock
+		auto const lg = lockAndMeasureWait();
+
+		// Search specified name in the list (few interfaces, compare without building a std::string key), an exact id taking precedence over an alias
+		for (auto const& [id, intfc] : _networkInterfaces)
+		{
+			if (id == name)
+			{
+				return intfc.index;
+			}
+		}
+		for (auto const& intfcKV : _networkInterfaces)
+		{
+			if (intfcKV.second.alias == name)
+			{
+				return intfcKV.second.index;
+			}
+		}
+		return 0u;
+	}
+
+	InterfacesSnapshot takeSnapshot() const
+	{
+		// Wait until first enumeration occured
+		waitForFirstEnumeration();
+
+		// Lock
+		auto const lg = lockAndMeasureWait();
+
+		// Build the snapshot with interfaces sorted by id
+		auto interfaces = std::vector<Interface const*>{};
+		interfaces.reserve(_networkInterfaces.size());
+		for (auto const& intfcKV : _networkInterfaces)
+		{
+			interfaces.push_back(&intfcKV.second);
+		}
+		std::sort(interfaces.begin(), interfaces.end(),
+			[](Interface const* const lhs, Interface const* const rhs)
+			{
+				return lhs->id < rhs->id;
+			});
+		return InterfacesSnapshot::build(interfaces);
+	}
+
+	void registerObserver(Observer* const observer, std::optional<InterfaceFilter>&& filter) noexcept
+	{
+		// Wait until first enumeration occured
+		waitForFirstEnumeration();
 
 		auto isFirst = false;
 		{
 			// Lock
-			auto const lg = std::lock_guard(_lock);
+			auto const lg = lockAndMeasureWait();
 
 			// Check if not null
 			if (observer == nullptr)
@@ -176,22 +504,30 @@ public:
 				return;
 			}
 
-			isFirst = _observers.empty();
+			isFirst = _observers.empty() && _waitersCount == 0u;
 
 			// Add observer
-			_observers.insert(observer);
+			auto& info = _observers[observer];
+			info.filter = std::move(filter);
 
 			// Now call the observer for all interfaces
 			for (auto const& intfcKV : _networkInterfaces)
 			{
-				try
-				{
-					observer->onInterfaceAdded(intfcKV.second);
-				}
-				catch (...)
+				if (info.filter)
 				{
-					// Ignore exceptions
+					if (!info.filter->matches(intfcKV.second))
+					{
+						continue;
+					}
+					info.visibleInterfaces.insert(intfcKV.second.id);
 				}
+				callObserverMethod(observer, info, &Observer::onInterfaceAdded, intfcKV.second);
+			}
+
+			// Complete the initial group of changes
+			if (!_networkInterfaces.empty() && (!info.filter || !info.visibleInterfaces.empty()))
+			{
+				callObserverMethod(observer, info, &Observer::onChangesCompleted);
 			}
 		}
 
@@ -205,9 +541,10 @@ public:
 	void unregisterObserver(Observer* const observer) noexcept
 	{
 		auto isLast = false;
+		auto isolatedDispatcher = std::unique_ptr<IsolatedObserverDispatcher>{};
 		{
 			// Lock
-			auto const lg = std::lock_guard(_lock);
+			auto const lg = lockAndMeasureWait();
 
 			// Check if not null
 			if (observer == nullptr)
@@ -223,12 +560,16 @@ public:
 			}
 
 			// Remove observer
+			isolatedDispatcher = std::move(it->second.isolatedDispatcher);
 			_observers.erase(it);
 
 			// Notify OS-dependent code
-			isLast = _observers.empty();
+			isLast = _observers.empty() && _waitersCount == 0u;
 		}
 
+		// Stop the dispatch thread outside the lock (the running callback might be waiting for it)
+		isolatedDispatcher.reset();
+
 		// Notify OS-dependent code outside the lock
 		if (isLast)
 		{
@@ -236,6 +577,177 @@ public:
 		}
 	}
 
+	void setObserverCallbackBudget(std::chrono::microseconds const budget, SlowObserverHandler const& onSlowObserver)
+	{
+		// Lock
+		auto const lg = lockAndMeasureWait();
+
+		_observerCallbackBudget = budget;
+		_onSlowObserver = onSlowObserver;
+	}
+
+	void setObserverCallbackBudget(Observer* const observer, std::chrono::microseconds const budget) noexcept
+	{
+		// Lock
+		auto const lg = lockAndMeasureWait();
+
+		if (auto const it = _observers.find(observer); it != _observers.end())
+		{
+			it->second.callbackBudget = budget;
+		}
+	}
+
+	/** Starts monitoring interfaces for a waitFor call, as if an observer was registered */
+	void beginWait() noexcept
+	{
+		// Wait until first enumeration occured
+		waitForFirstEnumeration();
+
+		auto isFirst = false;
+		{
+			// Lock
+			auto const lg = lockAndMeasureWait();
+
+			isFirst = _observers.empty() && _waitersCount == 0u;
+			++_waitersCount;
+		}
+
+		// Notify OS-dependent code outside the lock
+		if (isFirst)
+		{
+			_osDependentDelegate->onFirstObserverRegistered();
+		}
+	}
+
+	/** Stops monitoring interfaces for a waitFor call, if no observer is registered anymore */
+	void endWait() noexcept
+	{
+		auto isLast = false;
+		{
+			// Lock
+			auto const lg = lockAndMeasureWait();
+
+			--_waitersCount;
+			isLast = _observers.empty() && _waitersCount == 0u;
+		}
+
+		// Notify OS-dependent code outside the lock
+		if (isLast)
+		{
+			_osDependentDelegate->onLastObserverUnregistered();
+		}
+	}
+
+	std::optional<Interface> waitFor(InterfacePredicate const& predicate, std::chrono::milliseconds const timeout)
+	{
+		if (!predicate)
+		{
+			return std::nullopt;
+		}
+
+		auto const findMatchingInterface = [this, &predicate]() -> std::optional<Interface>
+		{
+			for (auto const& intfcKV : _networkInterfaces)
+			{
+				auto matches = false;
+				try
+				{
+					matches = predicate(intfcKV.second);
+				}
+				catch (...)
+				{
+					// Ignore exceptions
+				}
+				if (matches)
+				{
+					return intfcKV.second;
+				}
+			}
+			return std::nullopt;
+		};
+
+		// Called with the lock already held by this thread (from an Observer, an enumeration handler or while processing events), or from the thread processing the OS events in external mode: changes cannot be applied while we wait, so don't block
+		if (_lock.isOwnedByCurrentThread() || _osDependentDelegate->isEventProcessingThread())
+		{
+			// Lock
+			auto const lg = lockAndMeasureWait();
+
+			return findMatchingInterface();
+		}
+
+		// Compute the deadline, saturating instead of overflowing for huge timeouts (std::nullopt meaning no deadline)
+		auto const now = std::chrono::steady_clock::now();
+		auto deadline = std::optional<std::chrono::steady_clock::time_point>{};
+		if (timeout.count() <= 0)
+		{
+			deadline = now;
+		}
+		else if (timeout < std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::time_point::max() - now))
+		{
+			deadline = now + timeout;
+		}
+
+		// Keep interfaces monitored for the duration of the wait, even if no observer is registered
+		beginWait();
+
+		auto result = std::optional<Interface>{};
+		try
+		{
+			// Lock
+			auto lock = lockAndMeasureWait();
+
+			while (!(result = findMatchingInterface()))
+			{
+				// Wait for a change (woken up by completeChanges)
+				if (!deadline)
+				{
+					_changedCondition.wait(lock);
+				}
+				else if (_changedCondition.wait_until(lock, *deadline) == std::cv_status::timeout)
+				{
+					break;
+				}
+			}
+		}
+		catch (...)
+		{
+			endWait();
+			throw;
+		}
+
+		endWait();
+
+		return result;
+	}
+
+	Statistics getStatistics() const
+	{
+		auto statistics = Statistics{};
+		statistics.fullRefreshCount = _metrics.fullRefreshCount.load(std::memory_order_relaxed);
+		statistics.interfaceRefreshCount = _metrics.interfaceRefreshCount.load(std::memory_order_relaxed);
+		statistics.refreshDurations = _metrics.refreshDurations.load();
+		statistics.diffDurations = _metrics.diffDurations.load();
+		statistics.lockWaitDurations = _metrics.lockWaitDurations.load();
+		statistics.events.interfaceAdded = _metrics.interfaceAddedEvents.load(std::memory_order_relaxed);
+		statistics.events.interfaceRemoved = _metrics.interfaceRemovedEvents.load(std::memory_order_relaxed);
+		statistics.events.enabledStateChanged = _metrics.enabledStateChangedEvents.load(std::memory_order_relaxed);
+		statistics.events.connectedStateChanged = _metrics.connectedStateChangedEvents.load(std::memory_order_relaxed);
+		statistics.events.aliasChanged = _metrics.aliasChangedEvents.load(std::memory_order_relaxed);
+		statistics.events.ipAddressInfosChanged = _metrics.ipAddressInfosChangedEvents.load(std::memory_order_relaxed);
+		statistics.events.gatewaysChanged = _metrics.gatewaysChangedEvents.load(std::memory_order_relaxed);
+
+		// Lock
+		auto const lg = lockAndMeasureWait();
+
+		statistics.observers.reserve(_observers.size());
+		for (auto const& [obs, info] : _observers)
+		{
+			statistics.observers.push_back({ obs, info.callbackDurations.load(), info.isolatedDispatcher != nullptr, info.isolatedDispatcher ? info.isolatedDispatcher->getDroppedTasksCount() : 0u });
+		}
+
+		return statistics;
+	}
+
 	// Deleted compiler auto-generated methods
 	NetworkInterfaceHelperImpl(NetworkInterfaceHelperImpl const&) = delete;
 	NetworkInterfaceHelperImpl(NetworkInterfaceHelperImpl&&) = delete;
@@ -243,23 +755,93 @@ public:
 	NetworkInterfaceHelperImpl& operator=(NetworkInterfaceHelperImpl&&) = delete;
 
 private:
+	struct ObserverInfo
+	{
+		std::optional<InterfaceFilter> filter{ std::nullopt };
+		std::unordered_set<std::string> visibleInterfaces{}; // IDs of the interfaces passing the filter (only used if filter is set)
+		mutable bool hasPendingChanges{ false }; // Changes have been notified since the last call to onChangesCompleted
+		mutable AtomicHistogram callbackDurations{};
+		std::optional<std::chrono::microseconds> callbackBudget{ std::nullopt }; // Overrides the budget of the helper
+		mutable std::unique_ptr<IsolatedObserverDispatcher> isolatedDispatcher{}; // Set once the observer exceeded its budget
+
+		/** Returns true if the interface has been notified to the observer and still passes the filter */
+		bool isVisible(Interface const& intfc) const noexcept
+		{
+			return !filter || (visibleInterfaces.count(intfc.id) != 0 && filter->matches(intfc));
+		}
+	};
+
+	struct InterfaceDiff
+	{
+		Interface const* intfc{ nullptr }; // New state of the interface
+		bool isEnabledChanged{ false };
+		bool isConnectedChanged{ false };
+		bool isAliasChanged{ false };
+		bool areIPAddressInfosChanged{ false };
+		bool areGatewaysChanged{ false };
+	};
+
+	void addToHelperInstances() noexcept
+	{
+		auto& instances = getHelperInstances();
+		// Lock
+		auto const lg = std::lock_guard(instances.lock);
+		try
+		{
+			instances.helpers.insert(this);
+		}
+		catch (...)
+		{
+			// Failed to allocate, Observers won't automatically unregister from this instance
+		}
+	}
+
+	void waitForFirstEnumeration() const noexcept
+	{
+		NIH_TRACE_SCOPE(Enumeration, "waitForFirstEnumeration", static_cast<NetworkInterfaceHelper const*>(this));
+		_osDependentDelegate->waitForFirstEnumeration();
+	}
+
+	/** Locks the helper, recording the time spent waiting for the lock */
+	std::unique_lock<OwnedRecursiveMutex> lockAndMeasureWait() const
+	{
+		auto lock = std::unique_lock(_lock, std::try_to_lock);
+		if (lock.owns_lock())
+		{
+			_metrics.lockWaitDurations.record(std::chrono::nanoseconds{ 0 });
+		}
+		else
+		{
+			auto const waitStart = std::chrono::steady_clock::now();
+			lock.lock();
+			_metrics.lockWaitDurations.record(std::chrono::steady_clock::now() - waitStart);
+		}
+		return lock;
+	}
+
 	// CommonDelegate overrides
 	/** When the list of interfaces changed */
 	virtual void onNewInterfacesList(Interfaces&& interfaces) noexcept override
 	{
 		// Lock
-		auto const lg = std::lock_guard(_lock);
+		auto const lg = lockAndMeasureWait();
+		auto const diffStart = std::chrono::steady_clock::now();
 
-		// Compare previous interfaces and new ones
-		auto addedInterfaces = std::vector<std::string>{};
-		auto removedInterfaces = std::vector<std::string>{};
+		// Compare previous interfaces and new ones, without notifying yet so the measured duration doesn't include the observers
+		auto removedInterfaces = std::vector<Interface const*>{};
+		auto addedInterfaces = std::vector<Interface const*>{};
+		auto changedInterfaces = std::vector<InterfaceDiff>{};
 
-		// Process all previous interfaces and search if it's still present in the new list
+		// Process all previous interfaces and search if it's still present in the new list (or if some property changed)
 		for (auto const& [name, previousIntfc] : _networkInterfaces)
 		{
-			if (interfaces.count(name) == 0)
+			if (auto const newIntfcIt = interfaces.find(name); newIntfcIt != interfaces.end())
+			{
+				changedInterfaces.push_back(diffInterfaces(previousIntfc, newIntfcIt->second));
+			}
+			else
 			{
-				notifyObserversMethod(&Observer::onInterfaceRemoved, previousIntfc);
+				removedInterfaces.push_back(&previousIntfc);
 			}
 		}
 
@@ -268,77 +850,121 @@ private:
 		{
 			if (_networkInterfaces.count(name) == 0)
 			{
-				notifyObserversMethod(&Observer::onInterfaceAdded, newIntfc);
+				addedInterfaces.push_back(&newIntfc);
 			}
 		}
 
-		// Process previous list and check if some property changed
-		for (auto const& [name, previousIntfc] : _networkInterfaces)
+		auto const diffDuration = std::chrono::steady_clock::now() - diffStart;
+		_metrics.diffDurations.record(diffDuration);
+		NIH_TRACE_EVENT(Diff, "onNewInterfacesList", static_cast<NetworkInterfaceHelper const*>(this), diffStart, diffDuration);
+
+		// Notify the changes (before updating the list, the pointers referencing both lists)
+		for (auto const* const intfc : removedInterfaces)
 		{
-			if (auto const newIntfcIt = interfaces.find(name); newIntfcIt != interfaces.end())
-			{
-				auto const& newIntfc = newIntfcIt->second;
-				if (previousIntfc.isEnabled != newIntfc.isEnabled)
-				{
-					notifyEnabledStateChanged(newIntfc, newIntfc.isEnabled);
-				}
-				if (previousIntfc.isConnected != newIntfc.isConnected)
-				{
-					notifyConnectedStateChanged(newIntfc, newIntfc.isConnected);
-				}
-				if (previousIntfc.alias != newIntfc.alias)
-				{
-					notifyAliasChanged(newIntfc, newIntfc.alias);
-				}
-				if (previousIntfc.ipAddressInfos != newIntfc.ipAddressInfos)
-				{
-					notifyIPAddressInfosChanged(newIntfc, newIntfc.ipAddressInfos);
-				}
-				if (previousIntfc.gateways != newIntfc.gateways)
-				{
-					notifyGatewaysChanged(newIntfc, newIntfc.gateways);
-				}
-			}
+			notifyInterfaceRemoved(*intfc);
+		}
+		for (auto const* const intfc : addedInterfaces)
+		{
+			notifyInterfaceAdded(*intfc);
+		}
+		for (auto const& diff : changedInterfaces)
+		{
+			notifyInterfaceChanges(diff);
 		}
 
 		// Update the interfaces list
 		_networkInterfaces = std::move(interfaces);
+
+		// Complete this group of changes
+		completeChanges();
 	}
 
 	/** When an interface was added */
 	virtual void onInterfaceAdded(std::string const& interfaceName, Interface&& intfc) noexcept override
 	{
 		// Lock
-		auto const lg = std::lock_guard(_lock);
+		auto const lg = lockAndMeasureWait();
 
 		// Add the interface to the list
 		auto const [it, inserted] = _networkInterfaces.emplace(interfaceName, std::move(intfc));
 		if (inserted)
 		{
-			notifyObserversMethod(&Observer::onInterfaceAdded, it->second);
+			notifyInterfaceAdded(it->second);
 		}
+
+		// Complete this group of changes
+		completeChanges();
 	}
 
 	/** When an interface was removed */
 	virtual void onInterfaceRemoved(std::string const& interfaceName) noexcept override
 	{
 		// Lock
-		auto const lg = std::lock_guard(_lock);
+		auto const lg = lockAndMeasureWait();
 
 		// Search the interface matching the name
 		if (auto intfcIt = _networkInterfaces.find(interfaceName); intfcIt != _networkInterfaces.end())
 		{
 			auto const& intfc = intfcIt->second;
-			notifyObserversMethod(&Observer::onInterfaceRemoved, intfc);
+			notifyInterfaceRemoved(intfc);
 			_networkInterfaces.erase(intfcIt);
 		}
+
+		// Complete this group of changes
+		completeChanges();
+	}
+
+	/** When a single interface has been refreshed (it will be added if unknown, otherwise only changed fields will be notified) */
+	virtual void onInterfaceRefreshed(std::string const& interfaceName, Interface&& intfc) noexcept override
+	{
+		// Lock
+		auto const lg = lockAndMeasureWait();
+		auto const diffStart = std::chrono::steady_clock::now();
+
+		// Search the interface matching the name
+		auto addedInterface = static_cast<Interface const*>(nullptr);
+		auto previousIntfc = std::optional<Interface>{};
+		auto diff = InterfaceDiff{};
+		auto intfcIt = _networkInterfaces.find(interfaceName);
+		if (intfcIt == _networkInterfaces.end())
+		{
+			auto const [it, inserted] = _networkInterfaces.emplace(interfaceName, std::move(intfc));
+			if (inserted)
+			{
+				addedInterface = &it->second;
+			}
+		}
+		else
+		{
+			// Swap the new interface in place, then compare with the previous one
+			previousIntfc = std::move(intfcIt->second);
+			intfcIt->second = std::move(intfc);
+			diff = diffInterfaces(*previousIntfc, intfcIt->second);
+		}
+
+		auto const diffDuration = std::chrono::steady_clock::now() - diffStart;
+		_metrics.diffDurations.record(diffDuration);
+		NIH_TRACE_EVENT(Diff, "onInterfaceRefreshed", static_cast<NetworkInterfaceHelper const*>(this), diffStart, diffDuration);
+
+		// Notify the changes
+		if (addedInterface)
+		{
+			notifyInterfaceAdded(*addedInterface);
+		}
+		else if (previousIntfc)
+		{
+			notifyInterfaceChanges(diff);
+		}
+
+		// Complete this group of changes
+		completeChanges();
 	}
 
 	/** When the Enabled state of an interface changed */
 	virtual void onEnabledStateChanged(std::string const& interfaceName, bool const isEnabled) noexcept override
 	{
 		// Lock
-		auto const lg = std::lock_guard(_lock);
+		auto const lg = lockAndMeasureWait();
 
 		// Search the interface matching the name
 		if (auto intfcIt = _networkInterfaces.find(interfaceName); intfcIt != _networkInterfaces.end())
@@ -348,15 +974,19 @@ private:
 			{
 				intfc.isEnabled = isEnabled;
 				notifyEnabledStateChanged(intfc, intfc.isEnabled);
+				updateObserversVisibility(intfc);
 			}
 		}
+
+		// Complete this group of changes
+		completeChanges();
 	}
 
 	/** When the Connected state of an interface changed */
 	virtual void onConnectedStateChanged(std::string const& interfaceName, bool const isConnected) noexcept override
 	{
 		// Lock
-		auto const lg = std::lock_guard(_lock);
+		auto const lg = lockAndMeasureWait();
 
 		// Search the interface matching the name
 		if (auto intfcIt = _networkInterfaces.find(interfaceName); intfcIt != _networkInterfaces.end())
@@ -366,15 +996,19 @@ private:
 			{
 				intfc.isConnected = isConnected;
 				notifyConnectedStateChanged(intfc, intfc.isConnected);
+				updateObserversVisibility(intfc);
 			}
 		}
+
+		// Complete this group of changes
+		completeChanges();
 	}
 
 	/** When the Alias of an interface changed */
 	virtual void onAliasChanged(std::string const& interfaceName, std::string&& alias) noexcept override
 	{
 		// Lock
-		auto const lg = std::lock_guard(_lock);
+		auto const lg = lockAndMeasureWait();
 
 		// Search the interface matching the name
 		if (auto intfcIt = _networkInterfaces.find(interfaceName); intfcIt != _networkInterfaces.end())
@@ -384,15 +1018,19 @@ private:
 			{
 				intfc.alias = std::move(alias);
 				notifyAliasChanged(intfc, intfc.alias);
+				updateObserversVisibility(intfc);
 			}
 		}
+
+		// Complete this group of changes
+		completeChanges();
 	}
 
 	/** When the IPAddressInfos of an interface changed */
 	virtual void onIPAddressInfosChanged(std::string const& interfaceName, Interface::IPAddressInfos&& ipAddressInfos) noexcept override
 	{
 		// Lock
-		auto const lg = std::lock_guard(_lock);
+		auto const lg = lockAndMeasureWait();
 
 		// Search the interface matching the name
 		if (auto intfcIt = _networkInterfaces.find(interfaceName); intfcIt != _networkInterfaces.end())
@@ -402,15 +1040,19 @@ private:
 			{
 				intfc.ipAddressInfos = std::move(ipAddressInfos);
 				notifyIPAddressInfosChanged(intfc, intfc.ipAddressInfos);
+				updateObserversVisibility(intfc);
 			}
 		}
+
+		// Complete this group of changes
+		completeChanges();
 	}
 
 	/** When the Gateways of an interface changed */
 	virtual void onGatewaysChanged(std::string const& interfaceName, Interface::Gateways&& gateways) noexcept override
 	{
 		// Lock
-		auto const lg = std::lock_guard(_lock);
+		auto const lg = lockAndMeasureWait();
 
 		// Search the interface matching the name
 		if (auto intfcIt = _networkInterfaces.find(interfaceName); intfcIt != _networkInterfaces.end())
@@ -420,13 +1062,100 @@ private:
 			{
 				intfc.gateways = std::move(gateways);
 				notifyGatewaysChanged(intfc, intfc.gateways);
+				updateObserversVisibility(intfc);
 			}
 		}
+
+		// Complete this group of changes
+		completeChanges();
+	}
+
+	/** When interfaces have been queried from the OS (all of them, or a single one), with the time it took (can be called from any thread, without changes being notified afterwards) */
+	virtual void onInterfacesQueried(bool const isFullRefresh, std::chrono::nanoseconds const duration) noexcept override
+	{
+		if (isFullRefresh)
+		{
+			_metrics.fullRefreshCount.fetch_add(1u, std::memory_order_relaxed);
+		}
+		else
+		{
+			_metrics.interfaceRefreshCount.fetch_add(1u, std::memory_order_relaxed);
+		}
+		_metrics.refreshDurations.record(duration);
+		NIH_TRACE_EVENT(Refresh, isFullRefresh ? "fullRefresh" : "interfaceRefresh", static_cast<NetworkInterfaceHelper const*>(this), std::chrono::steady_clock::now() - duration, duration);
 	}
 
 	// Private methods
 	template<typename Method, typename... Parameters>
-	void notifyObserversMethod(Method&& method, Parameters&&... params) const noexcept
+	void callObserverMethod(Observer* const obs, ObserverInfo const& info, Method&& method, Parameters&&... params) const noexcept
+	{
+		// Isolated observer, queue a copy of the notification to its dispatch thread
+		if (info.isolatedDispatcher)
+		{
+			try
+			{
+				info.isolatedDispatcher->push(
+					[obs, method, args = std::make_tuple(params...)]()
+					{
+						std::apply(
+							[obs, method](auto const&... parameters)
+							{
+								(obs->*method)(parameters...);
+							},
+							args);
+					});
+			}
+			catch (...)
+			{
+				// Failed to copy the parameters, the notification is lost
+			}
+			return;
+		}
+
+		auto const callStart = std::chrono::steady_clock::now();
+		// Using try-catch to protect ourself from errors in the handler
+		try
+		{
+			(obs->*method)(std::forward<Parameters>(params)...);
+		}
+		catch (...)
+		{
+		}
+		auto const callbackDuration = std::chrono::steady_clock::now() - callStart;
+		info.callbackDurations.record(callbackDuration);
+		NIH_TRACE_EVENT(ObserverCallback, "observerCallback", obs, callStart, callbackDuration);
+
+		// Isolate the observer if it exceeded its budget
+		auto const budget = info.callbackBudget.value_or(_observerCallbackBudget);
+		if (budget.count() != 0 && callbackDuration > budget)
+		{
+			isolateObserver(obs, info, callbackDuration);
+		}
+	}
+
+	/** Moves the notifications of the observer to its own dispatch thread, and reports it from that thread */
+	void isolateObserver(Observer* const obs, ObserverInfo const& info, std::chrono::nanoseconds const callbackDuration) const noexcept
+	{
+		try
+		{
+			info.isolatedDispatcher = std::make_unique<IsolatedObserverDispatcher>(
+				[onSlowObserver = _onSlowObserver, obs, callbackDuration]()
+				{
+					if (onSlowObserver)
+					{
+						onSlowObserver(obs, callbackDuration);
+					}
+				});
+		}
+		catch (...)
+		{
+			// Failed to create the dispatch thread, keep notifying the observer synchronously
+		}
+	}
+
+	/** Notifies all observers currently seeing the specified interface */
+	template<typename Method, typename... Parameters>
+	void notifyObserversMethod(Method&& method, Interface const& intfc, Parameters&&... params) const noexcept
 	{
 		if (method != nullptr)
 		{
@@ -434,49 +1163,167 @@ private:
 			auto const lg = std::lock_guard(_lock);
 
 			// Call each observer
-			for (auto* obs : _observers)
+			for (auto const& [obs, info] : _observers)
 			{
-				// Using try-catch to protect ourself from errors in the handler
-				try
+				if (info.isVisible(intfc))
 				{
-					(obs->*method)(std::forward<Parameters>(params)...);
+					info.hasPendingChanges = true;
+					callObserverMethod(obs, info, method, intfc, std::forward<Parameters>(params)...);
 				}
-				catch (...)
+			}
+		}
+	}
+
+	/** Notifies observers which received changes that this group of changes is complete, and wakes up the threads waiting for a change */
+	void completeChanges() noexcept
+	{
+		for (auto& [obs, info] : _observers)
+		{
+			if (info.hasPendingChanges)
+			{
+				info.hasPendingChanges = false;
+				callObserverMethod(obs, info, &Observer::onChangesCompleted);
+			}
+		}
+		_changedCondition.notify_all();
+	}
+
+	void notifyInterfaceAdded(Interface const& intfc) noexcept
+	{
+		_metrics.interfaceAddedEvents.fetch_add(1u, std::memory_order_relaxed);
+		for (auto& [obs, info] : _observers)
+		{
+			if (info.filter)
+			{
+				if (!info.filter->matches(intfc))
 				{
+					continue;
 				}
+				info.visibleInterfaces.insert(intfc.id);
+			}
+			info.hasPendingChanges = true;
+			callObserverMethod(obs, info, &Observer::onInterfaceAdded, intfc);
+		}
+	}
+
+	void notifyInterfaceRemoved(Interface const& intfc) noexcept
+	{
+		_metrics.interfaceRemovedEvents.fetch_add(1u, std::memory_order_relaxed);
+		for (auto& [obs, info] : _observers)
+		{
+			if (info.filter && info.visibleInterfaces.erase(intfc.id) == 0)
+			{
+				continue;
 			}
+			info.hasPendingChanges = true;
+			callObserverMethod(obs, info, &Observer::onInterfaceRemoved, intfc);
 		}
 	}
 
+	/** Notifies filtered observers for which the interface started or stopped passing the filter */
+	void updateObserversVisibility(Interface const& intfc) noexcept
+	{
+		for (auto& [obs, info] : _observers)
+		{
+			if (!info.filter)
+			{
+				continue;
+			}
+			auto const wasVisible = info.visibleInterfaces.count(intfc.id) != 0;
+			auto const isVisible = info.filter->matches(intfc);
+			if (isVisible && !wasVisible)
+			{
+				info.visibleInterfaces.insert(intfc.id);
+				info.hasPendingChanges = true;
+				callObserverMethod(obs, info, &Observer::onInterfaceAdded, intfc);
+			}
+			else if (!isVisible && wasVisible)
+			{
+				info.visibleInterfaces.erase(intfc.id);
+				info.hasPendingChanges = true;
+				callObserverMethod(obs, info, &Observer::onInterfaceRemoved, intfc);
+			}
+		}
+	}
+
+	/** Returns which notified fields differ between the previous and the new state of an interface */
+	static InterfaceDiff diffInterfaces(Interface const& previousIntfc, Interface const& newIntfc) noexcept
+	{
+		auto diff = InterfaceDiff{};
+		diff.intfc = &newIntfc;
+		diff.isEnabledChanged = previousIntfc.isEnabled != newIntfc.isEnabled;
+		diff.isConnectedChanged = previousIntfc.isConnected != newIntfc.isConnected;
+		diff.isAliasChanged = previousIntfc.alias != newIntfc.alias;
+		diff.areIPAddressInfosChanged = previousIntfc.ipAddressInfos != newIntfc.ipAddressInfos;
+		diff.areGatewaysChanged = previousIntfc.gateways != newIntfc.gateways;
+		return diff;
+	}
+
+	void notifyInterfaceChanges(InterfaceDiff const& diff) noexcept
+	{
+		auto const& intfc = *diff.intfc;
+		if (diff.isEnabledChanged)
+		{
+			notifyEnabledStateChanged(intfc, intfc.isEnabled);
+		}
+		if (diff.isConnectedChanged)
+		{
+			notifyConnectedStateChanged(intfc, intfc.isConnected);
+		}
+		if (diff.isAliasChanged)
+		{
+			notifyAliasChanged(intfc, intfc.alias);
+		}
+		if (diff.areIPAddressInfosChanged)
+		{
+			notifyIPAddressInfosChanged(intfc, intfc.ipAddressInfos);
+		}
+		if (diff.areGatewaysChanged)
+		{
+			notifyGatewaysChanged(intfc, intfc.gateways);
+		}
+		updateObserversVisibility(intfc);
+	}
+
 	void notifyEnabledStateChanged(Interface const& intfc, bool const isEnabled) noexcept
 	{
+		_metrics.enabledStateChangedEvents.fetch_add(1u, std::memory_order_relaxed);
 		notifyObserversMethod(&Observer::onInterfaceEnabledStateChanged, intfc, isEnabled);
 	}
 
 	void notifyConnectedStateChanged(Interface const& intfc, bool const isConnected) noexcept
 	{
+		_metrics.connectedStateChangedEvents.fetch_add(1u, std::memory_order_relaxed);
 		notifyObserversMethod(&Observer::onInterfaceConnectedStateChanged, intfc, isConnected);
 	}
 
 	void notifyAliasChanged(Interface const& intfc, std::string const& alias) noexcept
 	{
+		_metrics.aliasChangedEvents.fetch_add(1u, std::memory_order_relaxed);
 		notifyObserversMethod(&Observer::onInterfaceAliasChanged, intfc, alias);
 	}
 
 	void notifyIPAddressInfosChanged(Interface const& intfc, Interface::IPAddressInfos const& ipAddressInfos) noexcept
 	{
+		_metrics.ipAddressInfosChangedEvents.fetch_add(1u, std::memory_order_relaxed);
 		notifyObserversMethod(&Observer::onInterfaceIPAddressInfosChanged, intfc, ipAddressInfos);
 	}
 
 	void notifyGatewaysChanged(Interface const& intfc, Interface::Gateways const& gateways) noexcept
 	{
+		_metrics.gatewaysChangedEvents.fetch_add(1u, std::memory_order_relaxed);
 		notifyObserversMethod(&Observer::onInterfaceGateWaysChanged, intfc, gateways);
 	}
 
 	// Private members
-	mutable std::recursive_mutex _lock{};
-	std::set<Observer*> _observers{};
+	mutable OwnedRecursiveMutex _lock{};
+	std::condition_variable_any _changedCondition{};
+	std::map<Observer*, ObserverInfo> _observers{};
+	std::size_t _waitersCount{ 0u }; // Number of waitFor calls currently blocked (interfaces are monitored while there are observers or waiters)
 	Interfaces _networkInterfaces{};
+	mutable Metrics _metrics{};
+	std::chrono::microseconds _observerCallbackBudget{ 0 };
+	SlowObserverHandler _onSlowObserver{};
 	std::unique_ptr<OsDependentDelegate> _osDependentDelegate = { getOsDependentDelegate(*this) };
 };
 
@@ -487,118 +1334,179 @@ NetworkInterfaceHelper& NetworkInterfaceHelper::getInstance() noexcept
 	return s_Instance;
 }
 
-std::string NetworkInterfaceHelper::macAddressToString(MacAddress const& macAddress, bool const upperCase, char const separator) noexcept
+#if defined(__linux__)
+static void deleteHelper(NetworkInterfaceHelper* const helper) noexcept
 {
-	try
-	{
-		bool isFirst = true;
-		std::stringstream ss;
+	delete static_cast<NetworkInterfaceHelperImpl*>(helper);
+}
 
-		if (upperCase)
-		{
-			ss << std::uppercase;
-		}
-		ss << std::hex << std::setfill('0');
+NetworkInterfaceHelper::UniquePointer NetworkInterfaceHelper::createForNetworkNamespace(int const netnsFileDescriptor)
+{
+	return UniquePointer{ new NetworkInterfaceHelperImpl{ [netnsFileDescriptor](CommonDelegate& commonDelegate)
+												 {
+													 return getOsDependentDelegate(commonDelegate, netnsFileDescriptor);
+												 } },
+		&deleteHelper };
+}
 
-		for (auto const v : macAddress)
-		{
-			if (isFirst)
-			{
-				isFirst = false;
-			}
-			else
-			{
-				if (separator != '\0')
-				{
-					ss << separator;
-				}
-			}
-			ss << std::setw(2) << static_cast<std::uint32_t>(v); // setw has to be called every time // Force the value as 'unsigned int' so it's not printed as a 'char' (ASCII)
-		}
+NetworkInterfaceHelper::UniquePointer NetworkInterfaceHelper::createForNetworkNamespace(std::string const& netnsPath)
+{
+	return UniquePointer{ new NetworkInterfaceHelperImpl{ [&netnsPath](CommonDelegate& commonDelegate)
+												 {
+													 return getOsDependentDelegate(commonDelegate, netnsPath);
+												 } },
+		&deleteHelper };
+}
+#endif // __linux__
+
+void NetworkInterfaceHelper::enumerateInterfaces(EnumerateInterfacesHandler const& onInterface) const noexcept
+{
+	auto const& impl = static_cast<NetworkInterfaceHelperImpl const&>(*this);
+	impl.enumerateInterfaces(onInterface);
+}
 
-		return ss.str();
+Interface NetworkInterfaceHelper::getInterfaceByName(std::string const& name) const
+{
+	auto const& impl = static_cast<NetworkInterfaceHelperImpl const&>(*this);
+	return impl.getInterfaceByName(name);
+}
+
+std::uint32_t NetworkInterfaceHelper::getInterfaceIndex(std::string_view const name) const noexcept
+{
+	auto const& impl = static_cast<NetworkInterfaceHelperImpl const&>(*this);
+	try
+	{
+		return impl.getInterfaceIndex(name);
 	}
 	catch (...)
 	{
-		return {};
+		return 0u;
 	}
 }
 
-MacAddress NetworkInterfaceHelper::stringToMacAddress(std::string const& macAddressAsString, char const separator)
+InterfacesSnapshot NetworkInterfaceHelper::takeSnapshot() const noexcept
 {
-	auto str = macAddressAsString;
-	if (separator != '\0')
+	auto const& impl = static_cast<NetworkInterfaceHelperImpl const&>(*this);
+	try
 	{
-		str.erase(std::remove(str.begin(), str.end(), separator), str.end());
+		return impl.takeSnapshot();
 	}
+	catch (...)
+	{
+		return {};
+	}
+}
 
-	auto ss = std::stringstream{};
-	ss << std::hex << str;
+void NetworkInterfaceHelper::registerObserver(Observer* const observer) noexcept
+{
+	auto& impl = static_cast<NetworkInterfaceHelperImpl&>(*this);
+	impl.registerObserver(observer, std::nullopt);
+}
 
-	auto macAsInteger = std::uint64_t{};
-	ss >> macAsInteger;
-	if (ss.fail())
+void NetworkInterfaceHelper::registerObserver(Observer* const observer, InterfaceFilter const& filter) noexcept
+{
+	auto& impl = static_cast<NetworkInterfaceHelperImpl&>(*this);
+	try
 	{
-		throw std::invalid_argument("Invalid MacAddress representation: " + macAddressAsString);
+		impl.registerObserver(observer, filter);
 	}
+	catch (...)
+	{
+		// Failed to copy the filter
+	}
+}
 
-	auto out = MacAddress{};
-	out[0] = static_cast<MacAddress::value_type>((macAsInteger >> 40) & 0xFF);
-	out[1] = static_cast<MacAddress::value_type>((macAsInteger >> 32) & 0xFF);
-	out[2] = static_cast<MacAddress::value_type>((macAsInteger >> 24) & 0xFF);
-	out[3] = static_cast<MacAddress::value_type>((macAsInteger >> 16) & 0xFF);
-	out[4] = static_cast<MacAddress::value_type>((macAsInteger >> 8) & 0xFF);
-	out[5] = static_cast<MacAddress::value_type>((macAsInteger >> 0) & 0xFF);
-
-	return out;
+void NetworkInterfaceHelper::unregisterObserver(Observer* const observer) noexcept
+{
+	auto& impl = static_cast<NetworkInterfaceHelperImpl&>(*this);
+	impl.unregisterObserver(observer);
 }
 
-bool NetworkInterfaceHelper::isMacAddressValid(MacAddress const& macAddress) noexcept
+std::optional<Interface> NetworkInterfaceHelper::waitFor(InterfacePredicate const& predicate, std::chrono::milliseconds const timeout) noexcept
 {
-	if (macAddress.size() != 6)
-		return false;
-	for (auto const v : macAddress)
+	auto& impl = static_cast<NetworkInterfaceHelperImpl&>(*this);
+	try
 	{
-		if (v != 0)
-			return true;
+		return impl.waitFor(predicate, timeout);
+	}
+	catch (...)
+	{
+		return std::nullopt;
 	}
-	return false;
 }
 
-void NetworkInterfaceHelper::enumerateInterfaces(EnumerateInterfacesHandler const& onInterface) const noexcept
+std::optional<Interface> NetworkInterfaceHelper::waitForInterface(std::string const& name, InterfaceFilter const& conditions, std::chrono::milliseconds const timeout) noexcept
 {
-	auto const& impl = static_cast<NetworkInterfaceHelperImpl const&>(*this);
-	impl.enumerateInterfaces(onInterface);
+	return waitFor(
+		[&name, &conditions](Interface const& intfc)
+		{
+			return intfc.id == name && conditions.matches(intfc);
+		},
+		timeout);
 }
 
-Interface NetworkInterfaceHelper::getInterfaceByName(std::string const& name) const
+NetworkInterfaceHelper::Statistics NetworkInterfaceHelper::getStatistics() const noexcept
 {
 	auto const& impl = static_cast<NetworkInterfaceHelperImpl const&>(*this);
-	return impl.getInterfaceByName(name);
+	try
+	{
+		return impl.getStatistics();
+	}
+	catch (...)
+	{
+		return {};
+	}
 }
 
-void NetworkInterfaceHelper::registerObserver(Observer* const observer) noexcept
+void NetworkInterfaceHelper::setObserverCallbackBudget(std::chrono::microseconds const budget, SlowObserverHandler const& onSlowObserver) noexcept
 {
 	auto& impl = static_cast<NetworkInterfaceHelperImpl&>(*this);
-	impl.registerObserver(observer);
+	try
+	{
+		impl.setObserverCallbackBudget(budget, onSlowObserver);
+	}
+	catch (...)
+	{
+		// Failed to copy the handler
+	}
 }
 
-void NetworkInterfaceHelper::unregisterObserver(Observer* const observer) noexcept
+void NetworkInterfaceHelper::setObserverCallbackBudget(Observer* const observer, std::chrono::microseconds const budget) noexcept
 {
 	auto& impl = static_cast<NetworkInterfaceHelperImpl&>(*this);
-	impl.unregisterObserver(observer);
-}
-
-NetworkInterfaceHelperImpl& getPrivateInstance() noexcept
-{
-	auto& helper = NetworkInterfaceHelper::getInstance();
-	return static_cast<NetworkInterfaceHelperImpl&>(helper);
+	impl.setObserverCallbackBudget(observer, budget);
 }
 
 NetworkInterfaceHelper::Observer::~Observer() noexcept
 {
-	auto& helper = getPrivateInstance();
-	helper.unregisterObserver(this);
+	auto& instances = getHelperInstances();
+	auto helpers = std::vector<NetworkInterfaceHelperImpl*>{};
+	{
+		// Lock
+		auto const lg = std::lock_guard(instances.lock);
+		try
+		{
+			helpers.assign(instances.helpers.begin(), instances.helpers.end());
+		}
+		catch (...)
+		{
+			return;
+		}
+		++instances.pendingUnregistrations;
+	}
+
+	// Unregister outside the lock, as unregistering takes the helper and OS-dependent locks (which are held by the event thread while an Observer callback may destroy another Observer)
+	for (auto* const helper : helpers)
+	{
+		helper->unregisterObserver(this);
+	}
+
+	{
+		// Lock
+		auto const lg = std::lock_guard(instances.lock);
+		--instances.pendingUnregistrations;
+	}
+	instances.unregistrationsCompleted.notify_all();
 }
 
 } // namespace networkInterface
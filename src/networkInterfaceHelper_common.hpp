@@ -46,6 +46,9 @@
 #include <cstdint>
 #include <stdexcept> // invalid_argument
 #include <memory>
+#include <chrono>
+#include <array>
+#include <algorithm> // min
 
 namespace la
 {
@@ -55,6 +58,8 @@ namespace utils
 {
 /** Sets the current thread name (if supported) for debugging purpose */
 void setCurrentThreadName(std::string const& name) noexcept;
+/** Returns true if the specified string matches the pattern (supporting '*' and '?' wildcards) */
+bool matchesPattern(std::string const& str, std::string const& pattern) noexcept;
 } // namespace utils
 
 using Interfaces = std::unordered_map<std::string, Interface>;
@@ -73,6 +78,11 @@ public:
 	virtual void onFirstObserverRegistered() noexcept = 0;
 	/** When the last observer is unregistered */
 	virtual void onLastObserverUnregistered() noexcept = 0;
+	/** Returns true if the calling thread is the one processing the OS events (in which case no change can be received while it is blocked) */
+	virtual bool isEventProcessingThread() const noexcept
+	{
+		return false;
+	}
 };
 
 /*
@@ -89,6 +99,8 @@ public:
 	virtual void onInterfaceAdded(std::string const& interfaceName, Interface&& intfc) noexcept = 0;
 	/** When an interface was removed */
 	virtual void onInterfaceRemoved(std::string const& interfaceName) noexcept = 0;
+	/** When a single interface has been refreshed (it will be added if unknown, otherwise only changed fields will be notified) */
+	virtual void onInterfaceRefreshed(std::string const& interfaceName, Interface&& intfc) noexcept = 0;
 	/** When the Enabled state of an interface changed */
 	virtual void onEnabledStateChanged(std::string const& interfaceName, bool const isEnabled) noexcept = 0;
 	/** When the Connected state of an interface changed */
@@ -99,10 +111,44 @@ public:
 	virtual void onIPAddressInfosChanged(std::string const& interfaceName, Interface::IPAddressInfos&& ipAddressInfos) noexcept = 0;
 	/** When the Gateways of an interface changed */
 	virtual void onGatewaysChanged(std::string const& interfaceName, Interface::Gateways&& gateways) noexcept = 0;
+	/** When interfaces have been queried from the OS (all of them, or a single one), with the time it took (can be called from any thread, without changes being notified afterwards) */
+	virtual void onInterfacesQueried(bool const isFullRefresh, std::chrono::nanoseconds const duration) noexcept = 0;
 };
 
 // Methods to be implemented by eachOS-dependent implementation
 std::unique_ptr<OsDependentDelegate> getOsDependentDelegate(CommonDelegate& commonDelegate) noexcept;
+#if defined(__linux__)
+/** Returns a delegate monitoring the specified network namespace. Throws std::invalid_argument if the namespace cannot be entered. */
+std::unique_ptr<OsDependentDelegate> getOsDependentDelegate(CommonDelegate& commonDelegate, int const networkNamespaceFileDescriptor);
+/** Returns a delegate monitoring the specified network namespace. Throws std::invalid_argument if the namespace cannot be opened or entered. */
+std::unique_ptr<OsDependentDelegate> getOsDependentDelegate(CommonDelegate& commonDelegate, std::string const& networkNamespacePath);
+#endif // __linux__
+
+static constexpr char UpperHexDigits[] = "0123456789ABCDEF";
+static constexpr char LowerHexDigits[] = "0123456789abcdef";
+static constexpr std::uint8_t InvalidHexDigit = 0xFF;
+
+static constexpr std::array<std::uint8_t, 256> makeHexDigitValues() noexcept
+{
+	auto values = std::array<std::uint8_t, 256>{};
+	for (auto& value : values)
+	{
+		value = InvalidHexDigit;
+	}
+	for (auto digit = 0u; digit < 10u; ++digit)
+	{
+		values['0' + digit] = static_cast<std::uint8_t>(digit);
+	}
+	for (auto digit = 0u; digit < 6u; ++digit)
+	{
+		values['a' + digit] = static_cast<std::uint8_t>(10u + digit);
+		values['A' + digit] = static_cast<std::uint8_t>(10u + digit);
+	}
+	return values;
+}
+
+/** Value of each hex digit character, InvalidHexDigit for any other character */
+static constexpr auto HexDigitValues = makeHexDigitValues();
 
 // Some templates shared with unit tests
 constexpr IPAddress::value_type_packed_v4 makePackedMaskV4(std::uint8_t const countBits) noexcept
@@ -121,7 +167,8 @@ constexpr IPAddress::value_type_packed_v4 makePackedMaskV4(std::uint8_t const co
 
 constexpr IPAddress::value_type_packed_v6 makePackedMaskV6(std::uint8_t const countBits) noexcept
 {
-	constexpr auto MaxBits = (sizeof(IPAddress::value_type_packed_v6::first_type) + sizeof(IPAddress::value_type_packed_v6::second_type)) * 8;
+	constexpr auto WordBits = sizeof(IPAddress::value_type_packed_v6::first_type) * 8;
+	constexpr auto MaxBits = WordBits * 2;
 	if (countBits >= MaxBits)
 	{
 		return IPAddress::value_type_packed_v6{ ~static_cast<IPAddress::value_type_packed_v6::first_type>(0), ~static_cast<IPAddress::value_type_packed_v6::second_type>(0) };
@@ -130,11 +177,14 @@ constexpr IPAddress::value_type_packed_v6 makePackedMaskV6(std::uint8_t const co
 	{
 		return IPAddress::value_type_packed_v6{ 0, 0 };
 	}
-	auto mask = IPAddress::value_type_packed_v6{ ~static_cast<IPAddress::value_type_packed_v6::first_type>(0), ~static_cast<IPAddress::value_type_packed_v6::second_type>(0) };
-	auto const lsbToShift = std::min(countBits, static_cast<std::uint8_t>(sizeof(IPAddress::value_type_packed_v6::second_type) * 8));
-	mask.second <<= lsbToShift;
-	auto const msbToShift = countBits - lsbToShift;
-	mask.first <<= msbToShift;
+	// The most significant bits are in 'first', a full word shift being undefined the bits of 'second' are only set if required
+	auto const msbCount = std::min(static_cast<std::size_t>(countBits), WordBits);
+	auto const lsbCount = countBits - msbCount;
+	auto mask = IPAddress::value_type_packed_v6{ ~static_cast<IPAddress::value_type_packed_v6::first_type>(0) << (WordBits - msbCount), 0 };
+	if (lsbCount != 0)
+	{
+		mask.second = ~static_cast<IPAddress::value_type_packed_v6::second_type>(0) << (WordBits - lsbCount);
+	}
 	return mask;
 }
 
@@ -180,5 +230,30 @@ static inline void validateNetmaskV6(IPAddress const& netmask)
 	}
 }
 
+/** Validates an address/netmask pair (same Type, contiguous netmask) and returns its Type. Throws std::invalid_argument if not valid. */
+static inline IPAddress::Type validateIPAddressInfo(IPAddress const& address, IPAddress const& netmask)
+{
+	// Check if address and netmask types are identical
+	auto const addressType = address.getType();
+	if (addressType != netmask.getType())
+	{
+		throw std::invalid_argument("address and netmask not of the same Type");
+	}
+
+	// Check if netmask is contiguous
+	switch (addressType)
+	{
+		case IPAddress::Type::V4:
+			validateNetmaskV4(netmask);
+			break;
+		case IPAddress::Type::V6:
+			validateNetmaskV6(netmask);
+			break;
+		default:
+			throw std::invalid_argument("Invalid Type");
+	}
+	return addressType;
+}
+
 } // namespace networkInterface
 } // namespace la
@@ -62,6 +62,7 @@
 #include <mutex> // once, mutex
 #include <cstring> // memcpy / strncmp
 #include <atomic>
+#include <chrono>
 #include <thread>
 #include <thread>
 
@@ -148,6 +149,7 @@ private:
 
 	void refreshInterfaces(Interfaces& interfaces) noexcept
 	{
+		auto const queryStart = std::chrono::steady_clock::now();
 		std::unique_ptr<struct ifaddrs, std::function<void(struct ifaddrs*)>> scopedIfa{ nullptr, [](struct ifaddrs* ptr)
 			{
 				if (ptr != nullptr)
@@ -186,6 +188,7 @@ private:
 				interface.id = ifa->ifa_name;
 				interface.description = ifa->ifa_name;
 				interface.alias = ifa->ifa_name;
+				interface.index = reinterpret_cast<struct sockaddr_dl const*>(ifa->ifa_addr)->sdl_index;
 				interface.type = getInterfaceType(ifa, sck);
 				// Check if interface is enabled
 				interface.isEnabled = (ifa->ifa_flags & IFF_UP) == IFF_UP;
@@ -207,24 +210,14 @@ private:
 				{
 					auto& interface = intfcIt->second;
 
-					char host[NI_MAXHOST];
-					auto ret = getnameinfo(ifa->ifa_addr, (family == AF_INET) ? sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6), host, sizeof(host) - 1, nullptr, 0, NI_NUMERICHOST);
-					if (ret != 0)
+					if (ifa->ifa_netmask == nullptr)
 					{
 						continue;
 					}
-					host[NI_MAXHOST - 1] = 0;
 
-					char mask[NI_MAXHOST];
-					ret = getnameinfo(ifa->ifa_netmask, (family == AF_INET) ? sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6), mask, sizeof(mask) - 1, nullptr, 0, NI_NUMERICHOST);
-					if (ret != 0)
-					{
-						continue;
-					}
-					mask[NI_MAXHOST - 1] = 0;
-
-					// Add the IP address of that interface
-					interface.ipAddressInfos.emplace_back(IPAddressInfo{ IPAddress{ host }, IPAddress{ mask } });
+					// Add the IP address of that interface (the netmask family is not always set by the BSD stack, use the address one)
+					auto const mask = (family == AF_INET) ? IPAddress{ reinterpret_cast<struct sockaddr_in const*>(ifa->ifa_netmask)->sin_addr } : IPAddress{ reinterpret_cast<struct sockaddr_in6 const*>(ifa->ifa_netmask)->sin6_addr };
+					interface.ipAddressInfos.emplace_back(IPAddressInfo{ IPAddress{ *ifa->ifa_addr }, mask });
 				}
 			}
 		}
@@ -257,6 +250,8 @@ private:
 
 		// Release the socket
 		close(sck);
+
+		_commonDelegate.onInterfacesQueried(true, std::chrono::steady_clock::now() - queryStart);
 	}
 
 	void terminateObserverThread() noexcept
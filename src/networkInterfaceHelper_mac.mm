@@ -100,6 +100,20 @@ static std::string getStdString(NSString const* const nsString) noexcept
 	return std::string{ [nsString UTF8String] };
 }
 
+/** NSString to IPAddress conversion, without building an intermediate std::string (throws std::invalid_argument) */
+static IPAddress getIPAddress(NSString const* const nsString)
+{
+	auto const* const str = [nsString UTF8String];
+	auto const* const last = str + std::strlen(str);
+	auto ip = IPAddress{};
+	auto const [ptr, ec] = NetworkInterfaceHelper::ipAddressFromChars(str, last, ip);
+	if (ec != std::errc{} || ptr != last)
+	{
+		throw std::invalid_argument("Invalid IP address");
+	}
+	return ip;
+}
+
 static void clearIterator(io_iterator_t iterator)
 {
 	@autoreleasepool
@@ -259,7 +273,7 @@ private:
 					}
 					try
 					{
-						ipAddressInfos.push_back(IPAddressInfo{ IPAddress{ std::string{ [address UTF8String] } }, IPAddress{ std::string{ [netmask UTF8String] } } });
+						ipAddressInfos.push_back(IPAddressInfo{ getIPAddress(address), getIPAddress(netmask) });
 						return true;
 					}
 					catch (...)
@@ -290,7 +304,7 @@ private:
 					auto const* prefixLength = (NSNumber*)[prefixLengths objectAtIndex:ipIndex];
 					try
 					{
-						ipAddressInfos.push_back(IPAddressInfo{ IPAddress{ std::string{ [address UTF8String] } }, IPAddress{ IPAddress::packedV6FromPrefixLength([prefixLength unsignedCharValue]) } });
+						ipAddressInfos.push_back(IPAddressInfo{ getIPAddress(address), IPAddress{ IPAddress::packedV6FromPrefixLength([prefixLength unsignedCharValue]) } });
 						return true;
 					}
 					catch (...)
@@ -411,6 +425,7 @@ private:
 
 	void refreshInterfaces(Interfaces& interfaces) noexcept
 	{
+		auto const queryStart = std::chrono::steady_clock::now();
 		@autoreleasepool
 		{
 			clearInterfaceToServiceMapping();
@@ -459,6 +474,7 @@ private:
 								auto interface = Interface{};
 								auto const interfaceID = getStdString(deviceName);
 								interface.id = interfaceID;
+								interface.index = if_nametoindex(interfaceID.c_str());
 								interface.type = getInterfaceType(hardware);
 								interface.description = getStdString(description);
 
@@ -522,6 +538,8 @@ private:
 				}
 			}
 		}
+
+		_commonDelegate.onInterfacesQueried(true, std::chrono::steady_clock::now() - queryStart);
 	}
 
 	static void dynamicStoreChangedCallback(SCDynamicStoreRef store, CFArrayRef changedKeys, void* ctx) noexcept
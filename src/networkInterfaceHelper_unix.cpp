@@ -51,45 +51,345 @@
 #include <linux/wireless.h>
 #include <netinet/in.h>
 #include <linux/if.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <sched.h> // setns
+#include <fcntl.h>
+#include <errno.h>
 #include <unordered_map>
 #include <memory>
 #include <string>
 #include <cstring> // memcpy
 #include <atomic>
 #include <thread>
+#include <mutex>
+#include <functional>
+#include <optional>
+#include <set>
+#include <array>
 #include <chrono>
-#include <mutex> // once
 
 namespace la
 {
 namespace networkInterface
 {
+/*
+* Event loop (based on epoll) shared by all OsDependentDelegate_Unix instances, so monitoring many network namespaces only requires a single thread
+*/
+class EventLoop final
+{
+public:
+	using Handler = std::function<void()>;
+
+	static EventLoop& getInstance() noexcept
+	{
+		static auto s_Instance = EventLoop{};
+
+		return s_Instance;
+	}
+
+	/** Starts monitoring the specified file descriptor. The handler is called from the event thread each time the descriptor is readable. */
+	bool addFileDescriptor(int const fd, Handler&& handler) noexcept
+	{
+		if (_epollFd < 0 || _wakeupFd < 0)
+		{
+			return false;
+		}
+
+		// Lock
+		auto const lg = std::lock_guard(_lock);
+
+		try
+		{
+			auto entry = std::make_shared<HandlerEntry>();
+			entry->handler = std::move(handler);
+			_handlers[fd] = std::move(entry);
+		}
+		catch (...)
+		{
+			return false;
+		}
+
+		auto event = epoll_event{};
+		event.events = EPOLLIN;
+		event.data.fd = fd;
+		if (epoll_ctl(_epollFd, EPOLL_CTL_ADD, fd, &event) < 0)
+		{
+			_handlers.erase(fd);
+			return false;
+		}
+
+		// Start the event thread the first time a descriptor is added (unless events are processed by the user)
+		if (!_isExternal && !_thread.joinable())
+		{
+			try
+			{
+				_thread = std::thread(
+					[this]()
+					{
+						utils::setCurrentThreadName("networkInterfaceHelper::EventLoop");
+
+						while (!_shouldTerminate)
+						{
+							processEvents(-1);
+						}
+					});
+			}
+			catch (...)
+			{
+				epoll_ctl(_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+				_handlers.erase(fd);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/** Stops monitoring the specified file descriptor. When returning, the handler is not running anymore (unless this method is called from the handler itself). */
+	void removeFileDescriptor(int const fd) noexcept
+	{
+		auto entry = std::shared_ptr<HandlerEntry>{};
+		{
+			// Lock
+			auto const lg = std::lock_guard(_lock);
+
+			epoll_ctl(_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+			if (auto const it = _handlers.find(fd); it != _handlers.end())
+			{
+				entry = std::move(it->second);
+				_handlers.erase(it);
+			}
+		}
+
+		if (entry)
+		{
+			// Lock the handler only (waiting for it to complete if running), so the handlers of other descriptors are not blocked
+			auto const lg = std::lock_guard(entry->lock);
+			entry->isActive = false;
+		}
+	}
+
+	/** Stops the event thread, events will only be processed when calling processEvents. Returns the (pollable) epoll file descriptor. */
+	int enableExternalProcessing() noexcept
+	{
+		if (_epollFd < 0)
+		{
+			return -1;
+		}
+
+		{
+			// Lock
+			auto const lg = std::lock_guard(_lock);
+			_isExternal = true;
+		}
+
+		// Stop the event thread (outside the lock, as it needs it to process events)
+		if (_thread.joinable())
+		{
+			_shouldTerminate = true;
+			// Called from an observer (the thread will stop after returning from the handler)
+			if (_thread.get_id() == std::this_thread::get_id())
+			{
+				_thread.detach();
+			}
+			else
+			{
+				eventfd_write(_wakeupFd, 1);
+				_thread.join();
+			}
+		}
+
+		return _epollFd;
+	}
+
+	/** Processes the pending events from the calling thread (external processing mode), remembering it is the thread processing events */
+	void processExternalEvents() noexcept
+	{
+		_externalProcessingThread = std::this_thread::get_id();
+		processEvents(0);
+	}
+
+	/** Returns true if the calling thread is the one processing events in external processing mode */
+	bool isExternalProcessingThread() const noexcept
+	{
+		return _externalProcessingThread == std::this_thread::get_id();
+	}
+
+	/** Waits at most timeoutMs milliseconds (-1 for infinite, 0 to return immediately) for events and processes them */
+	void processEvents(int const timeoutMs) noexcept
+	{
+		auto events = std::array<epoll_event, 16>{};
+		auto const count = epoll_wait(_epollFd, events.data(), static_cast<int>(events.size()), timeoutMs);
+
+		for (auto i = 0; i < count; ++i)
+		{
+			auto const fd = events[i].data.fd;
+			if (fd == _wakeupFd)
+			{
+				auto value = eventfd_t{};
+				eventfd_read(_wakeupFd, &value);
+				continue;
+			}
+
+			// Keep a reference on the handler, as it may remove itself while running
+			auto entry = std::shared_ptr<HandlerEntry>{};
+			{
+				// Lock
+				auto const lg = std::lock_guard(_lock);
+
+				// Descriptor removed while processing previous events
+				auto const it = _handlers.find(fd);
+				if (it == _handlers.end())
+				{
+					continue;
+				}
+				entry = it->second;
+			}
+
+			// Only lock this handler (each network namespace has its own), so a slow observer of a namespace doesn't delay the other namespaces
+			auto const lg = std::lock_guard(entry->lock);
+			if (!entry->isActive)
+			{
+				continue;
+			}
+			try
+			{
+				entry->handler();
+			}
+			catch (...)
+			{
+				// Ignore exceptions
+			}
+		}
+	}
+
+	// Deleted compiler auto-generated methods
+	EventLoop(EventLoop const&) = delete;
+	EventLoop(EventLoop&&) = delete;
+	EventLoop& operator=(EventLoop const&) = delete;
+	EventLoop& operator=(EventLoop&&) = delete;
+
+private:
+	EventLoop() noexcept
+		: _epollFd{ epoll_create1(EPOLL_CLOEXEC) }
+		, _wakeupFd{ eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK) }
+	{
+		if (_epollFd >= 0 && _wakeupFd >= 0)
+		{
+			auto event = epoll_event{};
+			event.events = EPOLLIN;
+			event.data.fd = _wakeupFd;
+			epoll_ctl(_epollFd, EPOLL_CTL_ADD, _wakeupFd, &event);
+		}
+	}
+
+	~EventLoop() noexcept
+	{
+		_shouldTerminate = true;
+		if (_thread.joinable())
+		{
+			eventfd_write(_wakeupFd, 1);
+			_thread.join();
+		}
+		for (auto const fd : { _epollFd, _wakeupFd })
+		{
+			if (fd >= 0)
+			{
+				close(fd);
+			}
+		}
+	}
+
+	struct HandlerEntry
+	{
+		std::recursive_mutex lock{}; /** Held while the handler is running (recursive, so the handler can remove itself) */
+		Handler handler{};
+		bool isActive{ true }; /** False once the descriptor has been removed */
+	};
+
+	// Private members
+	int const _epollFd{ -1 };
+	int const _wakeupFd{ -1 };
+	std::recursive_mutex _lock{};
+	std::unordered_map<int, std::shared_ptr<HandlerEntry>> _handlers{};
+	std::thread _thread{};
+	std::atomic_bool _shouldTerminate{ false };
+	bool _isExternal{ false };
+	std::atomic<std::thread::id> _externalProcessingThread{}; // Last thread that called processExternalEvents
+};
+
 class OsDependentDelegate_Unix final : public OsDependentDelegate
 {
 public:
-	OsDependentDelegate_Unix(CommonDelegate& commonDelegate) noexcept
+	/** Constructor. If specified, takes ownership of the network namespace file descriptor. */
+	OsDependentDelegate_Unix(CommonDelegate& commonDelegate, int const networkNamespace = -1) noexcept
 		: _commonDelegate{ commonDelegate }
+		, _networkNamespace{ networkNamespace }
+		, _eventLoop{ EventLoop::getInstance() } // Get the event loop now so it outlives us
 	{
 	}
 
 	virtual ~OsDependentDelegate_Unix() noexcept
 	{
-		terminateObserverThread();
+		stopMonitoring();
+
+		// Lock
+		auto const lg = std::lock_guard(_refreshLock);
+		closeFileDescriptor(_netlinkRequestSocket);
+		closeFileDescriptor(_ioctlSocket);
+		closeFileDescriptor(_networkNamespace);
+	}
+
+	/** Opens the sockets used to query the interfaces (if not already opened). Returns false if they cannot be opened. */
+	bool openRequestSockets() noexcept
+	{
+		if (_netlinkRequestSocket < 0)
+		{
+			_netlinkRequestSocket = createSocket(
+				[]()
+				{
+					return openNetlinkSocket(0);
+				});
+			_isStrictChecking = false;
+#if defined(NETLINK_GET_STRICT_CHK)
+			// Ask the kernel to only dump the addresses of the requested interface (Linux 4.20+), instead of all the addresses of the host
+			if (_netlinkRequestSocket >= 0)
+			{
+				auto const enable = int{ 1 };
+				_isStrictChecking = setsockopt(_netlinkRequestSocket, SOL_NETLINK, NETLINK_GET_STRICT_CHK, &enable, sizeof(enable)) == 0;
+			}
+#endif // NETLINK_GET_STRICT_CHK
+		}
+		if (_ioctlSocket < 0)
+		{
+			_ioctlSocket = createSocket(
+				[]()
+				{
+					return socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+				});
+		}
+		return _netlinkRequestSocket >= 0 && _ioctlSocket >= 0;
 	}
 
 private:
 	// Private methods
-	static Interface::Type getInterfaceType(struct ifaddrs const* const ifa, int const sock) noexcept
+	using InterfaceNames = std::unordered_map<int, std::string>; // Interface index to interface name
+
+	static Interface::Type getInterfaceType(char const* const name, unsigned int const flags, int const sock) noexcept
 	{
 		// Check for loopback
-		if ((ifa->ifa_flags & IFF_LOOPBACK) != 0)
+		if ((flags & IFF_LOOPBACK) != 0)
 			return Interface::Type::Loopback;
 
 		// Check for WiFi
 		{
 			struct iwreq wrq;
 			memset(&wrq, 0, sizeof(wrq));
-			strncpy(wrq.ifr_name, ifa->ifa_name, IFNAMSIZ - 1);
+			strncpy(wrq.ifr_name, name, IFNAMSIZ - 1);
 			if (ioctl(sock, SIOCGIWNAME, &wrq) != -1)
 			{
 				// TODO: Might not be 802.11 only, find a way to differenciate wireless protocols... maybe with  "wrq.u.name" with partial string match, but it may not be standard
@@ -101,7 +401,7 @@ private:
 		return Interface::Type::Ethernet;
 	}
 
-	static void refreshInterfaces(Interfaces& interfaces) noexcept
+	static void refreshInterfaces(Interfaces& interfaces, InterfaceNames* const interfaceNames = nullptr) noexcept
 	{
 		std::unique_ptr<struct ifaddrs, std::function<void(struct ifaddrs*)>> scopedIfa{ nullptr, [](struct ifaddrs* ptr)
 			{
@@ -140,13 +440,7 @@ private:
 				interface.id = ifa->ifa_name;
 				interface.description = ifa->ifa_name;
 				interface.alias = ifa->ifa_name;
-				interface.type = getInterfaceType(ifa, sck);
-				// Check if interface is enabled
-				interface.isEnabled = (ifa->ifa_flags & IFF_UP) == IFF_UP;
-				// Check if interface is connected
-				interface.isConnected = (ifa->ifa_flags & (IFF_UP | IFF_RUNNING)) == (IFF_UP | IFF_RUNNING);
-				// Is interface Virtual (TODO: Try to detect for other kinds)
-				interface.isVirtual = interface.type == Interface::Type::Loopback;
+				setInterfaceFlags(interface, ifa->ifa_flags, sck);
 
 				// Get the mac address contained in the AF_PACKET specific data
 				auto sll = reinterpret_cast<struct sockaddr_ll*>(ifa->ifa_addr);
@@ -154,6 +448,11 @@ private:
 				{
 					std::memcpy(interface.macAddress.data(), sll->sll_addr, 6);
 				}
+				interface.index = static_cast<std::uint32_t>(sll->sll_ifindex);
+				if (interfaceNames != nullptr)
+				{
+					(*interfaceNames)[sll->sll_ifindex] = ifa->ifa_name;
+				}
 				interfaces[ifa->ifa_name] = interface;
 			}
 			/* For an AF_INET* interface address, get the IP */
@@ -165,26 +464,15 @@ private:
 				{
 					auto& interface = intfcIt->second;
 
-					char host[NI_MAXHOST];
-					auto ret = getnameinfo(ifa->ifa_addr, (family == AF_INET) ? sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6), host, sizeof(host) - 1, nullptr, 0, NI_NUMERICHOST);
-					if (ret != 0)
-					{
-						continue;
-					}
-					host[NI_MAXHOST - 1] = 0;
-
-					char mask[NI_MAXHOST];
-					ret = getnameinfo(ifa->ifa_netmask, (family == AF_INET) ? sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6), mask, sizeof(mask) - 1, nullptr, 0, NI_NUMERICHOST);
-					if (ret != 0)
+					if (ifa->ifa_netmask == nullptr)
 					{
 						continue;
 					}
-					mask[NI_MAXHOST - 1] = 0;
 
 					// Add the IP address of that interface
 					try
 					{
-						interface.ipAddressInfos.emplace_back(IPAddressInfo{ IPAddress{ host }, IPAddress{ mask } });
+						interface.ipAddressInfos.emplace_back(IPAddressInfo{ IPAddress{ *ifa->ifa_addr }, IPAddress{ *ifa->ifa_netmask } });
 					}
 					catch (...)
 					{
@@ -197,14 +485,464 @@ private:
 		close(sck);
 	}
 
-	void terminateObserverThread() noexcept
+	static void setInterfaceFlags(Interface& interface, unsigned int const flags, int const sock) noexcept
 	{
-		_shouldTerminate = true;
-		if (_observerThread.joinable())
+		interface.type = getInterfaceType(interface.id.c_str(), flags, sock);
+		// Check if interface is enabled
+		interface.isEnabled = (flags & IFF_UP) == IFF_UP;
+		// Check if interface is connected
+		interface.isConnected = (flags & (IFF_UP | IFF_RUNNING)) == (IFF_UP | IFF_RUNNING);
+		// Is interface Virtual (TODO: Try to detect for other kinds)
+		interface.isVirtual = interface.type == Interface::Type::Loopback;
+	}
+
+	static int openNetlinkSocket(std::uint32_t const groups) noexcept
+	{
+		auto const sock = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+		if (sock < 0)
+		{
+			return -1;
+		}
+
+		auto addr = sockaddr_nl{};
+		addr.nl_family = AF_NETLINK;
+		addr.nl_groups = groups;
+		if (bind(sock, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0)
 		{
-			_observerThread.join();
-			_observerThread = {};
-			_enumeratedOnce = false;
+			close(sock);
+			return -1;
+		}
+
+		return sock;
+	}
+
+	/** Sends a netlink request and calls the handler for each reply message, until the request is complete. Returns 0 on success, the error code otherwise. */
+	template<typename Request, typename Handler>
+	int netlinkRequest(std::uint16_t const type, std::uint16_t const flags, Request const& request, Handler&& onMessage) noexcept
+	{
+		struct
+		{
+			nlmsghdr header;
+			Request request;
+		} message{};
+		message.header.nlmsg_len = NLMSG_LENGTH(sizeof(Request));
+		message.header.nlmsg_type = type;
+		message.header.nlmsg_flags = NLM_F_REQUEST | flags;
+		message.header.nlmsg_seq = ++_netlinkSequence;
+		message.request = request;
+
+		if (send(_netlinkRequestSocket, &message, message.header.nlmsg_len, 0) < 0)
+		{
+			return errno;
+		}
+
+		while (true)
+		{
+			auto const len = recv(_netlinkRequestSocket, _netlinkBuffer.data(), _netlinkBuffer.size(), 0);
+			if (len < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				return errno;
+			}
+
+			auto remaining = static_cast<unsigned int>(len);
+			for (auto const* header = reinterpret_cast<nlmsghdr const*>(_netlinkBuffer.data()); NLMSG_OK(header, remaining); header = NLMSG_NEXT(header, remaining))
+			{
+				// Not the answer to our request (should not happen)
+				if (header->nlmsg_seq != message.header.nlmsg_seq)
+				{
+					continue;
+				}
+				if (header->nlmsg_type == NLMSG_DONE)
+				{
+					return 0;
+				}
+				if (header->nlmsg_type == NLMSG_ERROR)
+				{
+					return -static_cast<nlmsgerr const*>(NLMSG_DATA(header))->error;
+				}
+				onMessage(header);
+				// Single message answer
+				if ((header->nlmsg_flags & NLM_F_MULTI) == 0)
+				{
+					return 0;
+				}
+			}
+		}
+	}
+	/** Retrieves the specified interface (or all interfaces if interfaceIndex is 0) using netlink. Returns false if the request failed (a non-existing interface is not a failure). */
+	bool queryInterfaces(int const interfaceIndex, Interfaces& interfaces, InterfaceNames& interfaceNames) noexcept
+	{
+		// Get the link information
+		{
+			auto request = ifinfomsg{};
+			request.ifi_family = AF_UNSPEC;
+			request.ifi_index = interfaceIndex;
+			auto const error = netlinkRequest(RTM_GETLINK, interfaceIndex == 0 ? NLM_F_DUMP : 0, request,
+				[this, &interfaces, &interfaceNames, interfaceIndex](nlmsghdr const* const header)
+				{
+					if (header->nlmsg_type != RTM_NEWLINK)
+					{
+						return;
+					}
+					auto const* const info = static_cast<ifinfomsg const*>(NLMSG_DATA(header));
+					if (interfaceIndex != 0 && info->ifi_index != interfaceIndex)
+					{
+						return;
+					}
+
+					auto interface = Interface{};
+					auto attrLength = static_cast<unsigned int>(IFLA_PAYLOAD(header));
+					for (auto const* attr = IFLA_RTA(info); RTA_OK(attr, attrLength); attr = RTA_NEXT(attr, attrLength))
+					{
+						switch (attr->rta_type)
+						{
+							case IFLA_IFNAME:
+								interface.id = static_cast<char const*>(RTA_DATA(attr));
+								break;
+							case IFLA_ADDRESS:
+								if (RTA_PAYLOAD(attr) == interface.macAddress.size())
+								{
+									std::memcpy(interface.macAddress.data(), RTA_DATA(attr), interface.macAddress.size());
+								}
+								break;
+							default:
+								break;
+						}
+					}
+					if (interface.id.empty())
+					{
+						return;
+					}
+					interface.description = interface.id;
+					interface.alias = interface.id;
+					interface.index = static_cast<std::uint32_t>(info->ifi_index);
+					setInterfaceFlags(interface, info->ifi_flags, _ioctlSocket);
+					try
+					{
+						interfaceNames[info->ifi_index] = interface.id;
+						auto const name = interface.id;
+						interfaces[name] = std::move(interface);
+					}
+					catch (...)
+					{
+					}
+				});
+			// The requested interface doesn't exist (anymore)
+			if (error == ENODEV && interfaceIndex != 0)
+			{
+				return true;
+			}
+			if (error != 0)
+			{
+				return false;
+			}
+		}
+
+		// Get the IP addresses
+		{
+			auto request = ifaddrmsg{};
+			request.ifa_family = AF_UNSPEC;
+			// With strict checking the kernel only dumps the addresses of this interface, otherwise all addresses are dumped and filtered below
+			if (_isStrictChecking)
+			{
+				request.ifa_index = static_cast<decltype(request.ifa_index)>(interfaceIndex);
+			}
+			auto const error = netlinkRequest(RTM_GETADDR, NLM_F_DUMP, request,
+				[&interfaces, &interfaceNames, interfaceIndex](nlmsghdr const* const header)
+				{
+					if (header->nlmsg_type != RTM_NEWADDR)
+					{
+						return;
+					}
+					auto const* const info = static_cast<ifaddrmsg const*>(NLMSG_DATA(header));
+					if ((interfaceIndex != 0 && static_cast<int>(info->ifa_index) != interfaceIndex) || (info->ifa_family != AF_INET && info->ifa_family != AF_INET6))
+					{
+						return;
+					}
+					auto const nameIt = interfaceNames.find(static_cast<int>(info->ifa_index));
+					if (nameIt == interfaceNames.end())
+					{
+						return;
+					}
+					auto& interface = interfaces[nameIt->second];
+
+					// Same logic than getifaddrs: Use IFA_LOCAL if present (IFA_ADDRESS being the peer address for point-to-point interfaces), IFA_ADDRESS otherwise
+					auto const* address = static_cast<void const*>(nullptr);
+					auto attrLength = static_cast<unsigned int>(IFA_PAYLOAD(header));
+					for (auto const* attr = IFA_RTA(info); RTA_OK(attr, attrLength); attr = RTA_NEXT(attr, attrLength))
+					{
+						if (attr->rta_type == IFA_LOCAL || (attr->rta_type == IFA_ADDRESS && address == nullptr))
+						{
+							address = RTA_DATA(attr);
+						}
+					}
+					if (address == nullptr)
+					{
+						return;
+					}
+
+					try
+					{
+						if (info->ifa_family == AF_INET)
+						{
+							auto addr = in_addr{};
+							std::memcpy(&addr, address, sizeof(addr));
+							interface.ipAddressInfos.emplace_back(IPAddressInfo{ IPAddress{ addr }, IPAddress{ makePackedMaskV4(info->ifa_prefixlen) } });
+						}
+						else
+						{
+							auto addr = in6_addr{};
+							std::memcpy(&addr, address, sizeof(addr));
+							interface.ipAddressInfos.emplace_back(IPAddressInfo{ IPAddress{ addr }, IPAddress{ IPAddress::packedV6FromPrefixLength(info->ifa_prefixlen) } });
+						}
+					}
+					catch (...)
+					{
+					}
+				});
+			if (error != 0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/** Refreshes a single interface and notifies only what changed */
+	void refreshInterface(int const interfaceIndex) noexcept
+	{
+		auto interfaces = Interfaces{};
+		auto interfaceNames = InterfaceNames{};
+		auto const queryStart = std::chrono::steady_clock::now();
+		// Failed to query the interface (which is different than the interface not existing anymore), keep the current state
+		if (!queryInterfaces(interfaceIndex, interfaces, interfaceNames))
+		{
+			return;
+		}
+		_commonDelegate.onInterfacesQueried(false, std::chrono::steady_clock::now() - queryStart);
+
+		auto const previousNameIt = _interfaceNames.find(interfaceIndex);
+		auto const newNameIt = interfaceNames.find(interfaceIndex);
+
+		// Interface has been removed, or renamed
+		if (previousNameIt != _interfaceNames.end() && (newNameIt == interfaceNames.end() || previousNameIt->second != newNameIt->second))
+		{
+			_commonDelegate.onInterfaceRemoved(previousNameIt->second);
+			_interfaceNames.erase(previousNameIt);
+		}
+
+		if (newNameIt != interfaceNames.end())
+		{
+			auto const& name = newNameIt->second;
+			_interfaceNames[interfaceIndex] = name;
+			_commonDelegate.onInterfaceRefreshed(name, std::move(interfaces[name]));
+		}
+	}
+
+	void fullRefresh() noexcept
+	{
+		auto newList = Interfaces{};
+		auto newNames = InterfaceNames{};
+		auto const queryStart = std::chrono::steady_clock::now();
+
+		// Netlink works from any network namespace, getifaddrs can only be used as a fallback for the namespace of the process
+		if (!openRequestSockets() || !queryInterfaces(0, newList, newNames))
+		{
+			if (_networkNamespace >= 0)
+			{
+				return;
+			}
+			newList.clear();
+			newNames.clear();
+			refreshInterfaces(newList, &newNames);
+		}
+		_commonDelegate.onInterfacesQueried(true, std::chrono::steady_clock::now() - queryStart);
+		_interfaceNames = std::move(newNames);
+
+		// Check for changes in Interfaces
+		_commonDelegate.onNewInterfacesList(std::move(newList));
+	}
+
+	/** Reads pending netlink notifications and returns the indexes of the interfaces that changed. Returns std::nullopt if some notifications were lost. */
+	std::optional<std::set<int>> readNetlinkNotifications() noexcept
+	{
+		auto changedInterfaces = std::set<int>{};
+		while (true)
+		{
+			auto const len = recv(_netlinkMonitorSocket, _netlinkBuffer.data(), _netlinkBuffer.size(), MSG_DONTWAIT);
+			if (len < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				// Socket buffer overrun, we lost some notifications
+				if (errno == ENOBUFS)
+				{
+					return std::nullopt;
+				}
+				// EAGAIN: Nothing more to read
+				break;
+			}
+
+			auto remaining = static_cast<unsigned int>(len);
+			for (auto const* header = reinterpret_cast<nlmsghdr const*>(_netlinkBuffer.data()); NLMSG_OK(header, remaining); header = NLMSG_NEXT(header, remaining))
+			{
+				switch (header->nlmsg_type)
+				{
+					case RTM_NEWLINK:
+					case RTM_DELLINK:
+						changedInterfaces.insert(static_cast<ifinfomsg const*>(NLMSG_DATA(header))->ifi_index);
+						break;
+					case RTM_NEWADDR:
+					case RTM_DELADDR:
+						changedInterfaces.insert(static_cast<int>(static_cast<ifaddrmsg const*>(NLMSG_DATA(header))->ifa_index));
+						break;
+					default:
+						break;
+				}
+			}
+		}
+		return changedInterfaces;
+	}
+	/** Called from the event loop when netlink notifications are pending */
+	void onNetlinkNotifications() noexcept
+	{
+		// Lock
+		auto const lg = std::lock_guard(_refreshLock);
+
+		// Monitoring stopped in the meantime
+		if (_netlinkMonitorSocket < 0)
+		{
+			return;
+		}
+
+		auto const changedInterfaces = readNetlinkNotifications();
+		// We lost some notifications, fallback to a full refresh
+		if (!changedInterfaces)
+		{
+			fullRefresh();
+			return;
+		}
+
+		// Only refresh the interfaces that changed
+		for (auto const interfaceIndex : *changedInterfaces)
+		{
+			refreshInterface(interfaceIndex);
+		}
+	}
+
+	/** Creates a socket in the network namespace this delegate is bound to */
+	template<typename SocketCreator>
+	int createSocket(SocketCreator&& creator) const noexcept
+	{
+		if (_networkNamespace < 0)
+		{
+			return creator();
+		}
+
+		// A socket belongs to the network namespace of the thread creating it, use a temporary thread so the calling one is not moved to another namespace
+		auto sock = -1;
+		try
+		{
+			auto thread = std::thread(
+				[this, &sock, &creator]()
+				{
+					if (setns(_networkNamespace, CLONE_NEWNET) == 0)
+					{
+						sock = creator();
+					}
+				});
+			thread.join();
+		}
+		catch (...)
+		{
+		}
+		return sock;
+	}
+
+	static void closeFileDescriptor(int& fd) noexcept
+	{
+		if (fd >= 0)
+		{
+			close(fd);
+			fd = -1;
+		}
+	}
+
+	/** Called from the event loop when the polling timer expired */
+	void onPollingTimer() noexcept
+	{
+		// Lock
+		auto const lg = std::lock_guard(_refreshLock);
+
+		// Monitoring stopped in the meantime
+		if (_pollingTimer < 0)
+		{
+			return;
+		}
+
+		auto expirations = std::uint64_t{};
+		if (read(_pollingTimer, &expirations, sizeof(expirations)) == static_cast<ssize_t>(sizeof(expirations)))
+		{
+			fullRefresh();
+		}
+	}
+
+	/** Starts refreshing all interfaces every second, when netlink notifications are not available */
+	void startPolling() noexcept
+	{
+		{
+			// Lock
+			auto const lg = std::lock_guard(_refreshLock);
+
+			_pollingTimer = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+			if (_pollingTimer < 0)
+			{
+				return;
+			}
+
+			auto spec = itimerspec{};
+			spec.it_value.tv_nsec = 1; // First refresh as soon as possible
+			spec.it_interval.tv_sec = 1;
+			if (timerfd_settime(_pollingTimer, 0, &spec, nullptr) < 0)
+			{
+				closeFileDescriptor(_pollingTimer);
+				return;
+			}
+		}
+
+		// Register to the shared event loop (outside the lock, as the event loop locks itself before calling our handler)
+		if (!_eventLoop.addFileDescriptor(_pollingTimer,
+					[this]()
+					{
+						onPollingTimer();
+					}))
+		{
+			// Lock
+			auto const lg = std::lock_guard(_refreshLock);
+			closeFileDescriptor(_pollingTimer);
+		}
+	}
+
+	void stopMonitoring() noexcept
+	{
+		// Unregister from the event loop (which guarantees our handlers are not running anymore when returning)
+		for (auto* const fd : { &_netlinkMonitorSocket, &_pollingTimer })
+		{
+			if (*fd >= 0)
+			{
+				_eventLoop.removeFileDescriptor(*fd);
+
+				// Lock
+				auto const lg = std::lock_guard(_refreshLock);
+				closeFileDescriptor(*fd);
+			}
 		}
 	}
 
@@ -215,55 +953,90 @@ private:
 		// Check if enumeration was run at least once
 		if (!_enumeratedOnce)
 		{
-			auto newList = Interfaces{};
-			refreshInterfaces(newList);
-			_commonDelegate.onNewInterfacesList(std::move(newList));
-			// Set that we enumerated at least once
-			_enumeratedOnce = true;
+			// Lock
+			auto const lg = std::lock_guard(_refreshLock);
+
+			if (!_enumeratedOnce)
+			{
+				fullRefresh();
+				// Set that we enumerated at least once
+				_enumeratedOnce = true;
+			}
 		}
 	}
 
 	/** When the first observer is registered */
 	virtual void onFirstObserverRegistered() noexcept override
 	{
-		_shouldTerminate = false;
-		_observerThread = std::thread(
-			[this]()
-			{
-				utils::setCurrentThreadName("networkInterfaceHelper::ObserverPolling");
-				auto nextCheck = std::chrono::time_point<std::chrono::system_clock>{};
-				while (!_shouldTerminate)
+		{
+			// Lock
+			auto const lg = std::lock_guard(_refreshLock);
+
+			// Try to be notified of changes using netlink (subscribe before the initial enumeration so we don't miss anything)
+			_netlinkMonitorSocket = createSocket(
+				[]()
 				{
-					auto const now = std::chrono::system_clock::now();
-					if (now >= nextCheck)
-					{
-						auto newList = Interfaces{};
-						refreshInterfaces(newList);
+					return openNetlinkSocket(RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR);
+				});
+			if (_netlinkMonitorSocket >= 0 && openRequestSockets())
+			{
+				fullRefresh();
+			}
+			else
+			{
+				closeFileDescriptor(_netlinkMonitorSocket);
+			}
+		}
 
-						// Check for changes in Interfaces
-						_commonDelegate.onNewInterfacesList(std::move(newList));
+		// Register to the shared event loop (outside the lock, as the event loop locks itself before calling our handler)
+		if (_netlinkMonitorSocket >= 0)
+		{
+			if (_eventLoop.addFileDescriptor(_netlinkMonitorSocket,
+						[this]()
+						{
+							onNetlinkNotifications();
+						}))
+			{
+				return;
+			}
 
-						// Setup next check time
-						nextCheck = now + std::chrono::milliseconds(1000);
-					}
+			// Lock
+			auto const lg = std::lock_guard(_refreshLock);
+			closeFileDescriptor(_netlinkMonitorSocket);
+		}
 
-					// Wait a little bit so we don't burn the CPU
-					std::this_thread::sleep_for(std::chrono::milliseconds(10));
-				}
-			});
+		// Netlink not available, fallback to polling
+		startPolling();
 	}
 
 	/** When the last observer is unregistered */
 	virtual void onLastObserverUnregistered() noexcept override
 	{
-		terminateObserverThread();
+		stopMonitoring();
+		_enumeratedOnce = false;
+	}
+
+	/** Returns true if the calling thread is the one processing the OS events */
+	virtual bool isEventProcessingThread() const noexcept override
+	{
+		return _eventLoop.isExternalProcessingThread();
 	}
 
 	// Private members
 	CommonDelegate& _commonDelegate;
-	std::thread _observerThread{};
-	bool _shouldTerminate{ false };
+	int _networkNamespace{ -1 }; // Network namespace file descriptor (-1 for the namespace of the process)
+	EventLoop& _eventLoop;
 	std::atomic_bool _enumeratedOnce{ false };
+	// Members protected by _refreshLock
+	std::recursive_mutex _refreshLock{};
+	int _netlinkMonitorSocket{ -1 };
+	int _pollingTimer{ -1 };
+	int _netlinkRequestSocket{ -1 };
+	bool _isStrictChecking{ false }; // True if the kernel filters the dumps of _netlinkRequestSocket (NETLINK_GET_STRICT_CHK)
+	int _ioctlSocket{ -1 };
+	std::uint32_t _netlinkSequence{ 0u };
+	std::array<std::uint8_t, 32768> _netlinkBuffer{};
+	InterfaceNames _interfaceNames{};
 };
 
 std::unique_ptr<OsDependentDelegate> getOsDependentDelegate(CommonDelegate& commonDelegate) noexcept
@@ -271,5 +1044,55 @@ std::unique_ptr<OsDependentDelegate> getOsDependentDelegate(CommonDelegate& comm
 	return std::make_unique<OsDependentDelegate_Unix>(commonDelegate);
 }
 
+#if defined(__linux__)
+int NetworkInterfaceHelper::enableExternalEventProcessing() noexcept
+{
+	return EventLoop::getInstance().enableExternalProcessing();
+}
+
+void NetworkInterfaceHelper::processEvents() noexcept
+{
+	EventLoop::getInstance().processExternalEvents();
+}
+#endif // __linux__
+
+std::unique_ptr<OsDependentDelegate> getOsDependentDelegate(CommonDelegate& commonDelegate, int const networkNamespaceFileDescriptor)
+{
+	// Keep our own copy of the descriptor, so the caller can close it
+	auto const networkNamespace = fcntl(networkNamespaceFileDescriptor, F_DUPFD_CLOEXEC, 0);
+	if (networkNamespace < 0)
+	{
+		throw std::invalid_argument("Invalid network namespace file descriptor");
+	}
+
+	auto delegate = std::make_unique<OsDependentDelegate_Unix>(commonDelegate, networkNamespace);
+	if (!delegate->openRequestSockets())
+	{
+		throw std::invalid_argument("Cannot enter the specified network namespace");
+	}
+	return delegate;
+}
+
+std::unique_ptr<OsDependentDelegate> getOsDependentDelegate(CommonDelegate& commonDelegate, std::string const& networkNamespacePath)
+{
+	auto const networkNamespace = open(networkNamespacePath.c_str(), O_RDONLY | O_CLOEXEC);
+	if (networkNamespace < 0)
+	{
+		throw std::invalid_argument("Cannot open network namespace: " + networkNamespacePath);
+	}
+
+	try
+	{
+		auto delegate = getOsDependentDelegate(commonDelegate, networkNamespace);
+		close(networkNamespace);
+		return delegate;
+	}
+	catch (...)
+	{
+		close(networkNamespace);
+		throw;
+	}
+}
+
 } // namespace networkInterface
 } // namespace la
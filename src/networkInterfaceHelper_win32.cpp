@@ -54,7 +54,6 @@
 #include <wbemidl.h>
 #include <ws2tcpip.h>
 #include <Mstcpip.h>
-#include <ip2string.h>
 #include <Windows.h>
 #include <comutil.h>
 #include <objbase.h>
@@ -390,48 +389,31 @@ private:
 					intfcIt = interfaces.emplace(adapter->AdapterName, std::move(i)).first;
 				}
 				auto& i = intfcIt->second;
+				i.index = adapter->Ipv6IfIndex != 0 ? adapter->Ipv6IfIndex : adapter->IfIndex;
 
 				// Retrieve IP addresses
 				for (auto ua = adapter->FirstUnicastAddress; ua != nullptr; ua = ua->Next)
 				{
-					auto const isIPv6 = ua->Address.lpSockaddr->sa_family == AF_INET6;
-					if (isIPv6)
+					try
 					{
-						std::array<char, 46> ip;
-						RtlIpv6AddressToStringA(&reinterpret_cast<struct sockaddr_in6*>(ua->Address.lpSockaddr)->sin6_addr, ip.data());
-						try
-						{
-							i.ipAddressInfos.push_back(IPAddressInfo{ IPAddress{ std::string(ip.data()) }, IPAddress{ makePackedMaskV6(ua->OnLinkPrefixLength) } });
-						}
-						catch (...)
-						{
-						}
+						auto const ip = IPAddress{ *ua->Address.lpSockaddr };
+						auto const mask = ip.getType() == IPAddress::Type::V6 ? IPAddress{ makePackedMaskV6(ua->OnLinkPrefixLength) } : IPAddress{ makePackedMaskV4(ua->OnLinkPrefixLength) };
+						i.ipAddressInfos.push_back(IPAddressInfo{ ip, mask });
 					}
-					else
+					catch (...)
 					{
-						i.ipAddressInfos.push_back(IPAddressInfo{ IPAddress{ ntohl(reinterpret_cast<struct sockaddr_in*>(ua->Address.lpSockaddr)->sin_addr.S_un.S_addr) }, IPAddress{ makePackedMaskV4(ua->OnLinkPrefixLength) } });
 					}
 				}
 
 				// Retrieve Gateways
 				for (auto ga = adapter->FirstGatewayAddress; ga != nullptr; ga = ga->Next)
 				{
-					auto const isIPv6 = ga->Address.lpSockaddr->sa_family == AF_INET6;
-					if (isIPv6)
+					try
 					{
-						std::array<char, 46> ip;
-						RtlIpv6AddressToStringA(&reinterpret_cast<struct sockaddr_in6*>(ga->Address.lpSockaddr)->sin6_addr, ip.data());
-						try
-						{
-							i.gateways.push_back(IPAddress{ std::string(ip.data()) });
-						}
-						catch (...)
-						{
-						}
+						i.gateways.push_back(IPAddress{ *ga->Address.lpSockaddr });
 					}
-					else
+					catch (...)
 					{
-						i.gateways.push_back(IPAddress{ ntohl(reinterpret_cast<struct sockaddr_in*>(ga->Address.lpSockaddr)->sin_addr.S_un.S_addr) });
 					}
 				}
 			}
@@ -472,50 +454,33 @@ private:
 				std::memcpy(i.macAddress.data(), adapter->PhysicalAddress, adapter->PhysicalAddressLength);
 			i.type = type;
 			i.isEnabled = true; // GetAdaptersAddresses (even GetAdaptersInfo) can only retrieve NICs that are active, so it's always Enabled
+			i.index = adapter->Ipv6IfIndex != 0 ? adapter->Ipv6IfIndex : adapter->IfIndex;
 			i.isConnected = adapter->OperStatus == IfOperStatusUp;
 			i.isVirtual = type == Interface::Type::Loopback; // GetAdaptersAddresses (even GetAdaptersInfo) cannot get the Virtual information (that WMI can), so only define Loopback as virtual
 
 			// Retrieve IP addresses
 			for (auto ua = adapter->FirstUnicastAddress; ua != nullptr; ua = ua->Next)
 			{
-				auto const isIPv6 = ua->Address.lpSockaddr->sa_family == AF_INET6;
-				if (isIPv6)
+				try
 				{
-					std::array<char, 46> ip;
-					RtlIpv6AddressToStringA(&reinterpret_cast<struct sockaddr_in6*>(ua->Address.lpSockaddr)->sin6_addr, ip.data());
-					try
-					{
-						i.ipAddressInfos.push_back(IPAddressInfo{ IPAddress{ std::string(ip.data()) }, IPAddress{ makePackedMaskV6(ua->OnLinkPrefixLength) } });
-					}
-					catch (...)
-					{
-					}
+					auto const ip = IPAddress{ *ua->Address.lpSockaddr };
+					auto const mask = ip.getType() == IPAddress::Type::V6 ? IPAddress{ makePackedMaskV6(ua->OnLinkPrefixLength) } : IPAddress{ makePackedMaskV4(ua->OnLinkPrefixLength) };
+					i.ipAddressInfos.push_back(IPAddressInfo{ ip, mask });
 				}
-				else
+				catch (...)
 				{
-					i.ipAddressInfos.push_back(IPAddressInfo{ IPAddress{ ntohl(reinterpret_cast<struct sockaddr_in*>(ua->Address.lpSockaddr)->sin_addr.S_un.S_addr) }, IPAddress{ makePackedMaskV4(ua->OnLinkPrefixLength) } });
 				}
 			}
 
 			// Retrieve Gateways
 			for (auto ga = adapter->FirstGatewayAddress; ga != nullptr; ga = ga->Next)
 			{
-				auto const isIPv6 = ga->Address.lpSockaddr->sa_family == AF_INET6;
-				if (isIPv6)
+				try
 				{
-					std::array<char, 46> ip;
-					RtlIpv6AddressToStringA(&reinterpret_cast<struct sockaddr_in6*>(ga->Address.lpSockaddr)->sin6_addr, ip.data());
-					try
-					{
-						i.gateways.push_back(IPAddress{ std::string(ip.data()) });
-					}
-					catch (...)
-					{
-					}
+					i.gateways.push_back(IPAddress{ *ga->Address.lpSockaddr });
 				}
-				else
+				catch (...)
 				{
-					i.gateways.push_back(IPAddress{ ntohl(reinterpret_cast<struct sockaddr_in*>(ga->Address.lpSockaddr)->sin_addr.S_un.S_addr) });
 				}
 			}
 
@@ -538,6 +503,7 @@ private:
 
 	void refreshInterfaces(Interfaces& interfaces) noexcept
 	{
+		auto const queryStart = std::chrono::steady_clock::now();
 		if (_comGuard.has_value())
 		{
 			if (!refreshInterfaces_WMI(interfaces))
@@ -555,6 +521,8 @@ private:
 		{
 			refreshInterfaces_WinAPI(interfaces);
 		}
+
+		_commonDelegate.onInterfacesQueried(true, std::chrono::steady_clock::now() - queryStart);
 	}
 
 	void createObserverThread() noexcept
@@ -0,0 +1,87 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+ * @file ouiDatabase.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "networkInterfaceHelper_common.hpp"
+
+#ifdef NIH_ENABLE_OUI_DATABASE
+#	include "ouiDatabase.hpp" // Generated by generateOuiDatabase.cmake
+#endif // NIH_ENABLE_OUI_DATABASE
+
+namespace la
+{
+namespace networkInterface
+{
+#ifdef NIH_ENABLE_OUI_DATABASE
+/** Fibonacci hashing (32-bit) of the OUI, must match the one in generateOuiDatabase.cmake */
+static constexpr std::uint32_t hashOui(std::uint32_t const oui) noexcept
+{
+	return static_cast<std::uint32_t>(oui * 2654435761u) >> (32u - OuiBucketBits);
+}
+#endif // NIH_ENABLE_OUI_DATABASE
+
+bool NetworkInterfaceHelper::isOuiDatabaseAvailable() noexcept
+{
+#ifdef NIH_ENABLE_OUI_DATABASE
+	return true;
+#else // !NIH_ENABLE_OUI_DATABASE
+	return false;
+#endif // NIH_ENABLE_OUI_DATABASE
+}
+
+std::string_view NetworkInterfaceHelper::getMacAddressVendor(MacAddress const& macAddress) noexcept
+{
+#ifdef NIH_ENABLE_OUI_DATABASE
+	auto const oui = (std::uint32_t{ macAddress[0] } << 16) | (std::uint32_t{ macAddress[1] } << 8) | std::uint32_t{ macAddress[2] };
+	auto const bucket = hashOui(oui);
+
+	// Buckets only hold 1 or 2 entries on average
+	for (auto index = OuiBucketStarts[bucket]; index < OuiBucketStarts[bucket + 1]; ++index)
+	{
+		if (Ouis[index] == oui)
+		{
+			return OuiVendorNames[OuiVendorIndexes[index]];
+		}
+	}
+#else // !NIH_ENABLE_OUI_DATABASE
+	(void)macAddress;
+#endif // NIH_ENABLE_OUI_DATABASE
+	return {};
+}
+
+} // namespace networkInterface
+} // namespace la
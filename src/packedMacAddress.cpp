@@ -0,0 +1,166 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+ * @file packedMacAddress.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "la/networkInterfaceHelper/packedMacAddress.hpp"
+
+namespace la
+{
+namespace networkInterface
+{
+/* ************************************************************ */
+/* MacAddressFlatSet class definition                           */
+/* ************************************************************ */
+MacAddressFlatSet::MacAddressFlatSet(container_type addresses)
+	: _addresses{ std::move(addresses) }
+{
+	std::sort(_addresses.begin(), _addresses.end());
+	_addresses.erase(std::unique(_addresses.begin(), _addresses.end()), _addresses.end());
+}
+
+bool MacAddressFlatSet::insert(PackedMacAddress const address)
+{
+	auto const it = std::lower_bound(_addresses.begin(), _addresses.end(), address);
+	if (it != _addresses.end() && *it == address)
+	{
+		return false;
+	}
+	_addresses.insert(it, address);
+	return true;
+}
+
+void MacAddressFlatSet::insert(container_type addresses)
+{
+	auto const previousSize = static_cast<container_type::difference_type>(_addresses.size());
+
+	// Sort the new addresses only, then merge them with the already sorted ones
+	_addresses.insert(_addresses.end(), addresses.begin(), addresses.end());
+	std::sort(_addresses.begin() + previousSize, _addresses.end());
+	std::inplace_merge(_addresses.begin(), _addresses.begin() + previousSize, _addresses.end());
+	_addresses.erase(std::unique(_addresses.begin(), _addresses.end()), _addresses.end());
+}
+
+bool MacAddressFlatSet::erase(PackedMacAddress const address) noexcept
+{
+	auto const it = std::lower_bound(_addresses.begin(), _addresses.end(), address);
+	if (it == _addresses.end() || *it != address)
+	{
+		return false;
+	}
+	_addresses.erase(it);
+	return true;
+}
+
+bool MacAddressFlatSet::contains(PackedMacAddress const address) const noexcept
+{
+	return std::binary_search(_addresses.begin(), _addresses.end(), address);
+}
+
+std::size_t MacAddressFlatSet::contains(PackedMacAddress const* const addresses, std::size_t const count, bool* const results) const noexcept
+{
+	auto found = std::size_t{ 0u };
+	auto searchBegin = _addresses.begin();
+	auto previous = PackedMacAddress{};
+
+	for (auto i = std::size_t{ 0u }; i < count; ++i)
+	{
+		auto const address = addresses[i];
+
+		// As long as the queried addresses are sorted, only search past the previous result
+		if (address < previous)
+		{
+			searchBegin = _addresses.begin();
+		}
+		searchBegin = std::lower_bound(searchBegin, _addresses.end(), address);
+		previous = address;
+
+		auto const isPresent = searchBegin != _addresses.end() && *searchBegin == address;
+		results[i] = isPresent;
+		if (isPresent)
+		{
+			++found;
+		}
+	}
+
+	return found;
+}
+
+MacAddressFlatSet::Range MacAddressFlatSet::getRange(PackedMacAddress const first, PackedMacAddress const last) const noexcept
+{
+	if (last < first)
+	{
+		return { _addresses.end(), _addresses.end() };
+	}
+	auto const begin = std::lower_bound(_addresses.begin(), _addresses.end(), first);
+	auto const end = std::upper_bound(begin, _addresses.end(), last);
+	return { begin, end };
+}
+
+MacAddressFlatSet::Range MacAddressFlatSet::getPrefixRange(PackedMacAddress const prefix, std::uint8_t const prefixLength) const noexcept
+{
+	return getRange(prefix.getFirstAddress(prefixLength), prefix.getLastAddress(prefixLength));
+}
+
+std::optional<PackedMacAddress> MacAddressFlatSet::findFreeBlock(PackedMacAddress const first, PackedMacAddress const last, PackedMacAddress::value_type const count) const noexcept
+{
+	if (count == 0u || last < first)
+	{
+		return std::nullopt;
+	}
+
+	// Values are 48 bits wide, so computing sizes on 64 bits cannot overflow
+	auto candidate = first.getValue();
+	auto const [begin, end] = getRange(first, last);
+	for (auto it = begin; it != end; ++it)
+	{
+		auto const used = it->getValue();
+		if (used - candidate >= count)
+		{
+			return PackedMacAddress{ candidate };
+		}
+		candidate = used + 1u;
+	}
+
+	if (candidate <= last.getValue() && last.getValue() - candidate + 1u >= count)
+	{
+		return PackedMacAddress{ candidate };
+	}
+	return std::nullopt;
+}
+
+} // namespace networkInterface
+} // namespace la
@@ -0,0 +1,206 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+ * @file statistics.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "networkInterfaceHelper_common.hpp"
+
+#include <sstream>
+#include <cmath> // ceil
+#include <algorithm> // min/max/count_if
+#include <limits>
+
+namespace la
+{
+namespace networkInterface
+{
+using Histogram = NetworkInterfaceHelper::Statistics::Histogram;
+
+static std::size_t getHighestBitIndex(std::uint64_t value) noexcept
+{
+	auto index = std::size_t{ 0u };
+	for (auto shift = 32u; shift != 0u; shift /= 2u)
+	{
+		if ((value >> shift) != 0u)
+		{
+			value >>= shift;
+			index += shift;
+		}
+	}
+	return index;
+}
+
+std::size_t Histogram::getBucketIndex(std::uint64_t const value) noexcept
+{
+	// Values below 8 have their own bucket
+	if (value < 2u * SubBucketsCount)
+	{
+		return static_cast<std::size_t>(value);
+	}
+	// Then the 2 bits following the highest bit select the sub-bucket
+	auto const highestBit = getHighestBitIndex(value);
+	auto const subBucket = static_cast<std::size_t>((value >> (highestBit - 2u)) & (SubBucketsCount - 1u));
+	return 2u * SubBucketsCount + (highestBit - 3u) * SubBucketsCount + subBucket;
+}
+
+std::uint64_t Histogram::getBucketLowerBound(std::size_t const index) noexcept
+{
+	if (index < 2u * SubBucketsCount)
+	{
+		return index;
+	}
+	auto const highestBit = 3u + (index - 2u * SubBucketsCount) / SubBucketsCount;
+	auto const subBucket = (index - 2u * SubBucketsCount) % SubBucketsCount;
+	return static_cast<std::uint64_t>(SubBucketsCount + subBucket) << (highestBit - 2u);
+}
+
+std::uint64_t Histogram::getPercentile(double const percentile) const noexcept
+{
+	if (count == 0u)
+	{
+		return 0u;
+	}
+
+	auto const target = std::max<std::uint64_t>(1u, static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count))));
+	auto cumulated = std::uint64_t{ 0u };
+	for (auto index = 0u; index < BucketsCount; ++index)
+	{
+		cumulated += buckets[index];
+		if (cumulated >= target)
+		{
+			auto const upperBound = index + 1u < BucketsCount ? getBucketLowerBound(index + 1u) - 1u : std::numeric_limits<std::uint64_t>::max();
+			return std::min(upperBound, max);
+		}
+	}
+	return max;
+}
+
+static void writeHistogram(std::ostringstream& ss, std::string const& name, std::string const& labels, Histogram const& histogram)
+{
+	auto const separator = labels.empty() ? "" : ",";
+
+	// Cumulative buckets at each power of 2 between 1us and 17s (which are exact bucket boundaries)
+	auto cumulated = std::uint64_t{ 0u };
+	auto index = std::size_t{ 0u };
+	for (auto power = 10u; power <= 34u; ++power)
+	{
+		auto const bound = std::uint64_t{ 1u } << power;
+		for (auto const end = Histogram::getBucketIndex(bound); index < end; ++index)
+		{
+			cumulated += histogram.buckets[index];
+		}
+		ss << name << "_bucket{" << labels << separator << "le=\"" << static_cast<double>(bound) / 1e9 << "\"} " << cumulated << "\n";
+	}
+	ss << name << "_bucket{" << labels << separator << "le=\"+Inf\"} " << histogram.count << "\n";
+	ss << name << "_sum" << (labels.empty() ? "" : "{" + labels + "}") << " " << static_cast<double>(histogram.sum) / 1e9 << "\n";
+	ss << name << "_count" << (labels.empty() ? "" : "{" + labels + "}") << " " << histogram.count << "\n";
+}
+
+std::string NetworkInterfaceHelper::statisticsToPrometheusText(Statistics const& statistics, std::string const& metricsPrefix) noexcept
+{
+	try
+	{
+		auto ss = std::ostringstream{};
+		ss.precision(10); // Enough to represent power of 2 bucket boundaries exactly
+		auto const writeHeader = [&ss, &metricsPrefix](std::string const& name, char const* const type, char const* const help)
+		{
+			ss << "# HELP " << metricsPrefix << "_" << name << " " << help << "\n";
+			ss << "# TYPE " << metricsPrefix << "_" << name << " " << type << "\n";
+			return metricsPrefix + "_" + name;
+		};
+
+		// Refreshes
+		{
+			auto const name = writeHeader("refreshes_total", "counter", "Number of times interfaces have been queried from the OS.");
+			ss << name << "{type=\"full\"} " << statistics.fullRefreshCount << "\n";
+			ss << name << "{type=\"interface\"} " << statistics.interfaceRefreshCount << "\n";
+		}
+
+		// Events
+		{
+			auto const name = writeHeader("events_total", "counter", "Number of detected changes, by type of event.");
+			auto const& events = statistics.events;
+			ss << name << "{type=\"interface_added\"} " << events.interfaceAdded << "\n";
+			ss << name << "{type=\"interface_removed\"} " << events.interfaceRemoved << "\n";
+			ss << name << "{type=\"enabled_state_changed\"} " << events.enabledStateChanged << "\n";
+			ss << name << "{type=\"connected_state_changed\"} " << events.connectedStateChanged << "\n";
+			ss << name << "{type=\"alias_changed\"} " << events.aliasChanged << "\n";
+			ss << name << "{type=\"ip_address_infos_changed\"} " << events.ipAddressInfosChanged << "\n";
+			ss << name << "{type=\"gateways_changed\"} " << events.gatewaysChanged << "\n";
+		}
+
+		// Isolated observers
+		{
+			auto const isolatedCount = std::count_if(statistics.observers.begin(), statistics.observers.end(),
+				[](auto const& obs)
+				{
+					return obs.isIsolated;
+				});
+			auto const name = writeHeader("isolated_observers", "gauge", "Number of observers which exceeded their callback budget and are notified from their own thread.");
+			ss << name << " " << isolatedCount << "\n";
+		}
+		{
+			auto const name = writeHeader("observer_dropped_notifications_total", "counter", "Number of notifications dropped because an isolated observer did not keep up, by observer.");
+			for (auto const& obs : statistics.observers)
+			{
+				ss << name << "{observer=\"" << static_cast<void const*>(obs.observer) << "\"} " << obs.droppedNotificationsCount << "\n";
+			}
+		}
+
+		// Durations
+		writeHistogram(ss, writeHeader("refresh_duration_seconds", "histogram", "Duration of OS queries."), {}, statistics.refreshDurations);
+		writeHistogram(ss, writeHeader("diff_duration_seconds", "histogram", "Duration of the comparison of refreshed interfaces with the previous ones (excluding observers notification)."), {}, statistics.diffDurations);
+		writeHistogram(ss, writeHeader("lock_wait_duration_seconds", "histogram", "Time spent waiting for the helper lock."), {}, statistics.lockWaitDurations);
+		{
+			auto const name = writeHeader("observer_callback_duration_seconds", "histogram", "Duration of observer callbacks, by observer.");
+			for (auto const& obs : statistics.observers)
+			{
+				auto label = std::ostringstream{};
+				label << "observer=\"" << static_cast<void const*>(obs.observer) << "\"";
+				writeHistogram(ss, name, label.str(), obs.callbackDurations);
+			}
+		}
+
+		return ss.str();
+	}
+	catch (...)
+	{
+		return {};
+	}
+}
+
+} // namespace networkInterface
+} // namespace la
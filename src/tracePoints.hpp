@@ -0,0 +1,96 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+* @file tracePoints.hpp
+* @author Christophe Calmejane
+* @brief Trace points macros, expanding to nothing unless NIH_ENABLE_TRACING is defined.
+*/
+
+#pragma once
+
+#include "la/networkInterfaceHelper/tracing.hpp"
+
+#include <chrono>
+
+namespace la
+{
+namespace networkInterface
+{
+namespace tracing
+{
+/** Sends an event to the current sink (if any) */
+void emit(Category const category, char const* const name, void const* const context, std::chrono::steady_clock::time_point const start, std::chrono::nanoseconds const duration) noexcept;
+
+/** Emits an event covering its lifetime */
+class Scope final
+{
+public:
+	Scope(Category const category, char const* const name, void const* const context) noexcept
+		: _category{ category }
+		, _name{ name }
+		, _context{ context }
+	{
+	}
+
+	~Scope() noexcept
+	{
+		emit(_category, _name, _context, _start, std::chrono::steady_clock::now() - _start);
+	}
+
+	// Deleted compiler auto-generated methods
+	Scope(Scope const&) = delete;
+	Scope(Scope&&) = delete;
+	Scope& operator=(Scope const&) = delete;
+	Scope& operator=(Scope&&) = delete;
+
+private:
+	Category const _category{ Category::Enumeration };
+	char const* const _name{ nullptr };
+	void const* const _context{ nullptr };
+	std::chrono::steady_clock::time_point const _start{ std::chrono::steady_clock::now() };
+};
+
+} // namespace tracing
+} // namespace networkInterface
+} // namespace la
+
+#if defined(NIH_ENABLE_TRACING)
+/** Emits an event from already measured times */
+#	define NIH_TRACE_EVENT(category, name, context, start, duration) la::networkInterface::tracing::emit(la::networkInterface::tracing::Category::category, name, context, start, duration)
+/** Emits an event covering the rest of the enclosing scope */
+#	define NIH_TRACE_SCOPE(category, name, context) auto const nihTraceScope = la::networkInterface::tracing::Scope(la::networkInterface::tracing::Category::category, name, context)
+#else // !NIH_ENABLE_TRACING
+#	define NIH_TRACE_EVENT(category, name, context, start, duration)
+#	define NIH_TRACE_SCOPE(category, name, context)
+#endif // NIH_ENABLE_TRACING
@@ -0,0 +1,264 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+/**
+ * @file tracing.cpp
+ * @author Christophe Calmejane
+ */
+
+#include "tracePoints.hpp"
+
+#include <sstream>
+#include <iomanip> // setfill
+#include <algorithm> // max
+
+namespace la
+{
+namespace networkInterface
+{
+namespace tracing
+{
+struct RingBufferSink::Slot
+{
+	std::atomic<std::uint64_t> sequence{ 0u }; // index * 2 + 1 while being written (by a single writer), (index + 1) * 2 once written
+	std::atomic<char const*> name{ nullptr };
+	std::atomic<std::uint8_t> category{ 0u };
+	std::atomic<std::uint64_t> startTime{ 0u };
+	std::atomic<std::uint64_t> duration{ 0u };
+	std::atomic<std::uint64_t> threadID{ 0u };
+	std::atomic<void const*> context{ nullptr };
+};
+
+/** Returns the smallest power of 2 greater than or equal to the specified value (so slots can be indexed with a mask instead of a modulo) */
+static std::size_t roundUpToPowerOf2(std::size_t const value) noexcept
+{
+	auto result = std::size_t{ 1u };
+	while (result < value)
+	{
+		result <<= 1;
+	}
+	return result;
+}
+
+RingBufferSink::RingBufferSink(std::size_t const capacity)
+	: _capacity{ roundUpToPowerOf2(capacity) }
+	, _slots{ std::make_unique<Slot[]>(_capacity) }
+{
+}
+
+RingBufferSink::~RingBufferSink() noexcept = default;
+
+void RingBufferSink::onEvent(Event const& event) noexcept
+{
+	auto const index = _writeIndex.fetch_add(1u, std::memory_order_relaxed);
+	auto& slot = _slots[index & (_capacity - 1u)];
+
+	// Seqlock write, so readers can detect (and skip) a slot being written. Only claim the slot if no other writer owns it (wrapping around while it is still being written) and it doesn't hold a newer event, otherwise interleaved writes could be read as a valid event of either generation
+	auto sequence = slot.sequence.load(std::memory_order_relaxed);
+	do
+	{
+		if ((sequence & 1u) != 0u || sequence > index * 2u)
+		{
+			// Drop this event
+			return;
+		}
+	} while (!slot.sequence.compare_exchange_weak(sequence, index * 2u + 1u, std::memory_order_acquire, std::memory_order_relaxed));
+	std::atomic_thread_fence(std::memory_order_release);
+	slot.name.store(event.name, std::memory_order_relaxed);
+	slot.category.store(static_cast<std::uint8_t>(event.category), std::memory_order_relaxed);
+	slot.startTime.store(event.startTime, std::memory_order_relaxed);
+	slot.duration.store(event.duration, std::memory_order_relaxed);
+	slot.threadID.store(event.threadID, std::memory_order_relaxed);
+	slot.context.store(event.context, std::memory_order_relaxed);
+	slot.sequence.store(index * 2u + 2u, std::memory_order_release);
+}
+
+std::vector<Event> RingBufferSink::getEvents() const noexcept
+{
+	auto events = std::vector<Event>{};
+	try
+	{
+		auto const endIndex = _writeIndex.load(std::memory_order_acquire);
+		auto const firstIndex = std::max<std::uint64_t>(_firstIndex.load(std::memory_order_relaxed), endIndex > _capacity ? endIndex - _capacity : 0u);
+		events.reserve(static_cast<std::size_t>(endIndex - std::min(firstIndex, endIndex)));
+
+		for (auto index = firstIndex; index < endIndex; ++index)
+		{
+			auto const& slot = _slots[index & (_capacity - 1u)];
+			auto const expectedSequence = index * 2u + 2u;
+			// Must hold the completed event of this exact generation (not just any even sequence)
+			if (slot.sequence.load(std::memory_order_acquire) != expectedSequence)
+			{
+				// Being written, already overwritten, or dropped
+				continue;
+			}
+			auto event = Event{};
+			event.name = slot.name.load(std::memory_order_relaxed);
+			event.category = static_cast<Category>(slot.category.load(std::memory_order_relaxed));
+			event.startTime = slot.startTime.load(std::memory_order_relaxed);
+			event.duration = slot.duration.load(std::memory_order_relaxed);
+			event.threadID = slot.threadID.load(std::memory_order_relaxed);
+			event.context = slot.context.load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (slot.sequence.load(std::memory_order_relaxed) != expectedSequence)
+			{
+				// Overwritten while reading
+				continue;
+			}
+			events.push_back(event);
+		}
+	}
+	catch (...)
+	{
+		// Failed to allocate, return what we got so far
+	}
+	return events;
+}
+
+void RingBufferSink::clear() noexcept
+{
+	_firstIndex.store(_writeIndex.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+std::string RingBufferSink::toChromeTraceJson() const noexcept
+{
+	return eventsToChromeTraceJson(getEvents());
+}
+
+bool isCompiledIn() noexcept
+{
+#if defined(NIH_ENABLE_TRACING)
+	return true;
+#else // !NIH_ENABLE_TRACING
+	return false;
+#endif // NIH_ENABLE_TRACING
+}
+
+RingBufferSink& getDefaultSink() noexcept
+{
+	// Never destroyed, so events can safely be emitted during static destruction
+	static auto* const s_Sink = new RingBufferSink{};
+
+	return *s_Sink;
+}
+
+static std::atomic<Sink*>& getCurrentSink() noexcept
+{
+	static auto s_Sink = std::atomic<Sink*>{ &getDefaultSink() };
+
+	return s_Sink;
+}
+
+void setSink(Sink* const sink) noexcept
+{
+	getCurrentSink().store(sink, std::memory_order_release);
+}
+
+static char const* getCategoryName(Category const category) noexcept
+{
+	switch (category)
+	{
+		case Category::Enumeration:
+			return "enumeration";
+		case Category::Refresh:
+			return "refresh";
+		case Category::Diff:
+			return "diff";
+		case Category::ObserverCallback:
+			return "observer";
+		default:
+			return "unknown";
+	}
+}
+
+/** Writes a duration in nanoseconds as (fractional) microseconds, the unit of the Chrome trace event format */
+static void writeMicroseconds(std::ostringstream& ss, std::uint64_t const nanoseconds)
+{
+	ss << nanoseconds / 1000u << "." << std::setw(3) << std::setfill('0') << nanoseconds % 1000u << std::setfill(' ');
+}
+
+std::string eventsToChromeTraceJson(std::vector<Event> const& events) noexcept
+{
+	try
+	{
+		auto ss = std::ostringstream{};
+		ss << "{\"traceEvents\":[";
+		auto isFirst = true;
+		for (auto const& event : events)
+		{
+			if (!isFirst)
+			{
+				ss << ",";
+			}
+			isFirst = false;
+
+			// Complete event ("X" phase), names are string literals without any character to escape
+			ss << "\n{\"name\":\"" << (event.name != nullptr ? event.name : "") << "\",\"cat\":\"" << getCategoryName(event.category) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.threadID << ",\"ts\":";
+			writeMicroseconds(ss, event.startTime);
+			ss << ",\"dur\":";
+			writeMicroseconds(ss, event.duration);
+			ss << ",\"args\":{\"context\":\"" << event.context << "\"}}";
+		}
+		ss << "\n],\"displayTimeUnit\":\"ns\"}\n";
+		return ss.str();
+	}
+	catch (...)
+	{
+		return {};
+	}
+}
+
+void emit(Category const category, char const* const name, void const* const context, std::chrono::steady_clock::time_point const start, std::chrono::nanoseconds const duration) noexcept
+{
+	auto* const sink = getCurrentSink().load(std::memory_order_acquire);
+	if (sink == nullptr)
+	{
+		return;
+	}
+
+	static auto s_NextThreadID = std::atomic<std::uint64_t>{ 1u };
+	thread_local auto const s_ThreadID = s_NextThreadID.fetch_add(1u, std::memory_order_relaxed);
+
+	auto event = Event{};
+	event.name = name;
+	event.category = category;
+	event.startTime = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count());
+	event.duration = static_cast<std::uint64_t>(std::max(duration.count(), decltype(duration.count()){ 0 }));
+	event.threadID = s_ThreadID;
+	event.context = context;
+	sink->onEvent(event);
+}
+
+} // namespace tracing
+} // namespace networkInterface
+} // namespace la
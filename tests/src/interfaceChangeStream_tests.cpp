@@ -0,0 +1,172 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+// Public API
+#include <la/networkInterfaceHelper/interfaceChangeStream.hpp>
+
+#include <gtest/gtest.h>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#	include <coroutine>
+#	include <exception> // terminate
+#	include <string>
+#	include <optional>
+
+namespace
+{
+/** Minimal eagerly started coroutine */
+struct Task
+{
+	struct promise_type
+	{
+		Task get_return_object() noexcept
+		{
+			return Task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+		}
+		std::suspend_never initial_suspend() noexcept
+		{
+			return {};
+		}
+		std::suspend_always final_suspend() noexcept
+		{
+			return {};
+		}
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept
+		{
+			std::terminate();
+		}
+	};
+
+	explicit Task(std::coroutine_handle<promise_type> const h) noexcept
+		: handle{ h }
+	{
+	}
+	~Task() noexcept
+	{
+		handle.destroy();
+	}
+
+	std::coroutine_handle<promise_type> handle{};
+};
+
+std::optional<la::networkInterface::Interface> getFirstInterface(bool const connectedOnly)
+{
+	auto result = std::optional<la::networkInterface::Interface>{};
+	la::networkInterface::NetworkInterfaceHelper::getInstance().enumerateInterfaces(
+		[&result, connectedOnly](la::networkInterface::Interface const& intfc)
+		{
+			if (!result && (!connectedOnly || intfc.isConnected))
+			{
+				result = intfc;
+			}
+		});
+	return result;
+}
+} // namespace
+
+/* ************************************************************ */
+/* InterfaceChangeStream Tests                                  */
+/* ************************************************************ */
+TEST(InterfaceChangeStream, InitialChanges)
+{
+	if (!getFirstInterface(false))
+	{
+		GTEST_SKIP() << "No network interface found";
+	}
+
+	auto stream = la::networkInterface::InterfaceChangeStream{};
+	auto changes = la::networkInterface::InterfaceChangeStream::Changes{};
+	auto const task = [](la::networkInterface::InterfaceChangeStream& changeStream, la::networkInterface::InterfaceChangeStream::Changes& receivedChanges) -> Task
+	{
+		receivedChanges = co_await changeStream.nextChanges();
+	}(stream, changes);
+
+	EXPECT_TRUE(task.handle.done()) << "Already discovered interfaces should be available without suspending";
+	ASSERT_FALSE(changes.empty());
+	for (auto const& change : changes)
+	{
+		EXPECT_EQ(la::networkInterface::InterfaceChange::Kind::Added, change.kind) << "Initial changes should all be Added";
+	}
+}
+
+TEST(InterfaceChangeStream, InterfaceConnected)
+{
+	auto const intfc = getFirstInterface(true);
+	if (!intfc)
+	{
+		GTEST_SKIP() << "No connected network interface found";
+	}
+
+	auto stream = la::networkInterface::InterfaceChangeStream{};
+	auto result = la::networkInterface::Interface{};
+	auto const task = [](la::networkInterface::InterfaceChangeStream& changeStream, std::string const name, la::networkInterface::Interface& connectedInterface) -> Task
+	{
+		connectedInterface = co_await changeStream.interfaceConnected(name);
+	}(stream, intfc->id, result);
+
+	EXPECT_TRUE(task.handle.done()) << "Already connected interface should not suspend";
+	EXPECT_EQ(intfc->id, result.id);
+	EXPECT_TRUE(result.isConnected);
+}
+
+TEST(InterfaceChangeStream, BoundedPendingChanges)
+{
+	auto interfacesCount = std::size_t{ 0u };
+	la::networkInterface::NetworkInterfaceHelper::getInstance().enumerateInterfaces(
+		[&interfacesCount](la::networkInterface::Interface const& /*intfc*/)
+		{
+			++interfacesCount;
+		});
+	if (interfacesCount < 2u)
+	{
+		GTEST_SKIP() << "Not enough network interfaces found";
+	}
+
+	// Only keep the last change (Added changes are recorded on creation, while nobody consumes them)
+	auto stream = la::networkInterface::InterfaceChangeStream{ la::networkInterface::NetworkInterfaceHelper::getInstance(), {}, 1u };
+	EXPECT_EQ(interfacesCount - 1u, stream.getDroppedChangesCount());
+
+	auto changes = la::networkInterface::InterfaceChangeStream::Changes{};
+	auto const task = [](la::networkInterface::InterfaceChangeStream& changeStream, la::networkInterface::InterfaceChangeStream::Changes& receivedChanges) -> Task
+	{
+		receivedChanges = co_await changeStream.nextChanges();
+	}(stream, changes);
+
+	EXPECT_TRUE(task.handle.done());
+	ASSERT_EQ(1u, changes.size()) << "Pending changes should be bounded";
+	EXPECT_EQ(interfacesCount - 1u, changes.front().droppedChangesCount) << "The change following the dropped ones should report them";
+}
+
+#endif // __cpp_impl_coroutine
@@ -0,0 +1,191 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+// Public API
+#include <la/networkInterfaceHelper/ipAddressArray.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept> // invalid_argument
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <string>
+
+// Sizes are not multiple of the vector widths, so the scalar tails are also tested
+static constexpr auto s_V4Count = std::size_t{ 1003u };
+static constexpr auto s_V6Count = std::size_t{ 517u };
+
+static la::networkInterface::IPAddressArray makeArray(std::vector<la::networkInterface::IPAddress>& addresses)
+{
+	auto generator = std::mt19937_64{ 42u };
+	// Addresses are generated in 4 /16 (V4) and 4 /48 (V6) networks, so subnets have matches
+	for (auto i = 0u; i < s_V4Count; ++i)
+	{
+		auto const network = static_cast<std::uint32_t>(0xC0A80000u + ((generator() % 4u) << 16));
+		addresses.emplace_back(static_cast<la::networkInterface::IPAddress::value_type_packed_v4>(network | (generator() & 0xFFFFu)));
+	}
+	for (auto i = 0u; i < s_V6Count; ++i)
+	{
+		auto const network = std::uint64_t{ 0x20010db800000000u } + ((generator() % 4u) << 16);
+		addresses.emplace_back(la::networkInterface::IPAddress::value_type_packed_v6{ network | (generator() & 0xFFFFu), generator() });
+	}
+	return la::networkInterface::IPAddressArray{ addresses };
+}
+
+static bool isInSubnet(la::networkInterface::IPAddress const& ip, la::networkInterface::IPAddressInfo const& subnet)
+{
+	return ip.getType() == subnet.address.getType() && (ip & subnet.netmask) == (subnet.address & subnet.netmask);
+}
+
+TEST(IPAddressArray, Storage)
+{
+	auto addresses = std::vector<la::networkInterface::IPAddress>{};
+	auto const array = makeArray(addresses);
+
+	ASSERT_EQ(s_V4Count + s_V6Count, array.size());
+	ASSERT_EQ(s_V4Count, array.getCount(la::networkInterface::IPAddress::Type::V4));
+	ASSERT_EQ(s_V6Count, array.getCount(la::networkInterface::IPAddress::Type::V6));
+	EXPECT_EQ(addresses[10], array.getV4(10));
+	EXPECT_EQ(addresses[s_V4Count + 10], array.getV6(10));
+	EXPECT_EQ(addresses[s_V4Count].getIPV6Packed().first, array.getV6HighData()[0]);
+	EXPECT_EQ(addresses[s_V4Count].getIPV6Packed().second, array.getV6LowData()[0]);
+	EXPECT_THROW(array.getV4(s_V4Count), std::invalid_argument);
+	EXPECT_THROW(la::networkInterface::IPAddressArray{}.add(la::networkInterface::IPAddress{}), std::invalid_argument);
+}
+
+TEST(IPAddressArray, MaskAll)
+{
+	auto addresses = std::vector<la::networkInterface::IPAddress>{};
+	auto array = makeArray(addresses);
+	auto const maskV4 = la::networkInterface::IPAddress{ "255.255.255.0" };
+	auto const maskV6 = la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff:ffff:ffff:ffff:0" };
+
+	array.maskAll(maskV4);
+	array.maskAll(maskV6);
+
+	for (auto i = 0u; i < s_V4Count; ++i)
+	{
+		ASSERT_EQ(addresses[i] & maskV4, array.getV4(i)) << "Index " << i;
+	}
+	for (auto i = 0u; i < s_V6Count; ++i)
+	{
+		ASSERT_EQ(addresses[s_V4Count + i] & maskV6, array.getV6(i)) << "Index " << i;
+	}
+	EXPECT_THROW(array.maskAll(la::networkInterface::IPAddress{}), std::invalid_argument);
+}
+
+TEST(IPAddressArray, EqualsAny)
+{
+	auto addresses = std::vector<la::networkInterface::IPAddress>{};
+	auto const array = makeArray(addresses);
+
+	// First, last (in the scalar tail) and in the middle of the vectorized part
+	EXPECT_TRUE(array.equalsAny(addresses[0]));
+	EXPECT_TRUE(array.equalsAny(addresses[s_V4Count - 1]));
+	EXPECT_TRUE(array.equalsAny(addresses[500]));
+	EXPECT_TRUE(array.equalsAny(addresses[s_V4Count]));
+	EXPECT_TRUE(array.equalsAny(addresses.back()));
+	EXPECT_TRUE(array.equalsAny(addresses[s_V4Count + 300]));
+
+	EXPECT_FALSE(array.equalsAny(la::networkInterface::IPAddress{ "10.0.0.1" }));
+	EXPECT_FALSE(array.equalsAny(la::networkInterface::IPAddress{ "2001:db8::1" }));
+	EXPECT_FALSE(array.equalsAny(la::networkInterface::IPAddress{}));
+
+	// Only one of the V6 halves matching
+	auto const v6 = addresses[s_V4Count + 100].getIPV6Packed();
+	EXPECT_FALSE(array.equalsAny(la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_packed_v6{ v6.first, ~v6.second } }));
+}
+
+TEST(IPAddressArray, InSubnet)
+{
+	auto addresses = std::vector<la::networkInterface::IPAddress>{};
+	auto const array = makeArray(addresses);
+	auto const subnets = std::vector<la::networkInterface::IPAddressInfo>{
+		{ la::networkInterface::IPAddress{ "192.169.12.0" }, la::networkInterface::IPAddress{ "255.255.0.0" } },
+		{ la::networkInterface::IPAddress{ "192.170.12.0" }, la::networkInterface::IPAddress{ "255.255.128.0" } },
+		{ la::networkInterface::IPAddress{ "2001:db8:1::" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff::" } },
+		{ la::networkInterface::IPAddress{ "2001:db8:2:8000::" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff:8000::" } },
+	};
+
+	for (auto const& subnet : subnets)
+	{
+		auto const isV4 = subnet.address.getType() == la::networkInterface::IPAddress::Type::V4;
+		auto const offset = isV4 ? std::size_t{ 0u } : s_V4Count;
+		auto const count = array.getCount(subnet.address.getType());
+		auto results = std::vector<std::uint8_t>(count, 0xFF);
+
+		auto expectedFound = std::size_t{ 0u };
+		auto const found = array.inSubnet(subnet, results.data());
+		for (auto i = 0u; i < count; ++i)
+		{
+			auto const expected = isInSubnet(addresses[offset + i], subnet);
+			ASSERT_EQ(static_cast<std::uint8_t>(expected), results[i]) << "Index " << i << " of subnet " << static_cast<std::string>(subnet.address);
+			expectedFound += expected;
+		}
+		EXPECT_EQ(expectedFound, found);
+		EXPECT_NE(0u, found) << "Test data should match each subnet";
+	}
+
+	auto results = std::vector<std::uint8_t>(s_V4Count);
+	EXPECT_THROW(array.inSubnet(la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "192.168.0.0" }, la::networkInterface::IPAddress{ "255.0.255.0" } }, results.data()), std::invalid_argument);
+	EXPECT_THROW(array.inSubnet(la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "192.168.0.0" }, la::networkInterface::IPAddress{ "ffff::" } }, results.data()), std::invalid_argument);
+}
+
+TEST(IPAddressArray, CountInSubnets)
+{
+	auto addresses = std::vector<la::networkInterface::IPAddress>{};
+	auto const array = makeArray(addresses);
+	auto const subnets = std::vector<la::networkInterface::IPAddressInfo>{
+		{ la::networkInterface::IPAddress{ "192.168.0.0" }, la::networkInterface::IPAddress{ "255.255.0.0" } },
+		{ la::networkInterface::IPAddress{ "192.168.0.0" }, la::networkInterface::IPAddress{ "255.255.128.0" } }, // Overlapping the previous one
+		{ la::networkInterface::IPAddress{ "192.170.128.0" }, la::networkInterface::IPAddress{ "255.255.128.0" } },
+		{ la::networkInterface::IPAddress{ "2001:db8:3::" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff::" } },
+	};
+
+	auto expected = std::size_t{ 0u };
+	for (auto const& ip : addresses)
+	{
+		for (auto const& subnet : subnets)
+		{
+			if (isInSubnet(ip, subnet))
+			{
+				++expected;
+				break;
+			}
+		}
+	}
+
+	EXPECT_EQ(expected, array.countInSubnets(subnets)) << "Kernels: " << la::networkInterface::IPAddressArray::getKernelsInstructionSet();
+	EXPECT_EQ(0u, array.countInSubnets({}));
+}
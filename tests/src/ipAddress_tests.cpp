@@ -41,6 +41,20 @@
 
 #include <stdexcept> // invalid_argument
 #include <string>
+#include <string_view>
+#include <array>
+#include <random>
+#include <system_error> // errc
+#include <cstring> // memcpy, memcmp
+
+#if defined(_WIN32)
+#	include <WinSock2.h>
+#	include <ws2tcpip.h>
+#else // !_WIN32
+#	include <sys/socket.h>
+#	include <netinet/in.h>
+#	include <arpa/inet.h>
+#endif // _WIN32
 
 /* ************************************************************ */
 /* IPAddress Tests                                              */
@@ -247,6 +261,18 @@ TEST(IPAddress, StringConstructV4)
 		auto ip = la::networkInterface::IPAddress{};
 		EXPECT_THROW(ip = la::networkInterface::IPAddress{ "192.168.0.1.1" }, std::invalid_argument) << "Constructing from an invalid string should throw";
 	}
+
+	// Invalid IPV4 string (leading zeros)
+	{
+		auto ip = la::networkInterface::IPAddress{};
+		EXPECT_THROW(ip = la::networkInterface::IPAddress{ "192.168.00.1" }, std::invalid_argument) << "Constructing from an invalid string should throw";
+	}
+
+	// Invalid IPV4 string (trailing characters)
+	{
+		auto ip = la::networkInterface::IPAddress{};
+		EXPECT_THROW(ip = la::networkInterface::IPAddress{ "192.168.0.1/24" }, std::invalid_argument) << "Constructing from an invalid string should throw";
+	}
 }
 
 TEST(IPAddress, StringConstructV6)
@@ -458,6 +484,12 @@ TEST(IPAddress, StringConstructV6)
 		auto ip = la::networkInterface::IPAddress{};
 		EXPECT_THROW(ip = la::networkInterface::IPAddress{ "1:2:3:4:5:6:7:8:9" }, std::invalid_argument) << "Constructing from an invalid string should throw";
 	}
+
+	// Invalid IPV6 string (compression after all 8 groups)
+	{
+		auto ip = la::networkInterface::IPAddress{};
+		EXPECT_THROW(ip = la::networkInterface::IPAddress{ "1:2:3:4:5:6:7:8::" }, std::invalid_argument) << "Constructing from an invalid string should throw";
+	}
 }
 
 TEST(IPAddress, ToStringV4)
@@ -580,6 +612,24 @@ TEST(IPAddress, MakePackedMaskV4)
 	EXPECT_EQ(la::networkInterface::IPAddress::value_type_packed_v4{ 0x00000000 }, la::networkInterface::makePackedMaskV4(0));
 }
 
+TEST(IPAddress, MakePackedMaskV6)
+{
+	using Packed = la::networkInterface::IPAddress::value_type_packed_v6;
+	EXPECT_EQ((Packed{ 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF }), la::networkInterface::makePackedMaskV6(200));
+	EXPECT_EQ((Packed{ 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF }), la::networkInterface::makePackedMaskV6(128));
+	EXPECT_EQ((Packed{ 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFE }), la::networkInterface::makePackedMaskV6(127));
+	EXPECT_EQ((Packed{ 0xFFFFFFFFFFFFFFFF, 0x8000000000000000 }), la::networkInterface::makePackedMaskV6(65));
+	EXPECT_EQ((Packed{ 0xFFFFFFFFFFFFFFFF, 0x0000000000000000 }), la::networkInterface::makePackedMaskV6(64));
+	EXPECT_EQ((Packed{ 0xFFFFFFFFFFFF0000, 0x0000000000000000 }), la::networkInterface::makePackedMaskV6(48));
+	EXPECT_EQ((Packed{ 0x8000000000000000, 0x0000000000000000 }), la::networkInterface::makePackedMaskV6(1));
+	EXPECT_EQ((Packed{ 0x0000000000000000, 0x0000000000000000 }), la::networkInterface::makePackedMaskV6(0));
+
+	for (auto length = 0u; length <= 128u; ++length)
+	{
+		EXPECT_EQ(la::networkInterface::IPAddress::packedV6FromPrefixLength(static_cast<std::uint8_t>(length)), la::networkInterface::makePackedMaskV6(static_cast<std::uint8_t>(length))) << "Prefix length " << length;
+	}
+}
+
 TEST(IPAddress, ValidateNetmaskV4)
 {
 	EXPECT_NO_THROW(la::networkInterface::validateNetmaskV4(la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_packed_v4{ 0x80000000 } }));
@@ -747,6 +797,71 @@ TEST(IPAddress, SubstrationOperatorV6)
 	EXPECT_TRUE((la::networkInterface::IPAddress{ "::1" } - 2) == la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" }) << "Subtraction with lower and upper part borrow failed";
 }
 
+TEST(IPAddress, UInt128Arithmetic)
+{
+	static_assert(la::networkInterface::UInt128{ 0u, ~std::uint64_t{ 0u } } + 1u == la::networkInterface::UInt128{ 1u, 0u }, "constexpr carry");
+	static_assert(la::networkInterface::UInt128{ 1u, 0u } - 1u == la::networkInterface::UInt128{ 0u, ~std::uint64_t{ 0u } }, "constexpr borrow");
+	static_assert(la::networkInterface::UInt128::max() + 1u == la::networkInterface::UInt128{}, "constexpr wrapping");
+	static_assert(la::networkInterface::UInt128{} - 1u == la::networkInterface::UInt128::max(), "constexpr wrapping");
+	static_assert(la::networkInterface::UInt128{ 1u, 0u } > la::networkInterface::UInt128{ 0u, ~std::uint64_t{ 0u } }, "constexpr comparison");
+
+	// Size of a /64
+	constexpr auto size = la::networkInterface::IPAddress::distance(la::networkInterface::IPAddress::value_type_packed_v6{ 0x20010db800000000, 0 }, la::networkInterface::IPAddress::value_type_packed_v6{ 0x20010db800000000, ~std::uint64_t{ 0u } }) + 1u;
+	static_assert(size == la::networkInterface::UInt128{ 1u, 0u }, "constexpr distance");
+}
+
+TEST(IPAddress, LargeOffsetOperatorsV6)
+{
+	auto const offset = la::networkInterface::UInt128{ 0x1u, 0x8000000000000000 };
+	EXPECT_EQ(la::networkInterface::IPAddress{ "2001:db8:0:1:8000::1" }, la::networkInterface::IPAddress{ "2001:db8::1" } + offset);
+	EXPECT_EQ(la::networkInterface::IPAddress{ "2001:db8::1" }, la::networkInterface::IPAddress{ "2001:db8:0:1:8000::1" } - offset);
+	EXPECT_EQ(la::networkInterface::IPAddress{ "2001:db8:0:1::" }, (la::networkInterface::IPAddress{ "2001:db8::" } + la::networkInterface::UInt128{ 1u, 0u })) << "Stepping by a /64 failed";
+	EXPECT_EQ(la::networkInterface::IPAddress{ "::" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" } + la::networkInterface::UInt128{ 1u }) << "Addition should wrap";
+	EXPECT_EQ(la::networkInterface::IPAddress{ "192.168.1.0" }, la::networkInterface::IPAddress{ "192.168.0.255" } + la::networkInterface::UInt128{ 1u });
+	EXPECT_EQ(la::networkInterface::IPAddress{ "0.0.0.1" }, la::networkInterface::IPAddress{ "0.0.0.0" } + la::networkInterface::UInt128{ 0x100000001u }) << "V4 addition should wrap modulo 2^32";
+	EXPECT_THROW(la::networkInterface::IPAddress{} + la::networkInterface::UInt128{ 1u }, std::invalid_argument);
+}
+
+TEST(IPAddress, Uint64OffsetOperators)
+{
+	// 64-bit offsets must not be truncated to 32bits
+	EXPECT_EQ(la::networkInterface::IPAddress{ "::100:0:0" }, la::networkInterface::IPAddress{ "::" } + (std::uint64_t{ 1u } << 40));
+	EXPECT_EQ(la::networkInterface::IPAddress{ "::" }, la::networkInterface::IPAddress{ "::100:0:0" } - (std::uint64_t{ 1u } << 40));
+	EXPECT_EQ(la::networkInterface::IPAddress{ "2001:db8::ffff:ffff:ffff:ffff" }, la::networkInterface::IPAddress{ "2001:db8::" } + ~std::uint64_t{ 0u });
+	EXPECT_EQ(la::networkInterface::IPAddress{ "0.0.0.1" }, la::networkInterface::IPAddress{ "0.0.0.0" } + std::uint64_t{ 0x100000001u }) << "V4 addition should wrap modulo 2^32";
+	EXPECT_EQ(la::networkInterface::IPAddress{ "10.0.0.2" }, la::networkInterface::IPAddress{ "10.0.0.1" } + 1u) << "32-bit offsets should still be accepted";
+	EXPECT_EQ(la::networkInterface::IPAddress{ "10.0.0.0" }, la::networkInterface::IPAddress{ "10.0.0.1" } - 1) << "int offsets should still be accepted";
+	EXPECT_THROW(la::networkInterface::IPAddress{} + std::uint64_t{ 1u }, std::invalid_argument);
+}
+
+TEST(IPAddress, SaturatedOperators)
+{
+	auto const maxV6 = la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" };
+	EXPECT_EQ(maxV6, la::networkInterface::IPAddress::addSaturated(la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff:ffff:ffff:ffff:fff0" }, 0x100u));
+	EXPECT_EQ(maxV6, la::networkInterface::IPAddress::addSaturated(la::networkInterface::IPAddress{ "::1" }, la::networkInterface::UInt128::max()));
+	EXPECT_EQ(la::networkInterface::IPAddress{ "::1:0:0:0:1" }, la::networkInterface::IPAddress::addSaturated(la::networkInterface::IPAddress{ "::1" }, la::networkInterface::UInt128{ 1u, 0u }));
+	EXPECT_EQ(la::networkInterface::IPAddress{ "::" }, la::networkInterface::IPAddress::subtractSaturated(la::networkInterface::IPAddress{ "::1:0:0:0:1" }, la::networkInterface::UInt128{ 2u, 0u }));
+	EXPECT_EQ(la::networkInterface::IPAddress{ "::1" }, la::networkInterface::IPAddress::subtractSaturated(la::networkInterface::IPAddress{ "::1:0:0:0:1" }, la::networkInterface::UInt128{ 1u, 0u }));
+
+	EXPECT_EQ(la::networkInterface::IPAddress{ "255.255.255.255" }, la::networkInterface::IPAddress::addSaturated(la::networkInterface::IPAddress{ "255.255.255.0" }, 0x100u));
+	EXPECT_EQ(la::networkInterface::IPAddress{ "255.255.255.255" }, la::networkInterface::IPAddress::addSaturated(la::networkInterface::IPAddress{ "10.0.0.1" }, la::networkInterface::UInt128{ 1u, 0u }));
+	EXPECT_EQ(la::networkInterface::IPAddress{ "255.255.255.255" }, la::networkInterface::IPAddress::addSaturated(la::networkInterface::IPAddress{ "255.255.255.254" }, 1u));
+	EXPECT_EQ(la::networkInterface::IPAddress{ "0.0.0.0" }, la::networkInterface::IPAddress::subtractSaturated(la::networkInterface::IPAddress{ "0.0.0.255" }, 0x100u));
+	EXPECT_EQ(la::networkInterface::IPAddress{ "0.0.0.1" }, la::networkInterface::IPAddress::subtractSaturated(la::networkInterface::IPAddress{ "0.0.1.0" }, 0xffu));
+	EXPECT_THROW(la::networkInterface::IPAddress::addSaturated(la::networkInterface::IPAddress{}, 1u), std::invalid_argument);
+}
+
+TEST(IPAddress, Distance)
+{
+	EXPECT_EQ(la::networkInterface::UInt128{ 255u }, la::networkInterface::IPAddress::distance(la::networkInterface::IPAddress{ "192.168.0.1" }, la::networkInterface::IPAddress{ "192.168.1.0" }));
+	EXPECT_EQ(la::networkInterface::UInt128{ 255u }, la::networkInterface::IPAddress::distance(la::networkInterface::IPAddress{ "192.168.1.0" }, la::networkInterface::IPAddress{ "192.168.0.1" })) << "Distance should be symmetric";
+	EXPECT_EQ(la::networkInterface::UInt128{ 0xffffffffu }, la::networkInterface::IPAddress::distance(la::networkInterface::IPAddress{ "0.0.0.0" }, la::networkInterface::IPAddress{ "255.255.255.255" }));
+	EXPECT_EQ(la::networkInterface::UInt128::max(), la::networkInterface::IPAddress::distance(la::networkInterface::IPAddress{ "::" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" }));
+	EXPECT_EQ((la::networkInterface::UInt128{ 1u, 1u }), la::networkInterface::IPAddress::distance(la::networkInterface::IPAddress{ "2001:db8::ffff:ffff:ffff:ffff" }, la::networkInterface::IPAddress{ "2001:db8:0:2::" }));
+	EXPECT_THROW(la::networkInterface::IPAddress::distance(la::networkInterface::IPAddress{ "192.168.0.1" }, la::networkInterface::IPAddress{ "::1" }), std::invalid_argument);
+	EXPECT_THROW(la::networkInterface::IPAddress::distance(la::networkInterface::IPAddress{}, la::networkInterface::IPAddress{}), std::invalid_argument);
+}
+
 TEST(IPAddress, IncrementOperatorV4)
 {
 	auto ip1 = la::networkInterface::IPAddress{ "192.168.0.1" };
@@ -1096,3 +1211,229 @@ TEST(IPAddressInfo, IsPrivateNetworkAddress)
 
 	// TODO: Complete with invalid values
 }
+
+/* ************************************************************ */
+/* Chars conversion Tests                                       */
+/* ************************************************************ */
+static std::string_view ipAddressToChars(std::array<char, la::networkInterface::IPAddressCharsMaxLength>& buffer, la::networkInterface::IPAddress const& ip)
+{
+	auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::ipAddressToChars(buffer.data(), buffer.data() + buffer.size(), ip);
+	EXPECT_EQ(std::errc{}, ec);
+	return std::string_view(buffer.data(), static_cast<std::size_t>(ptr - buffer.data()));
+}
+
+TEST(IPAddress, ToChars)
+{
+	auto buffer = std::array<char, la::networkInterface::IPAddressCharsMaxLength>{};
+	for (auto const* const str : { "0.0.0.0", "192.168.1.10", "255.255.255.255", "::", "::1", "fe80::1ff:fe23:4567:890a", "2001:db8:0:1:1:1:1:1", "2001:db8::1:0:0:1", "::ffff:192.168.0.1", "1234:5678:9abc:def0:1234:5678:9abc:def0" })
+	{
+		auto const ip = la::networkInterface::IPAddress{ str };
+		EXPECT_EQ(std::string_view{ str }, ipAddressToChars(buffer, ip));
+		EXPECT_EQ(static_cast<std::string>(ip), ipAddressToChars(buffer, ip)) << "Should match the string conversion";
+	}
+
+	// Buffer too small
+	auto const ip = la::networkInterface::IPAddress{ "192.168.1.10" };
+	auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::ipAddressToChars(buffer.data(), buffer.data() + 11, ip);
+	EXPECT_EQ(std::errc::value_too_large, ec);
+	EXPECT_EQ(buffer.data() + 11, ptr);
+
+	// Invalid IPAddress
+	EXPECT_EQ(std::errc::invalid_argument, la::networkInterface::NetworkInterfaceHelper::ipAddressToChars(buffer.data(), buffer.data() + buffer.size(), la::networkInterface::IPAddress{}).ec);
+}
+
+TEST(IPAddress, FromChars)
+{
+	// Valid addresses, possibly followed by other characters
+	struct Valid
+	{
+		std::string_view str{};
+		std::string_view expected{};
+		std::size_t parsedLength{ 0u };
+	};
+	for (auto const& valid : { Valid{ "192.168.1.10", "192.168.1.10", 12u }, Valid{ "10.0.0.1:80", "10.0.0.1", 8u }, Valid{ "::", "::", 2u }, Valid{ "::1", "::1", 3u }, Valid{ "fe80::1/64", "fe80::1", 7u }, Valid{ "FE80:0:0:0:1FF:FE23:4567:890A", "fe80::1ff:fe23:4567:890a", 29u }, Valid{ "1::", "1::", 3u }, Valid{ "1:2:3:4:5:6:7::", "1:2:3:4:5:6:7:0", 15u }, Valid{ "::ffff:192.168.0.1", "::ffff:192.168.0.1", 18u }, Valid{ "64:ff9b::10.0.0.1", "64:ff9b::a00:1", 17u }, Valid{ "0.0.0.0", "0.0.0.0", 7u }, Valid{ "10.0.100.0", "10.0.100.0", 10u } })
+	{
+		auto ip = la::networkInterface::IPAddress{};
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::ipAddressFromChars(valid.str.data(), valid.str.data() + valid.str.size(), ip);
+		EXPECT_EQ(std::errc{}, ec) << valid.str;
+		EXPECT_EQ(la::networkInterface::IPAddress{ std::string{ valid.expected } }, ip) << valid.str;
+		EXPECT_EQ(valid.str.data() + valid.parsedLength, ptr) << valid.str;
+	}
+
+	// Invalid addresses
+	for (auto const str : { "", "1.2.3", "1.2.3.256", "1.2.3.1234", "1..2.3", ":1::", "1:2:3:4:5:6:7", "1:2:3:4:5:6:7:8:9", "1::2::3", "12345::", "::1.2.3", "1:2:3:4:5:6:7:1.2.3.4", "::1:2:3:4:5:6:7:8", "g::", "1:2:3:4:5:6:7:8::", "01.2.3.4", "1.2.3.04", "1.2.3.00", "::ffff:192.168.01.1" })
+	{
+		auto const sv = std::string_view{ str };
+		auto ip = la::networkInterface::IPAddress{ "10.0.0.1" };
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::ipAddressFromChars(sv.data(), sv.data() + sv.size(), ip);
+		EXPECT_EQ(std::errc::invalid_argument, ec) << str;
+		EXPECT_EQ(sv.data(), ptr) << str;
+		EXPECT_EQ(la::networkInterface::IPAddress{ "10.0.0.1" }, ip) << "Should be untouched on error: " << str;
+	}
+}
+
+TEST(IPAddressInfo, ToChars)
+{
+	auto buffer = std::array<char, la::networkInterface::IPAddressInfoCharsMaxLength>{};
+	auto const toChars = [&buffer](la::networkInterface::IPAddressInfo const& info)
+	{
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::ipAddressInfoToChars(buffer.data(), buffer.data() + buffer.size(), info);
+		EXPECT_EQ(std::errc{}, ec);
+		return std::string_view(buffer.data(), static_cast<std::size_t>(ptr - buffer.data()));
+	};
+
+	EXPECT_EQ("192.168.1.10/24", toChars(la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "192.168.1.10" }, la::networkInterface::IPAddress{ "255.255.255.0" } }));
+	EXPECT_EQ("10.0.0.1/32", toChars(la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "10.0.0.1" }, la::networkInterface::IPAddress{ "255.255.255.255" } }));
+	EXPECT_EQ("fe80::1/64", toChars(la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "fe80::1" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff::" } }));
+	EXPECT_EQ("::/0", toChars(la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "::" }, la::networkInterface::IPAddress{ "::" } }));
+	EXPECT_EQ("1234:5678:9abc:def0:1234:5678:9abc:def0/128", toChars(la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "1234:5678:9abc:def0:1234:5678:9abc:def0" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" } }));
+
+	// Invalid IPAddressInfo
+	auto const invalidInfos = { la::networkInterface::IPAddressInfo{}, la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "10.0.0.1" }, la::networkInterface::IPAddress{ "255.0.255.0" } }, la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "10.0.0.1" }, la::networkInterface::IPAddress{ "0.0.0.0" } }, la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "10.0.0.1" }, la::networkInterface::IPAddress{ "ffff::" } }, la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "fe80::1" }, la::networkInterface::IPAddress{ "ffff::1" } } };
+	for (auto const& info : invalidInfos)
+	{
+		EXPECT_EQ(std::errc::invalid_argument, la::networkInterface::NetworkInterfaceHelper::ipAddressInfoToChars(buffer.data(), buffer.data() + buffer.size(), info).ec);
+	}
+
+	// Buffer too small for the prefix length
+	auto const info = la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "192.168.1.10" }, la::networkInterface::IPAddress{ "255.255.255.0" } };
+	EXPECT_EQ(std::errc::value_too_large, la::networkInterface::NetworkInterfaceHelper::ipAddressInfoToChars(buffer.data(), buffer.data() + 14, info).ec);
+}
+
+TEST(IPAddressInfo, FromChars)
+{
+	auto const fromChars = [](std::string_view const str, la::networkInterface::IPAddressInfo& info)
+	{
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::ipAddressInfoFromChars(str.data(), str.data() + str.size(), info);
+		return ec == std::errc{} ? static_cast<std::size_t>(ptr - str.data()) : std::size_t{ 0u };
+	};
+
+	auto info = la::networkInterface::IPAddressInfo{};
+	EXPECT_EQ(15u, fromChars("192.168.1.10/24", info));
+	EXPECT_EQ((la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "192.168.1.10" }, la::networkInterface::IPAddress{ "255.255.255.0" } }), info);
+
+	EXPECT_EQ(10u, fromChars("fe80::1/64 # comment", info));
+	EXPECT_EQ((la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "fe80::1" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff::" } }), info);
+
+	EXPECT_EQ(0u, fromChars("2001:db8::/", info)) << "A separator without prefix length is not valid";
+	EXPECT_EQ(8u, fromChars("10.0.0.1", info)) << "Missing prefix length is a single host";
+	EXPECT_EQ((la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "10.0.0.1" }, la::networkInterface::IPAddress{ "255.255.255.255" } }), info);
+	EXPECT_EQ(4u, fromChars("::/0", info));
+	EXPECT_EQ((la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "::" }, la::networkInterface::IPAddress{ "::" } }), info);
+
+	// Invalid strings, leaving 'info' untouched
+	for (auto const str : { "", "/24", "10.0.0.1/0", "10.0.0.1/33", "10.0.0.1/0024", "10.0.0.1/024", "10.0.0.1/00", "10.0.0.1/-1", "fe80::1/064", "::/00", "fe80::1/129", "fe80::1/1280", "fe80::1/" })
+	{
+		EXPECT_EQ(0u, fromChars(str, info)) << str;
+	}
+	EXPECT_EQ((la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "::" }, la::networkInterface::IPAddress{ "::" } }), info);
+}
+
+TEST(IPAddressInfo, CharsRoundTrip)
+{
+	auto generator = std::mt19937_64{ 42u };
+	auto buffer = std::array<char, la::networkInterface::IPAddressInfoCharsMaxLength>{};
+	for (auto i = 0u; i < 1000u; ++i)
+	{
+		auto const length = static_cast<std::uint8_t>(generator() % 129u);
+		auto const info = la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_packed_v6{ generator() & 0xFFFF0000FFFFFFFF, generator() & 0x0000FFFFFFFF0000 } }, la::networkInterface::IPAddress{ la::networkInterface::makePackedMaskV6(length) } };
+		auto const [end, toEc] = la::networkInterface::NetworkInterfaceHelper::ipAddressInfoToChars(buffer.data(), buffer.data() + buffer.size(), info);
+		ASSERT_EQ(std::errc{}, toEc);
+
+		auto parsed = la::networkInterface::IPAddressInfo{};
+		auto const [ptr, fromEc] = la::networkInterface::NetworkInterfaceHelper::ipAddressInfoFromChars(buffer.data(), end, parsed);
+		ASSERT_EQ(std::errc{}, fromEc) << std::string_view(buffer.data(), static_cast<std::size_t>(end - buffer.data()));
+		EXPECT_EQ(end, ptr);
+		EXPECT_EQ(info, parsed) << std::string_view(buffer.data(), static_cast<std::size_t>(end - buffer.data()));
+	}
+}
+
+TEST(IPAddress, InAddr)
+{
+	auto addr = in_addr{};
+	ASSERT_EQ(1, inet_pton(AF_INET, "192.168.1.10", &addr));
+
+	auto const ip = la::networkInterface::IPAddress{ addr };
+	EXPECT_EQ(la::networkInterface::IPAddress{ "192.168.1.10" }, ip);
+	EXPECT_EQ(0xC0A8010Au, ip.getIPV4Packed()) << "Should convert from network byte order";
+
+	auto const out = ip.getInAddr();
+	EXPECT_EQ(0, std::memcmp(&addr, &out, sizeof(addr))) << "Should convert to network byte order";
+
+	EXPECT_THROW(la::networkInterface::IPAddress{ "::1" }.getInAddr(), std::invalid_argument);
+}
+
+TEST(IPAddress, In6Addr)
+{
+	auto addr = in6_addr{};
+	ASSERT_EQ(1, inet_pton(AF_INET6, "2001:db8::1:0:0:1", &addr));
+
+	auto const ip = la::networkInterface::IPAddress{ addr };
+	EXPECT_EQ(la::networkInterface::IPAddress{ "2001:db8::1:0:0:1" }, ip);
+
+	auto const out = ip.getIn6Addr();
+	EXPECT_EQ(0, std::memcmp(&addr, &out, sizeof(addr)));
+
+	EXPECT_THROW(la::networkInterface::IPAddress{ "192.168.1.10" }.getIn6Addr(), std::invalid_argument);
+}
+
+TEST(IPAddress, In6AddrMappedV4)
+{
+	auto addr = in6_addr{};
+	ASSERT_EQ(1, inet_pton(AF_INET6, "::ffff:192.168.1.10", &addr));
+
+	EXPECT_EQ(la::networkInterface::IPAddress{ "::ffff:192.168.1.10" }, la::networkInterface::IPAddress{ addr }) << "Should not be normalized by default";
+	EXPECT_EQ(la::networkInterface::IPAddress{ "192.168.1.10" }, (la::networkInterface::IPAddress{ addr, true })) << "Should be normalized to IPV4";
+
+	// Not a mapped address
+	ASSERT_EQ(1, inet_pton(AF_INET6, "::192.168.1.10", &addr));
+	EXPECT_EQ(la::networkInterface::IPAddress::Type::V6, (la::networkInterface::IPAddress{ addr, true }).getType());
+}
+
+TEST(IPAddress, SockaddrIn)
+{
+	auto const ip = la::networkInterface::IPAddress{ "10.0.0.1" };
+	auto const address = ip.getSockaddrIn(17221u);
+	EXPECT_EQ(AF_INET, address.sin_family);
+	EXPECT_EQ(17221u, ntohs(address.sin_port)) << "Port should be in network byte order";
+	EXPECT_EQ(0x0A000001u, ntohl(address.sin_addr.s_addr));
+	EXPECT_EQ(ip, la::networkInterface::IPAddress{ address });
+
+	// Through the generic sockaddr
+	EXPECT_EQ(ip, la::networkInterface::IPAddress{ reinterpret_cast<sockaddr const&>(address) });
+}
+
+TEST(IPAddress, SockaddrIn6)
+{
+	auto const ip = la::networkInterface::IPAddress{ "fe80::1ff:fe23:4567:890a" };
+	auto const address = ip.getSockaddrIn6(17221u);
+	EXPECT_EQ(AF_INET6, address.sin6_family);
+	EXPECT_EQ(17221u, ntohs(address.sin6_port)) << "Port should be in network byte order";
+	EXPECT_EQ(ip, la::networkInterface::IPAddress{ address });
+
+	// Through the generic sockaddr
+	EXPECT_EQ(ip, la::networkInterface::IPAddress{ reinterpret_cast<sockaddr const&>(address) });
+}
+
+TEST(IPAddress, SockaddrStorage)
+{
+	for (auto const* const str : { "192.168.1.10", "::1", "::ffff:192.168.1.10" })
+	{
+		auto const ip = la::networkInterface::IPAddress{ str };
+		auto const storage = ip.getSockaddrStorage(80u);
+		EXPECT_EQ(ip.getType() == la::networkInterface::IPAddress::Type::V4 ? AF_INET : AF_INET6, storage.ss_family) << str;
+		EXPECT_EQ(ip, la::networkInterface::IPAddress{ storage }) << str;
+	}
+
+	// Mapped address normalization
+	auto const storage = la::networkInterface::IPAddress{ "::ffff:192.168.1.10" }.getSockaddrStorage();
+	EXPECT_EQ(la::networkInterface::IPAddress{ "192.168.1.10" }, (la::networkInterface::IPAddress{ storage, true }));
+
+	// Invalid IPAddress
+	EXPECT_THROW(la::networkInterface::IPAddress{}.getSockaddrStorage(), std::invalid_argument);
+
+	// Unsupported family
+	auto unspec = sockaddr_storage{};
+	unspec.ss_family = AF_UNSPEC;
+	EXPECT_THROW(la::networkInterface::IPAddress{ unspec }, std::invalid_argument);
+}
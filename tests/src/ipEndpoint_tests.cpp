@@ -0,0 +1,233 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+
+// Public API
+#include <la/networkInterfaceHelper/ipEndpoint.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept> // invalid_argument
+#include <string>
+#include <string_view>
+#include <array>
+#include <vector>
+#include <algorithm> // find_if
+#include <cstring> // memcpy
+#include <system_error> // errc
+
+#if defined(_WIN32)
+#	include <WinSock2.h>
+#	include <ws2tcpip.h>
+#else // !_WIN32
+#	include <sys/socket.h>
+#	include <netinet/in.h>
+#	include <arpa/inet.h>
+#endif // _WIN32
+
+static std::string_view ipEndpointToChars(std::array<char, la::networkInterface::IPEndpointCharsMaxLength>& buffer, la::networkInterface::IPEndpoint const& endpoint)
+{
+	auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::ipEndpointToChars(buffer.data(), buffer.data() + buffer.size(), endpoint);
+	if (ec != std::errc{})
+	{
+		return {};
+	}
+	return std::string_view(buffer.data(), static_cast<std::size_t>(ptr - buffer.data()));
+}
+
+static la::networkInterface::IPEndpoint ipEndpointFromChars(std::string_view const str)
+{
+	auto endpoint = la::networkInterface::IPEndpoint{};
+	auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::getInstance().ipEndpointFromChars(str.data(), str.data() + str.size(), endpoint);
+	if (ec != std::errc{} || ptr != str.data() + str.size())
+	{
+		return {};
+	}
+	return endpoint;
+}
+
+TEST(IPEndpoint, Construction)
+{
+	EXPECT_FALSE(la::networkInterface::IPEndpoint{}.isValid()) << "Default constructed IPEndpoint should be invalid";
+	EXPECT_EQ(0u, la::networkInterface::IPEndpoint{}.getSockaddrLength());
+
+	auto const endpoint = la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "fe80::1" }, 17221u, 3u };
+	EXPECT_TRUE(endpoint.isValid());
+	EXPECT_EQ(la::networkInterface::IPAddress{ "fe80::1" }, endpoint.getAddress());
+	EXPECT_EQ(17221u, endpoint.getPort());
+	EXPECT_EQ(3u, endpoint.getScopeId());
+
+	EXPECT_THROW((la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{}, 80u }), std::invalid_argument) << "Invalid IPAddress";
+	EXPECT_THROW((la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "192.168.1.10" }, 80u, 3u }), std::invalid_argument) << "Scope id is not supported for V4";
+}
+
+TEST(IPEndpoint, Comparison)
+{
+	auto const ip = la::networkInterface::IPAddress{ "fe80::1" };
+	EXPECT_EQ((la::networkInterface::IPEndpoint{ ip, 80u, 1u }), (la::networkInterface::IPEndpoint{ ip, 80u, 1u }));
+	EXPECT_NE((la::networkInterface::IPEndpoint{ ip, 80u, 1u }), (la::networkInterface::IPEndpoint{ ip, 80u, 2u }));
+	EXPECT_LT((la::networkInterface::IPEndpoint{ ip, 80u, 2u }), (la::networkInterface::IPEndpoint{ ip, 81u, 1u }));
+	EXPECT_LT((la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "192.168.1.10" }, 81u }), (la::networkInterface::IPEndpoint{ ip, 80u }));
+}
+
+TEST(IPEndpoint, SockaddrV4)
+{
+	auto const endpoint = la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "192.168.1.10" }, 17221u };
+	auto const storage = endpoint.getSockaddrStorage();
+	ASSERT_EQ(AF_INET, storage.ss_family);
+	EXPECT_EQ(sizeof(sockaddr_in), endpoint.getSockaddrLength());
+
+	auto address = sockaddr_in{};
+	std::memcpy(&address, &storage, sizeof(address));
+	EXPECT_EQ(17221u, ntohs(address.sin_port)) << "Port should be in network byte order";
+	EXPECT_EQ(0xC0A8010Au, ntohl(address.sin_addr.s_addr));
+
+	EXPECT_EQ(endpoint, la::networkInterface::IPEndpoint{ address });
+	EXPECT_EQ(endpoint, la::networkInterface::IPEndpoint{ storage });
+}
+
+TEST(IPEndpoint, SockaddrV6)
+{
+	auto const endpoint = la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "fe80::1ff:fe23:4567:890a" }, 17221u, 5u };
+	auto const storage = endpoint.getSockaddrStorage();
+	ASSERT_EQ(AF_INET6, storage.ss_family);
+	EXPECT_EQ(sizeof(sockaddr_in6), endpoint.getSockaddrLength());
+
+	auto address = sockaddr_in6{};
+	std::memcpy(&address, &storage, sizeof(address));
+	EXPECT_EQ(17221u, ntohs(address.sin6_port)) << "Port should be in network byte order";
+	EXPECT_EQ(5u, address.sin6_scope_id) << "Scope id should be in host byte order";
+
+	EXPECT_EQ(endpoint, la::networkInterface::IPEndpoint{ address });
+	EXPECT_EQ(endpoint, la::networkInterface::IPEndpoint{ reinterpret_cast<sockaddr const&>(address) });
+
+	// Mapped address normalization drops the scope id
+	auto const mapped = la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "::ffff:192.168.1.10" }, 80u, 5u }.getSockaddrStorage();
+	EXPECT_EQ((la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "192.168.1.10" }, 80u }), (la::networkInterface::IPEndpoint{ mapped, true }));
+
+	// Invalid endpoint
+	EXPECT_THROW(la::networkInterface::IPEndpoint{}.getSockaddrStorage(), std::invalid_argument);
+
+	// Unsupported family
+	auto unspec = sockaddr_storage{};
+	unspec.ss_family = AF_UNSPEC;
+	EXPECT_THROW(la::networkInterface::IPEndpoint{ unspec }, std::invalid_argument);
+}
+
+TEST(IPEndpoint, ToChars)
+{
+	auto buffer = std::array<char, la::networkInterface::IPEndpointCharsMaxLength>{};
+	EXPECT_EQ("192.168.1.10:17221", ipEndpointToChars(buffer, la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "192.168.1.10" }, 17221u }));
+	EXPECT_EQ("0.0.0.0:0", ipEndpointToChars(buffer, la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "0.0.0.0" }, 0u }));
+	EXPECT_EQ("[2001:db8::1]:443", ipEndpointToChars(buffer, la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "2001:db8::1" }, 443u }));
+	EXPECT_EQ("[fe80::1%3]:17221", ipEndpointToChars(buffer, la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "fe80::1" }, 17221u, 3u }));
+
+	// Longest representation
+	auto const longest = la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "1234:5678:9abc:def0:1234:5678:9abc:def0" }, 65535u, 4294967295u };
+	EXPECT_EQ("[1234:5678:9abc:def0:1234:5678:9abc:def0%4294967295]:65535", ipEndpointToChars(buffer, longest));
+	EXPECT_EQ(la::networkInterface::IPEndpointCharsMaxLength, ipEndpointToChars(buffer, longest).size());
+
+	// Buffer too small
+	for (auto const size : { 0u, 1u, 40u, 51u, 52u, 53u, 57u })
+	{
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::ipEndpointToChars(buffer.data(), buffer.data() + size, longest);
+		EXPECT_EQ(std::errc::value_too_large, ec) << size;
+		EXPECT_EQ(buffer.data() + size, ptr) << size;
+	}
+
+	// Invalid IPEndpoint
+	EXPECT_EQ(std::errc::invalid_argument, la::networkInterface::NetworkInterfaceHelper::ipEndpointToChars(buffer.data(), buffer.data() + buffer.size(), la::networkInterface::IPEndpoint{}).ec);
+}
+
+TEST(IPEndpoint, FromChars)
+{
+	EXPECT_EQ((la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "192.168.1.10" }, 17221u }), ipEndpointFromChars("192.168.1.10:17221"));
+	EXPECT_EQ((la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "2001:db8::1" }, 443u }), ipEndpointFromChars("[2001:db8::1]:443"));
+	EXPECT_EQ((la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "fe80::1" }, 17221u, 3u }), ipEndpointFromChars("[fe80::1%3]:17221"));
+	EXPECT_EQ((la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "::ffff:192.168.1.10" }, 80u }), ipEndpointFromChars("[::ffff:192.168.1.10]:80"));
+
+	// Parsing stops after the port
+	{
+		auto const str = std::string_view{ "10.0.0.1:80 trailing" };
+		auto endpoint = la::networkInterface::IPEndpoint{};
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::getInstance().ipEndpointFromChars(str.data(), str.data() + str.size(), endpoint);
+		EXPECT_EQ(std::errc{}, ec);
+		EXPECT_EQ(str.data() + 11, ptr);
+		EXPECT_EQ((la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "10.0.0.1" }, 80u }), endpoint);
+	}
+
+	// Invalid endpoints
+	for (auto const* const str : { "", "192.168.1.10", "192.168.1.10:", "192.168.1.10:65536", "192.168.1.10:-1", "2001:db8::1:80", "[2001:db8::1]", "[2001:db8::1]80", "[2001:db8::1:80", "[192.168.1.10]:80", "[fe80::1%]:80", "[fe80::1%0]:80", "[fe80::1%3:80", "[fe80::1%unknownInterfaceName]:80", "192.168.1.10%3:80" })
+	{
+		auto const strView = std::string_view{ str };
+		auto endpoint = la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "10.0.0.1" }, 80u };
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::getInstance().ipEndpointFromChars(strView.data(), strView.data() + strView.size(), endpoint);
+		EXPECT_EQ(std::errc::invalid_argument, ec) << str;
+		EXPECT_EQ(strView.data(), ptr) << str;
+		EXPECT_EQ((la::networkInterface::IPEndpoint{ la::networkInterface::IPAddress{ "10.0.0.1" }, 80u }), endpoint) << "Should be untouched: " << str;
+	}
+}
+
+TEST(IPEndpoint, FromCharsInterfaceZone)
+{
+	auto& helper = la::networkInterface::NetworkInterfaceHelper::getInstance();
+	auto buffer = std::array<char, la::networkInterface::IPEndpointCharsMaxLength>{};
+	auto interfaces = std::vector<la::networkInterface::Interface>{};
+	helper.enumerateInterfaces(
+		[&interfaces](la::networkInterface::Interface const& intfc)
+		{
+			interfaces.push_back(intfc);
+		});
+	for (auto const& intfc : interfaces)
+	{
+		if (intfc.index == 0u)
+		{
+			continue;
+		}
+		EXPECT_EQ(intfc.index, helper.getInterfaceIndex(intfc.id)) << intfc.id;
+
+		// An exact id takes precedence over the alias of another interface
+		auto const idMatchingAliasIt = std::find_if(interfaces.begin(), interfaces.end(),
+			[&intfc](la::networkInterface::Interface const& other)
+			{
+				return other.id == intfc.alias;
+			});
+		EXPECT_EQ(idMatchingAliasIt != interfaces.end() ? idMatchingAliasIt->index : intfc.index, helper.getInterfaceIndex(intfc.alias)) << intfc.alias;
+
+		// Zone resolved from the interface name, formatted as a numeric scope id
+		auto const endpoint = ipEndpointFromChars("[fe80::1%" + intfc.id + "]:17221");
+		EXPECT_EQ(intfc.index, endpoint.getScopeId()) << intfc.id;
+		EXPECT_EQ(endpoint, ipEndpointFromChars(ipEndpointToChars(buffer, endpoint))) << "Round trip through the numeric scope id";
+	}
+	EXPECT_EQ(0u, helper.getInterfaceIndex("unknownInterfaceName"));
+}
@@ -0,0 +1,202 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+
+// Public API
+#include <la/networkInterfaceHelper/ipFamilyAddress.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept> // invalid_argument
+#include <type_traits>
+#include <cstdint>
+
+// Storage must not be larger than the raw address
+static_assert(sizeof(la::networkInterface::IPV4Address) == 4u, "");
+static_assert(sizeof(la::networkInterface::IPV6Address) == 16u, "");
+static_assert(std::is_trivially_copyable_v<la::networkInterface::IPV4Address>, "");
+static_assert(std::is_trivially_copyable_v<la::networkInterface::IPV6Address>, "");
+
+// Operations must be usable in constant expressions
+static constexpr auto s_ConstexprV4 = la::networkInterface::IPV4Address{ 192u, 168u, 1u, 10u };
+static_assert(s_ConstexprV4.getPacked() == 0xC0A8010Au, "");
+static_assert(la::networkInterface::getNetworkAddress(s_ConstexprV4, 24u) == la::networkInterface::IPV4Address{ 192u, 168u, 1u, 0u }, "");
+static_assert(la::networkInterface::getBroadcastAddress(s_ConstexprV4, 24u) == la::networkInterface::IPV4Address{ 192u, 168u, 1u, 255u }, "");
+static_assert(la::networkInterface::getPrefixLength(la::networkInterface::IPV4Address::makeNetmask(20u)) == 20u, "");
+static_assert(s_ConstexprV4.toPrefix(24u).contains(s_ConstexprV4.getPacked()), "");
+static constexpr auto s_ConstexprV6 = la::networkInterface::IPV6Address{ la::networkInterface::IPV6Address::value_type{ 0xfe80, 0, 0, 0, 0x01ff, 0xfe23, 0x4567, 0x890a } };
+static_assert(s_ConstexprV6.isLinkLocal(), "");
+static_assert(la::networkInterface::getNetworkAddress(s_ConstexprV6, 64u) == la::networkInterface::IPV6Address{ la::networkInterface::IPV6Address::value_type_packed{ 0xfe80000000000000u, 0u } }, "");
+static_assert(la::networkInterface::getPrefixLength(la::networkInterface::IPV6Address::makeNetmask(100u)) == 100u, "");
+static_assert(la::networkInterface::getPrefixLength(la::networkInterface::IPV6Address::makeNetmask(128u)) == 128u, "");
+static_assert(la::networkInterface::getPrefixLength(la::networkInterface::IPV4Address{ 255u, 0u, 255u, 0u }) == 8u, "");
+static_assert(noexcept(s_ConstexprV4 + 1u) && noexcept(s_ConstexprV6 & s_ConstexprV6), "");
+
+// Generic algorithms must only accept the family specific address types
+static_assert(la::networkInterface::IsIPFamilyAddress<la::networkInterface::IPV4Address> && la::networkInterface::IsIPFamilyAddress<la::networkInterface::IPV6Address>, "");
+static_assert(!la::networkInterface::IsIPFamilyAddress<la::networkInterface::IPAddress> && !la::networkInterface::IsIPFamilyAddress<std::uint32_t>, "");
+
+TEST(IPV4Address, Construction)
+{
+	EXPECT_EQ(0u, la::networkInterface::IPV4Address{}.getPacked()) << "Default constructed IPV4Address should be 0.0.0.0";
+	EXPECT_EQ((la::networkInterface::IPV4Address{ 10u, 0u, 0u, 1u }), la::networkInterface::IPV4Address{ 0x0A000001u });
+	EXPECT_EQ((la::networkInterface::IPV4Address{ 10u, 0u, 0u, 1u }), (la::networkInterface::IPV4Address{ la::networkInterface::IPV4Address::value_type{ 10u, 0u, 0u, 1u } }));
+	EXPECT_EQ((la::networkInterface::IPV4Address::value_type{ 10u, 0u, 0u, 1u }), la::networkInterface::IPV4Address{ 0x0A000001u }.getBytes());
+}
+
+TEST(IPV4Address, IPAddressConversion)
+{
+	auto const ip = la::networkInterface::IPAddress{ "192.168.1.10" };
+	auto const ipv4 = la::networkInterface::IPV4Address{ ip };
+	EXPECT_EQ(0xC0A8010Au, ipv4.getPacked());
+
+	// Implicit conversion to IPAddress
+	la::networkInterface::IPAddress const converted = ipv4;
+	EXPECT_EQ(ip, converted);
+	EXPECT_EQ("192.168.1.10", static_cast<std::string>(converted));
+
+	EXPECT_THROW(la::networkInterface::IPV4Address{ la::networkInterface::IPAddress{ "::1" } }, std::invalid_argument);
+	EXPECT_THROW(la::networkInterface::IPV4Address{ la::networkInterface::IPAddress{} }, std::invalid_argument);
+}
+
+TEST(IPV4Address, Operators)
+{
+	auto ip = la::networkInterface::IPV4Address{ 192u, 168u, 1u, 255u };
+	EXPECT_EQ((la::networkInterface::IPV4Address{ 192u, 168u, 2u, 0u }), ++ip);
+	EXPECT_EQ((la::networkInterface::IPV4Address{ 192u, 168u, 1u, 255u }), --ip);
+	EXPECT_EQ((la::networkInterface::IPV4Address{ 0u, 0u, 0u, 1u }), (la::networkInterface::IPV4Address{ 255u, 255u, 255u, 255u } + 2u)) << "Should wrap modulo 2^32";
+	EXPECT_EQ((la::networkInterface::IPV4Address{ 255u, 255u, 255u, 255u }), la::networkInterface::IPV4Address{} - 1u) << "Should wrap modulo 2^32";
+	EXPECT_LT((la::networkInterface::IPV4Address{ 10u, 0u, 0u, 1u }), (la::networkInterface::IPV4Address{ 10u, 0u, 1u, 0u }));
+	EXPECT_EQ((la::networkInterface::IPV4Address{ 0u, 0u, 0u, 255u }), ~la::networkInterface::IPV4Address::makeNetmask(24u));
+	EXPECT_EQ((la::networkInterface::IPV4Address{ 255u, 255u, 255u, 255u }), la::networkInterface::IPV4Address::makeNetmask(40u)) << "Prefix length should be clamped";
+}
+
+TEST(IPV4Address, Classification)
+{
+	EXPECT_TRUE(la::networkInterface::IPV4Address{}.isUnspecified());
+	EXPECT_TRUE((la::networkInterface::IPV4Address{ 127u, 0u, 0u, 1u }.isLoopback()));
+	EXPECT_TRUE((la::networkInterface::IPV4Address{ 169u, 254u, 3u, 4u }.isLinkLocal()));
+	EXPECT_TRUE((la::networkInterface::IPV4Address{ 239u, 255u, 255u, 250u }.isMulticast()));
+	EXPECT_FALSE((la::networkInterface::IPV4Address{ 240u, 0u, 0u, 1u }.isMulticast()));
+	for (auto const ip : { la::networkInterface::IPV4Address{ 10u, 1u, 2u, 3u }, la::networkInterface::IPV4Address{ 172u, 31u, 255u, 255u }, la::networkInterface::IPV4Address{ 192u, 168u, 0u, 1u } })
+	{
+		EXPECT_TRUE(ip.isPrivate()) << static_cast<std::string>(la::networkInterface::IPAddress{ ip });
+	}
+	for (auto const ip : { la::networkInterface::IPV4Address{ 11u, 1u, 2u, 3u }, la::networkInterface::IPV4Address{ 172u, 32u, 0u, 0u }, la::networkInterface::IPV4Address{ 192u, 169u, 0u, 1u } })
+	{
+		EXPECT_FALSE(ip.isPrivate()) << static_cast<std::string>(la::networkInterface::IPAddress{ ip });
+	}
+}
+
+TEST(IPV6Address, Construction)
+{
+	EXPECT_TRUE(la::networkInterface::IPV6Address{}.isUnspecified()) << "Default constructed IPV6Address should be ::";
+
+	auto const groups = la::networkInterface::IPV6Address::value_type{ 0x2001, 0x0db8, 0, 0, 1, 0, 0, 1 };
+	auto const ip = la::networkInterface::IPV6Address{ groups };
+	EXPECT_EQ(groups, ip.getGroups());
+	EXPECT_EQ((la::networkInterface::IPV6Address::value_type_packed{ 0x20010db800000000u, 0x0001000000000001u }), ip.getPacked());
+}
+
+TEST(IPV6Address, IPAddressConversion)
+{
+	auto const ip = la::networkInterface::IPAddress{ "2001:db8::1:0:0:1" };
+	auto const ipv6 = la::networkInterface::IPV6Address{ ip };
+
+	// Implicit conversion to IPAddress
+	la::networkInterface::IPAddress const converted = ipv6;
+	EXPECT_EQ(ip, converted);
+
+	EXPECT_THROW(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "192.168.1.10" } }, std::invalid_argument);
+}
+
+TEST(IPV6Address, Operators)
+{
+	auto ip = la::networkInterface::IPV6Address{ la::networkInterface::IPV6Address::value_type_packed{ 0u, ~std::uint64_t{ 0u } } };
+	EXPECT_EQ((la::networkInterface::IPV6Address{ la::networkInterface::IPV6Address::value_type_packed{ 1u, 0u } }), ++ip) << "Should carry to the high part";
+	EXPECT_EQ((la::networkInterface::IPV6Address{ la::networkInterface::IPV6Address::value_type_packed{ 0u, ~std::uint64_t{ 0u } } }), --ip);
+	EXPECT_EQ(la::networkInterface::IPV6Address{}, la::networkInterface::IPV6Address::makeNetmask(128u) + 1u) << "Should wrap modulo 2^128";
+	EXPECT_LT(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "::ffff:ffff:ffff" } }, la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "0:0:0:1::" } });
+	EXPECT_EQ(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "::ffff:ffff:ffff:ffff" } }, ~la::networkInterface::IPV6Address::makeNetmask(64u));
+}
+
+TEST(IPV6Address, Classification)
+{
+	EXPECT_TRUE(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "::1" } }.isLoopback());
+	EXPECT_TRUE(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "febf::1" } }.isLinkLocal());
+	EXPECT_FALSE(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "fec0::1" } }.isLinkLocal());
+	EXPECT_TRUE(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "ff02::1" } }.isMulticast());
+	EXPECT_TRUE(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "fd12:3456::1" } }.isPrivate());
+	EXPECT_FALSE(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "fe00::1" } }.isPrivate());
+
+	auto const mapped = la::networkInterface::IPV6Address::fromMappedV4(la::networkInterface::IPV4Address{ 192u, 168u, 1u, 10u });
+	EXPECT_TRUE(mapped.isV4Mapped());
+	EXPECT_EQ((la::networkInterface::IPV4Address{ 192u, 168u, 1u, 10u }), mapped.getMappedV4());
+	EXPECT_EQ(la::networkInterface::IPAddress{ "::ffff:192.168.1.10" }, static_cast<la::networkInterface::IPAddress>(mapped));
+	EXPECT_FALSE(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "::192.168.1.10" } }.isV4Mapped());
+}
+
+TEST(IPFamilyAddress, GenericAlgorithms)
+{
+	// Same results as IPPrefix for both families
+	for (auto const length : { 1u, 8u, 23u, 24u, 31u, 32u })
+	{
+		auto const ip = la::networkInterface::IPV4Address{ 192u, 168u, 100u, 254u };
+		auto const prefix = ip.toPrefix(static_cast<std::uint8_t>(length));
+		EXPECT_EQ(la::networkInterface::IPV4Address::fromValue(prefix.getNetworkValue()), la::networkInterface::getNetworkAddress(ip, static_cast<std::uint8_t>(length))) << length;
+		EXPECT_EQ(la::networkInterface::IPV4Address::fromValue(prefix.getBroadcastValue()), la::networkInterface::getBroadcastAddress(ip, static_cast<std::uint8_t>(length))) << length;
+		EXPECT_EQ(length, la::networkInterface::getPrefixLength(la::networkInterface::IPV4Address::makeNetmask(static_cast<std::uint8_t>(length))));
+	}
+	for (auto const length : { 0u, 10u, 64u, 65u, 127u, 128u })
+	{
+		auto const ip = la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "fe80::1ff:fe23:4567:890a" } };
+		auto const prefix = ip.toPrefix(static_cast<std::uint8_t>(length));
+		EXPECT_EQ(la::networkInterface::IPV6Address::fromValue(prefix.getNetworkValue()), la::networkInterface::getNetworkAddress(ip, static_cast<std::uint8_t>(length))) << length;
+		EXPECT_EQ(la::networkInterface::IPV6Address::fromValue(prefix.getBroadcastValue()), la::networkInterface::getBroadcastAddress(ip, static_cast<std::uint8_t>(length))) << length;
+		EXPECT_EQ(length, la::networkInterface::getPrefixLength(la::networkInterface::IPV6Address::makeNetmask(static_cast<std::uint8_t>(length))));
+	}
+
+	EXPECT_TRUE((la::networkInterface::isInSameSubnet(la::networkInterface::IPV4Address{ 10u, 0u, 0u, 1u }, la::networkInterface::IPV4Address{ 10u, 0u, 0u, 254u }, 24u)));
+	EXPECT_FALSE((la::networkInterface::isInSameSubnet(la::networkInterface::IPV4Address{ 10u, 0u, 0u, 1u }, la::networkInterface::IPV4Address{ 10u, 0u, 1u, 1u }, 24u)));
+	EXPECT_TRUE(la::networkInterface::isInSameSubnet(la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "fe80::1" } }, la::networkInterface::IPV6Address{ la::networkInterface::IPAddress{ "fe80::2:1" } }, 64u));
+
+	// Dispatching an IPAddress to the family specialized algorithms
+	auto const isLinkLocal = [](auto const& ip)
+	{
+		return ip.isLinkLocal();
+	};
+	EXPECT_TRUE(la::networkInterface::visitIPAddress(la::networkInterface::IPAddress{ "169.254.1.1" }, isLinkLocal));
+	EXPECT_TRUE(la::networkInterface::visitIPAddress(la::networkInterface::IPAddress{ "fe80::1" }, isLinkLocal));
+	EXPECT_FALSE(la::networkInterface::visitIPAddress(la::networkInterface::IPAddress{ "10.0.0.1" }, isLinkLocal));
+	EXPECT_THROW(la::networkInterface::visitIPAddress(la::networkInterface::IPAddress{}, isLinkLocal), std::invalid_argument);
+}
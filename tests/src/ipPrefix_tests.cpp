@@ -0,0 +1,175 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+
+// Public API
+#include <la/networkInterfaceHelper/ipPrefix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept> // invalid_argument
+#include <random>
+#include <cstdint>
+
+// Computations must be usable in constant expressions
+static constexpr auto s_ConstexprPrefix = la::networkInterface::IPPrefix::fromPackedV4(0xC0A8010Au, 24u); // 192.168.1.10/24
+static_assert(s_ConstexprPrefix.getNetworkValue() == la::networkInterface::UInt128{ 0xC0A80100u }, "");
+static_assert(s_ConstexprPrefix.getBroadcastValue() == la::networkInterface::UInt128{ 0xC0A801FFu }, "");
+static_assert(s_ConstexprPrefix.contains(la::networkInterface::IPAddress::value_type_packed_v4{ 0xC0A801FEu }), "");
+static_assert(!s_ConstexprPrefix.contains(la::networkInterface::IPAddress::value_type_packed_v4{ 0xC0A80201u }), "");
+
+TEST(IPPrefix, Construction)
+{
+	EXPECT_FALSE(la::networkInterface::IPPrefix{}.isValid()) << "Default constructed IPPrefix should be invalid";
+
+	auto const prefix = la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "192.168.1.10" }, 24u };
+	EXPECT_TRUE(prefix.isValid());
+	EXPECT_EQ(la::networkInterface::IPAddress::Type::V4, prefix.getType());
+	EXPECT_EQ(24u, prefix.getPrefixLength());
+	EXPECT_EQ(la::networkInterface::IPAddress{ "192.168.1.10" }, prefix.getAddress()) << "Host bits should be preserved";
+	EXPECT_EQ(la::networkInterface::IPAddress{ "255.255.255.0" }, prefix.getNetmask());
+
+	EXPECT_THROW((la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{}, 8u }), std::invalid_argument) << "Invalid address should throw";
+	EXPECT_THROW((la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "10.0.0.0" }, 0u }), std::invalid_argument) << "Empty V4 prefix should throw";
+	EXPECT_THROW((la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "10.0.0.0" }, 33u }), std::invalid_argument) << "V4 prefix longer than 32 should throw";
+	EXPECT_NO_THROW((la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "::" }, 0u })) << "Empty V6 prefix is valid";
+	EXPECT_THROW((la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "::" }, 129u }), std::invalid_argument) << "V6 prefix longer than 128 should throw";
+
+	// Same validation as IPAddressInfo
+	EXPECT_THROW((la::networkInterface::IPPrefix{ la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "10.0.0.1" }, la::networkInterface::IPAddress{ "255.0.255.0" } } }), std::invalid_argument) << "Non contiguous netmask should throw";
+	EXPECT_THROW((la::networkInterface::IPPrefix{ la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "10.0.0.1" }, la::networkInterface::IPAddress{ "ffff::" } } }), std::invalid_argument) << "Mismatching Types should throw";
+	EXPECT_THROW((la::networkInterface::IPPrefix{ la::networkInterface::IPAddressInfo{} }), std::invalid_argument) << "Invalid IPAddressInfo should throw";
+}
+
+TEST(IPPrefix, NetmaskValue)
+{
+	auto const V4 = la::networkInterface::IPAddress::Type::V4;
+	auto const V6 = la::networkInterface::IPAddress::Type::V6;
+
+	EXPECT_EQ(la::networkInterface::UInt128{ 0x80000000u }, la::networkInterface::IPPrefix::makeNetmaskValue(V4, 1u));
+	EXPECT_EQ(la::networkInterface::UInt128{ 0xFFFFFFFEu }, la::networkInterface::IPPrefix::makeNetmaskValue(V4, 31u));
+	EXPECT_EQ(la::networkInterface::UInt128{ 0xFFFFFFFFu }, la::networkInterface::IPPrefix::makeNetmaskValue(V4, 32u));
+
+	EXPECT_EQ(la::networkInterface::UInt128{}, la::networkInterface::IPPrefix::makeNetmaskValue(V6, 0u));
+	EXPECT_EQ((la::networkInterface::UInt128{ 0x8000000000000000u, 0u }), la::networkInterface::IPPrefix::makeNetmaskValue(V6, 1u));
+	EXPECT_EQ((la::networkInterface::UInt128{ ~std::uint64_t{ 0u }, 0u }), la::networkInterface::IPPrefix::makeNetmaskValue(V6, 64u));
+	EXPECT_EQ((la::networkInterface::UInt128{ ~std::uint64_t{ 0u }, 0x8000000000000000u }), la::networkInterface::IPPrefix::makeNetmaskValue(V6, 65u));
+	EXPECT_EQ(la::networkInterface::UInt128::max(), la::networkInterface::IPPrefix::makeNetmaskValue(V6, 128u));
+
+	// Must match the netmasks built by IPAddress for all lengths
+	for (auto length = 0u; length <= 128u; ++length)
+	{
+		auto const packed = la::networkInterface::IPAddress::packedV6FromPrefixLength(static_cast<std::uint8_t>(length));
+		EXPECT_EQ((la::networkInterface::UInt128{ packed.first, packed.second }), la::networkInterface::IPPrefix::makeNetmaskValue(V6, static_cast<std::uint8_t>(length))) << "Prefix length " << length;
+	}
+}
+
+TEST(IPPrefix, SubnetAddressesV4)
+{
+	auto const prefix = la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "192.168.1.10" }, 24u };
+	EXPECT_EQ(la::networkInterface::IPAddress{ "192.168.1.0" }, prefix.getNetworkAddress());
+	EXPECT_EQ(la::networkInterface::IPAddress{ "192.168.1.255" }, prefix.getBroadcastAddress());
+	EXPECT_EQ(la::networkInterface::IPAddress{ "192.168.1.1" }, prefix.getFirstHostAddress());
+	EXPECT_EQ(la::networkInterface::IPAddress{ "192.168.1.254" }, prefix.getLastHostAddress());
+
+	// Point-to-point links (RFC 3021) and single host prefixes have no reserved addresses
+	auto const p2p = la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "10.0.0.1" }, 31u };
+	EXPECT_EQ(la::networkInterface::IPAddress{ "10.0.0.0" }, p2p.getFirstHostAddress());
+	EXPECT_EQ(la::networkInterface::IPAddress{ "10.0.0.1" }, p2p.getLastHostAddress());
+	auto const host = la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "10.0.0.1" }, 32u };
+	EXPECT_EQ(la::networkInterface::IPAddress{ "10.0.0.1" }, host.getFirstHostAddress());
+	EXPECT_EQ(la::networkInterface::IPAddress{ "10.0.0.1" }, host.getLastHostAddress());
+
+	// Invalid prefix never throws
+	auto const invalid = la::networkInterface::IPPrefix{};
+	EXPECT_FALSE(invalid.getNetworkAddress().isValid());
+	EXPECT_FALSE(invalid.contains(la::networkInterface::IPAddress{ "10.0.0.1" }));
+}
+
+TEST(IPPrefix, SubnetAddressesV6)
+{
+	auto const prefix = la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "2001:db8::1234" }, 64u };
+	EXPECT_EQ(la::networkInterface::IPAddress{ "2001:db8::" }, prefix.getNetworkAddress());
+	EXPECT_EQ(la::networkInterface::IPAddress{ "2001:db8::ffff:ffff:ffff:ffff" }, prefix.getBroadcastAddress());
+	EXPECT_EQ(prefix.getNetworkAddress(), prefix.getFirstHostAddress());
+	EXPECT_EQ(prefix.getBroadcastAddress(), prefix.getLastHostAddress());
+
+	auto const all = la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "2001:db8::1" }, 0u };
+	EXPECT_EQ(la::networkInterface::IPAddress{ "::" }, all.getNetworkAddress());
+	EXPECT_EQ(la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" }, all.getBroadcastAddress());
+}
+
+TEST(IPPrefix, Contains)
+{
+	auto const prefixV4 = la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "172.16.5.4" }, 12u };
+	EXPECT_TRUE(prefixV4.contains(la::networkInterface::IPAddress{ "172.31.255.255" }));
+	EXPECT_FALSE(prefixV4.contains(la::networkInterface::IPAddress{ "172.32.0.0" }));
+	EXPECT_FALSE(prefixV4.contains(la::networkInterface::IPAddress{ "::ffff:172.16.0.1" })) << "Different Types never match";
+
+	auto const prefixV6 = la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "fe80::" }, 10u };
+	EXPECT_TRUE(prefixV6.contains(la::networkInterface::IPAddress{ "febf::1" }));
+	EXPECT_FALSE(prefixV6.contains(la::networkInterface::IPAddress{ "fec0::1" }));
+
+	// Prefix inclusion
+	EXPECT_TRUE(prefixV4.contains(la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "172.20.0.0" }, 16u }));
+	EXPECT_TRUE(prefixV4.contains(prefixV4));
+	EXPECT_FALSE(prefixV4.contains(la::networkInterface::IPPrefix{ la::networkInterface::IPAddress{ "172.0.0.0" }, 8u })) << "Shorter prefix is not included";
+	EXPECT_FALSE(la::networkInterface::IPPrefix{}.contains(la::networkInterface::IPPrefix{}));
+}
+
+TEST(IPPrefix, MatchesIPAddressInfo)
+{
+	auto generator = std::mt19937_64{ 42u };
+	for (auto i = 0u; i < 1000u; ++i)
+	{
+		// V4
+		{
+			auto const length = static_cast<std::uint8_t>(1u + generator() % 32u);
+			auto const info = la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ static_cast<la::networkInterface::IPAddress::value_type_packed_v4>(generator()) }, la::networkInterface::IPPrefix::fromPackedV4(0u, length).getNetmask() };
+			auto const prefix = la::networkInterface::IPPrefix{ info };
+			EXPECT_EQ(length, prefix.getPrefixLength());
+			EXPECT_EQ(info, prefix.toIPAddressInfo()) << "Conversion should be lossless";
+			EXPECT_EQ(info.getNetworkBaseAddress(), prefix.getNetworkAddress());
+			EXPECT_EQ(info.getBroadcastAddress(), prefix.getBroadcastAddress());
+		}
+		// V6
+		{
+			auto const length = static_cast<std::uint8_t>(generator() % 129u);
+			auto const info = la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ la::networkInterface::IPAddress::value_type_packed_v6{ generator(), generator() } }, la::networkInterface::IPAddress{ la::networkInterface::IPAddress::packedV6FromPrefixLength(length) } };
+			auto const prefix = la::networkInterface::IPPrefix{ info };
+			EXPECT_EQ(length, prefix.getPrefixLength());
+			EXPECT_EQ(info, prefix.toIPAddressInfo()) << "Conversion should be lossless";
+			EXPECT_EQ(info.getNetworkBaseAddress(), prefix.getNetworkAddress());
+		}
+	}
+}
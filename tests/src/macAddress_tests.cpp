@@ -0,0 +1,314 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+// Public API
+#include <la/networkInterfaceHelper/networkInterfaceHelper.hpp>
+#include <la/networkInterfaceHelper/packedMacAddress.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept> // invalid_argument
+#include <string>
+#include <array>
+#include <cstring> // strlen
+#include <vector>
+#include <algorithm> // is_sorted
+#include <iterator> // distance
+
+/* ************************************************************ */
+/* MacAddress Tests                                             */
+/* ************************************************************ */
+static auto const s_TestMacAddress = la::networkInterface::MacAddress{ 0x00, 0x1b, 0x92, 0xab, 0xcd, 0xef };
+
+TEST(MacAddress, StringToMacAddress)
+{
+	EXPECT_EQ(s_TestMacAddress, la::networkInterface::NetworkInterfaceHelper::stringToMacAddress("00:1B:92:ab:cd:EF"));
+	EXPECT_EQ(s_TestMacAddress, la::networkInterface::NetworkInterfaceHelper::stringToMacAddress("00-1b-92-ab-cd-ef", '-'));
+	EXPECT_EQ(s_TestMacAddress, la::networkInterface::NetworkInterfaceHelper::stringToMacAddress("001b92abcdef", '\0'));
+	EXPECT_EQ("00-1b-92-ab-cd-ef", la::networkInterface::NetworkInterfaceHelper::macAddressToString(s_TestMacAddress, false, '-'));
+	EXPECT_EQ("001B92ABCDEF", la::networkInterface::NetworkInterfaceHelper::macAddressToString(s_TestMacAddress, true, '\0'));
+
+	EXPECT_THROW(la::networkInterface::NetworkInterfaceHelper::stringToMacAddress("0:1:2:3:4:5"), std::invalid_argument) << "Short bytes should not be accepted";
+	EXPECT_THROW(la::networkInterface::NetworkInterfaceHelper::stringToMacAddress("00:1B:92:AB:CD"), std::invalid_argument) << "Missing byte should not be accepted";
+	EXPECT_THROW(la::networkInterface::NetworkInterfaceHelper::stringToMacAddress("00:1B:92:AB:CD:EF:"), std::invalid_argument) << "Trailing characters should not be accepted";
+	EXPECT_THROW(la::networkInterface::NetworkInterfaceHelper::stringToMacAddress("00:1B:92:AB:CD:EG"), std::invalid_argument) << "Non hex digit should not be accepted";
+	EXPECT_THROW(la::networkInterface::NetworkInterfaceHelper::stringToMacAddress("00-1B-92-AB-CD-EF"), std::invalid_argument) << "Wrong separator should not be accepted";
+	EXPECT_THROW(la::networkInterface::NetworkInterfaceHelper::stringToMacAddress(""), std::invalid_argument) << "Empty string should not be accepted";
+}
+
+TEST(MacAddress, ToChars)
+{
+	auto buffer = std::array<char, 17>{};
+	auto const toString = [&buffer](la::networkInterface::MacAddressNotation const notation, bool const upperCase)
+	{
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::macAddressToChars(buffer.data(), buffer.data() + buffer.size(), s_TestMacAddress, notation, upperCase);
+		EXPECT_EQ(std::errc{}, ec);
+		EXPECT_EQ(la::networkInterface::getMacAddressCharsLength(notation), static_cast<size_t>(ptr - buffer.data()));
+		return std::string(buffer.data(), ptr);
+	};
+
+	EXPECT_EQ("00:1B:92:AB:CD:EF", toString(la::networkInterface::MacAddressNotation::Colon, true));
+	EXPECT_EQ("00-1b-92-ab-cd-ef", toString(la::networkInterface::MacAddressNotation::Dash, false));
+	EXPECT_EQ("001b.92ab.cdef", toString(la::networkInterface::MacAddressNotation::CiscoDotted, false));
+	EXPECT_EQ("001B92ABCDEF", toString(la::networkInterface::MacAddressNotation::Bare, true));
+
+	// Buffer too small
+	auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::macAddressToChars(buffer.data(), buffer.data() + 16, s_TestMacAddress);
+	EXPECT_EQ(std::errc::value_too_large, ec);
+	EXPECT_EQ(buffer.data() + 16, ptr);
+}
+
+TEST(MacAddress, FromChars)
+{
+	auto const parse = [](std::string const& str, la::networkInterface::MacAddressNotation const notation)
+	{
+		auto macAddress = la::networkInterface::MacAddress{};
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::macAddressFromChars(str.data(), str.data() + str.size(), macAddress, notation);
+		EXPECT_EQ(str.data() + la::networkInterface::getMacAddressCharsLength(notation), ptr) << str;
+		EXPECT_EQ(std::errc{}, ec) << str;
+		return macAddress;
+	};
+
+	EXPECT_EQ(s_TestMacAddress, parse("00:1B:92:ab:cd:EF", la::networkInterface::MacAddressNotation::Colon));
+	EXPECT_EQ(s_TestMacAddress, parse("00-1b-92-ab-cd-ef", la::networkInterface::MacAddressNotation::Dash));
+	EXPECT_EQ(s_TestMacAddress, parse("001b.92ab.cdef", la::networkInterface::MacAddressNotation::CiscoDotted));
+	EXPECT_EQ(s_TestMacAddress, parse("001B92ABCDEF", la::networkInterface::MacAddressNotation::Bare));
+	EXPECT_EQ(s_TestMacAddress, parse("001B92ABCDEF trailing", la::networkInterface::MacAddressNotation::Bare)) << "Trailing characters should not be consumed";
+
+	char const* const invalidStrings[] = { "", "00:1B:92:AB:CD", "00:1B:92:AB:CD:E", "00:1B:92:AB:CD-EF", "0x:1B:92:AB:CD:EF", " 00:1B:92:AB:CD:EF", "001b.92ab.cde", "001b92ab.cdef", "001B92ABCDE" };
+	for (auto const* const str : invalidStrings)
+	{
+		auto macAddress = s_TestMacAddress;
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::macAddressFromChars(str, str + std::strlen(str), macAddress);
+		EXPECT_EQ(std::errc::invalid_argument, ec) << str;
+		EXPECT_EQ(str, ptr) << str;
+		EXPECT_EQ(s_TestMacAddress, macAddress) << "MacAddress should be untouched on error";
+	}
+}
+
+TEST(MacAddress, FromCharsDetectNotation)
+{
+	for (auto const* const str : { "00:1b:92:ab:cd:ef", "00-1B-92-AB-CD-EF", "001B.92AB.CDEF", "001b92abcdef" })
+	{
+		auto macAddress = la::networkInterface::MacAddress{};
+		auto const end = str + std::strlen(str);
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::macAddressFromChars(str, end, macAddress);
+		EXPECT_EQ(std::errc{}, ec) << str;
+		EXPECT_EQ(end, ptr) << str;
+		EXPECT_EQ(s_TestMacAddress, macAddress) << str;
+	}
+}
+
+TEST(MacAddress, Batch)
+{
+	auto const macAddresses = std::array<la::networkInterface::MacAddress, 3>{ s_TestMacAddress, la::networkInterface::MacAddress{ 0, 1, 2, 3, 4, 5 }, la::networkInterface::MacAddress{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff } };
+
+	auto buffer = std::array<char, 3 * 18>{};
+	{
+		auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::macAddressesToChars(buffer.data(), buffer.data() + buffer.size() - 1, macAddresses.data(), macAddresses.size());
+		EXPECT_EQ(std::errc::value_too_large, ec) << "Buffer too small";
+	}
+	auto const [ptr, ec] = la::networkInterface::NetworkInterfaceHelper::macAddressesToChars(buffer.data(), buffer.data() + buffer.size(), macAddresses.data(), macAddresses.size());
+	ASSERT_EQ(std::errc{}, ec);
+	EXPECT_EQ(buffer.data() + buffer.size(), ptr);
+	EXPECT_EQ("00:1B:92:AB:CD:EF\n00:01:02:03:04:05\nFF:FF:FF:FF:FF:FF\n", std::string(buffer.data(), ptr));
+
+	auto parsed = std::array<la::networkInterface::MacAddress, 4>{};
+	EXPECT_EQ(3u, la::networkInterface::NetworkInterfaceHelper::macAddressesFromChars(buffer.data(), ptr, parsed.data(), parsed.size()));
+	EXPECT_EQ(macAddresses[0], parsed[0]);
+	EXPECT_EQ(macAddresses[1], parsed[1]);
+	EXPECT_EQ(macAddresses[2], parsed[2]);
+
+	// Last delimiter is optional, and parsing stops at the first invalid record
+	auto const str = std::string{ "00:1B:92:AB:CD:EF\n00:01:02:03:04:05" };
+	EXPECT_EQ(2u, la::networkInterface::NetworkInterfaceHelper::macAddressesFromChars(str.data(), str.data() + str.size(), parsed.data(), parsed.size()));
+	auto const invalid = std::string{ "00:1B:92:AB:CD:EF\n00:01:02:03:04:0Z\nFF:FF:FF:FF:FF:FF" };
+	EXPECT_EQ(1u, la::networkInterface::NetworkInterfaceHelper::macAddressesFromChars(invalid.data(), invalid.data() + invalid.size(), parsed.data(), parsed.size()));
+	auto const wrongDelimiter = std::string{ "00:1B:92:AB:CD:EF,00:01:02:03:04:05" };
+	EXPECT_EQ(1u, la::networkInterface::NetworkInterfaceHelper::macAddressesFromChars(wrongDelimiter.data(), wrongDelimiter.data() + wrongDelimiter.size(), parsed.data(), parsed.size()));
+}
+
+TEST(MacAddress, Vendor)
+{
+	if (!la::networkInterface::NetworkInterfaceHelper::isOuiDatabaseAvailable())
+	{
+		EXPECT_TRUE(la::networkInterface::NetworkInterfaceHelper::getMacAddressVendor(s_TestMacAddress).empty());
+		GTEST_SKIP() << "OUI database not compiled in";
+	}
+
+	auto const vendor = la::networkInterface::NetworkInterfaceHelper::getMacAddressVendor(s_TestMacAddress);
+	ASSERT_EQ("l-acoustics", vendor);
+	EXPECT_EQ('\0', *(vendor.data() + vendor.size())) << "Vendor name should be null-terminated";
+
+	// Locally administered addresses are never assigned by the IEEE
+	EXPECT_TRUE(la::networkInterface::NetworkInterfaceHelper::getMacAddressVendor(la::networkInterface::MacAddress{ 0x02, 0x00, 0x00, 0x12, 0x34, 0x56 }).empty());
+}
+
+TEST(PackedMacAddress, Conversion)
+{
+	static_assert(la::networkInterface::PackedMacAddress{ la::networkInterface::MacAddress{ 0x00, 0x1b, 0x92, 0xab, 0xcd, 0xef } }.getValue() == 0x001b92abcdefull, "constexpr packing");
+	static_assert(la::networkInterface::PackedMacAddress{ 0x001b92abcdefull }.toMacAddress()[5] == 0xef, "constexpr unpacking");
+
+	auto const packed = la::networkInterface::PackedMacAddress{ s_TestMacAddress };
+	EXPECT_EQ(0x001b92abcdefull, packed.getValue());
+	EXPECT_EQ(s_TestMacAddress, packed.toMacAddress());
+	EXPECT_EQ(0x001b92u, packed.getOUI());
+	EXPECT_EQ(0x0000ffffffffffffull, la::networkInterface::PackedMacAddress{ 0xffffffffffffffffull }.getValue()) << "Bits above the 48th should be ignored";
+	EXPECT_FALSE(la::networkInterface::PackedMacAddress{}.isValid());
+	EXPECT_TRUE(packed.isValid());
+}
+
+TEST(PackedMacAddress, Bits)
+{
+	auto const unicast = la::networkInterface::PackedMacAddress{ s_TestMacAddress };
+	EXPECT_FALSE(unicast.isMulticast());
+	EXPECT_FALSE(unicast.isLocallyAdministered());
+	EXPECT_FALSE(unicast.isBroadcast());
+
+	auto const multicast = la::networkInterface::PackedMacAddress{ la::networkInterface::MacAddress{ 0x91, 0xe0, 0xf0, 0x00, 0x01, 0x00 } };
+	EXPECT_TRUE(multicast.isMulticast());
+	EXPECT_FALSE(multicast.isLocallyAdministered());
+
+	auto const local = la::networkInterface::PackedMacAddress{ la::networkInterface::MacAddress{ 0x02, 0x42, 0xac, 0x11, 0x00, 0x02 } };
+	EXPECT_FALSE(local.isMulticast());
+	EXPECT_TRUE(local.isLocallyAdministered());
+
+	auto const broadcast = la::networkInterface::PackedMacAddress{ la::networkInterface::MacAddress{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff } };
+	EXPECT_TRUE(broadcast.isBroadcast());
+	EXPECT_TRUE(broadcast.isMulticast());
+}
+
+TEST(PackedMacAddress, ArithmeticAndMasking)
+{
+	auto mac = la::networkInterface::PackedMacAddress{ 0x001b92abcdffull };
+	++mac;
+	EXPECT_EQ(0x001b92abce00ull, mac.getValue()) << "Increment should carry into upper bytes";
+	--mac;
+	EXPECT_EQ(0x001b92abcdffull, mac.getValue());
+	EXPECT_EQ(0u, (la::networkInterface::PackedMacAddress{ 0xffffffffffffull } + 1u).getValue()) << "Arithmetic should wrap modulo 2^48";
+	EXPECT_EQ(0xffffffffffffull, (la::networkInterface::PackedMacAddress{} - 1u).getValue()) << "Arithmetic should wrap modulo 2^48";
+	EXPECT_EQ(0x10u, la::networkInterface::PackedMacAddress{ 0x20u } - la::networkInterface::PackedMacAddress{ 0x10u });
+
+	EXPECT_EQ(0u, la::networkInterface::PackedMacAddress::makeMask(0).getValue());
+	EXPECT_EQ(0xffffff000000ull, la::networkInterface::PackedMacAddress::makeMask(24).getValue());
+	EXPECT_EQ(0xffffffffffffull, la::networkInterface::PackedMacAddress::makeMask(48).getValue());
+	EXPECT_EQ(0xffffffffffffull, la::networkInterface::PackedMacAddress::makeMask(64).getValue()) << "Prefix length should be clamped to 48";
+	EXPECT_EQ(0x000000ffffffull, (~la::networkInterface::PackedMacAddress::makeMask(24)).getValue());
+
+	auto const packed = la::networkInterface::PackedMacAddress{ s_TestMacAddress };
+	EXPECT_EQ(0x001b92000000ull, packed.getFirstAddress(24).getValue());
+	EXPECT_EQ(0x001b92ffffffull, packed.getLastAddress(24).getValue());
+	EXPECT_TRUE(packed.matches(la::networkInterface::PackedMacAddress{ 0x001b92000000ull }, 24));
+	EXPECT_FALSE(packed.matches(la::networkInterface::PackedMacAddress{ 0x001b93000000ull }, 24));
+	EXPECT_TRUE(packed.matches(la::networkInterface::PackedMacAddress{ 0x001b93000000ull }, 15));
+}
+
+TEST(MacAddressFlatSet, Membership)
+{
+	auto set = la::networkInterface::MacAddressFlatSet{ { la::networkInterface::PackedMacAddress{ 30u }, la::networkInterface::PackedMacAddress{ 10u }, la::networkInterface::PackedMacAddress{ 20u }, la::networkInterface::PackedMacAddress{ 10u } } };
+	EXPECT_EQ(3u, set.size()) << "Duplicates should be removed";
+	EXPECT_TRUE(std::is_sorted(set.begin(), set.end()));
+
+	EXPECT_TRUE(set.insert(la::networkInterface::PackedMacAddress{ 15u }));
+	EXPECT_FALSE(set.insert(la::networkInterface::PackedMacAddress{ 15u }));
+	set.insert({ la::networkInterface::PackedMacAddress{ 40u }, la::networkInterface::PackedMacAddress{ 5u }, la::networkInterface::PackedMacAddress{ 20u } });
+	EXPECT_EQ(6u, set.size());
+	EXPECT_TRUE(std::is_sorted(set.begin(), set.end()));
+
+	EXPECT_TRUE(set.erase(la::networkInterface::PackedMacAddress{ 15u }));
+	EXPECT_FALSE(set.erase(la::networkInterface::PackedMacAddress{ 15u }));
+	EXPECT_TRUE(set.contains(la::networkInterface::PackedMacAddress{ 5u }));
+	EXPECT_FALSE(set.contains(la::networkInterface::PackedMacAddress{ 15u }));
+
+	// Bulk membership, with sorted and unsorted queries
+	auto const queries = std::vector<la::networkInterface::PackedMacAddress>{ la::networkInterface::PackedMacAddress{ 5u }, la::networkInterface::PackedMacAddress{ 6u }, la::networkInterface::PackedMacAddress{ 40u }, la::networkInterface::PackedMacAddress{ 10u }, la::networkInterface::PackedMacAddress{ 41u } };
+	bool results[5]{};
+	EXPECT_EQ(3u, set.contains(queries.data(), queries.size(), results));
+	EXPECT_TRUE(results[0]);
+	EXPECT_FALSE(results[1]);
+	EXPECT_TRUE(results[2]);
+	EXPECT_TRUE(results[3]) << "Unsorted query should restart the search";
+	EXPECT_FALSE(results[4]);
+}
+
+TEST(MacAddressFlatSet, Ranges)
+{
+	auto const set = la::networkInterface::MacAddressFlatSet{ { la::networkInterface::PackedMacAddress{ 0x001b92000001ull }, la::networkInterface::PackedMacAddress{ 0x001b92ffffffull }, la::networkInterface::PackedMacAddress{ 0x001b93000000ull }, la::networkInterface::PackedMacAddress{ 0x001b91ffffffull } } };
+
+	auto const [oBegin, oEnd] = set.getPrefixRange(la::networkInterface::PackedMacAddress{ s_TestMacAddress }, 24);
+	ASSERT_EQ(2, std::distance(oBegin, oEnd));
+	EXPECT_EQ(0x001b92000001ull, oBegin->getValue());
+
+	auto const [rBegin, rEnd] = set.getRange(la::networkInterface::PackedMacAddress{ 0x001b92ffffffull }, la::networkInterface::PackedMacAddress{ 0x001b93000000ull });
+	EXPECT_EQ(2, std::distance(rBegin, rEnd)) << "Range should be inclusive";
+
+	auto const [eBegin, eEnd] = set.getRange(la::networkInterface::PackedMacAddress{ 10u }, la::networkInterface::PackedMacAddress{ 5u });
+	EXPECT_EQ(eBegin, eEnd);
+}
+
+TEST(MacAddressFlatSet, FindFreeBlock)
+{
+	auto const set = la::networkInterface::MacAddressFlatSet{ { la::networkInterface::PackedMacAddress{ 100u }, la::networkInterface::PackedMacAddress{ 102u }, la::networkInterface::PackedMacAddress{ 103u }, la::networkInterface::PackedMacAddress{ 108u } } };
+	auto const first = la::networkInterface::PackedMacAddress{ 100u };
+	auto const last = la::networkInterface::PackedMacAddress{ 110u };
+
+	EXPECT_EQ(la::networkInterface::PackedMacAddress{ 101u }, set.findFreeBlock(first, last, 1));
+	EXPECT_EQ(la::networkInterface::PackedMacAddress{ 104u }, set.findFreeBlock(first, last, 4));
+	EXPECT_EQ(la::networkInterface::PackedMacAddress{ 109u }, set.findFreeBlock(la::networkInterface::PackedMacAddress{ 108u }, last, 2)) << "Block at the end of the range";
+	EXPECT_FALSE(set.findFreeBlock(first, last, 5).has_value());
+	EXPECT_FALSE(set.findFreeBlock(first, last, 0).has_value());
+	EXPECT_EQ(la::networkInterface::PackedMacAddress{ 0xfffffffffffeull }, la::networkInterface::MacAddressFlatSet{}.findFreeBlock(la::networkInterface::PackedMacAddress{ 0xfffffffffffeull }, la::networkInterface::PackedMacAddress{ 0xffffffffffffull }, 2));
+}
+
+TEST(MacAddressFlatMap, Operations)
+{
+	using Map = la::networkInterface::MacAddressFlatMap<std::string>;
+	auto map = Map{ { { la::networkInterface::PackedMacAddress{ 20u }, "b" }, { la::networkInterface::PackedMacAddress{ 10u }, "a" }, { la::networkInterface::PackedMacAddress{ 20u }, "c" } } };
+	ASSERT_EQ(2u, map.size()) << "Duplicates should be removed";
+	EXPECT_EQ("b", map.find(la::networkInterface::PackedMacAddress{ 20u })->second) << "First duplicate should be kept";
+
+	EXPECT_TRUE(map.insertOrAssign(la::networkInterface::PackedMacAddress{ 15u }, "d"));
+	EXPECT_FALSE(map.insertOrAssign(la::networkInterface::PackedMacAddress{ 15u }, "e"));
+	EXPECT_EQ("e", map.find(la::networkInterface::PackedMacAddress{ 15u })->second);
+
+	map.insert({ { la::networkInterface::PackedMacAddress{ 5u }, "f" }, { la::networkInterface::PackedMacAddress{ 10u }, "g" } });
+	EXPECT_EQ(4u, map.size());
+	EXPECT_EQ("a", map.find(la::networkInterface::PackedMacAddress{ 10u })->second) << "Bulk insertion should keep existing entries";
+
+	auto const [begin, end] = map.getRange(la::networkInterface::PackedMacAddress{ 6u }, la::networkInterface::PackedMacAddress{ 15u });
+	EXPECT_EQ(2, std::distance(begin, end));
+
+	EXPECT_TRUE(map.erase(la::networkInterface::PackedMacAddress{ 5u }));
+	EXPECT_FALSE(map.contains(la::networkInterface::PackedMacAddress{ 5u }));
+	EXPECT_EQ(map.end(), map.find(la::networkInterface::PackedMacAddress{ 5u }));
+}
@@ -0,0 +1,175 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+// Public API
+#include <la/networkInterfaceHelper/networkInterfaceHelper.h>
+#include <la/networkInterfaceHelper/networkInterfaceHelper.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef> // size_t
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#	include <poll.h>
+#endif // !_WIN32
+
+namespace
+{
+struct MonitorEvents
+{
+	std::size_t batchesCount{ 0u };
+	std::vector<nih_event_kind_t> kinds{};
+	std::size_t interfacesCount{ 0u };
+	std::thread::id threadID{};
+};
+
+void LA_NIH_BINDINGS_C_CALL_CONVENTION onMonitorEvents(void* user_data, nih_event_cp events, size_t events_count, nih_snapshot_cp interfaces)
+{
+	auto& monitorEvents = *static_cast<MonitorEvents*>(user_data);
+	++monitorEvents.batchesCount;
+	for (auto i = size_t{ 0u }; i < events_count; ++i)
+	{
+		monitorEvents.kinds.push_back(events[i].kind);
+	}
+	monitorEvents.interfacesCount = LA_NIH_getSnapshotInterfacesCount(interfaces);
+	monitorEvents.threadID = std::this_thread::get_id();
+}
+
+std::size_t getInterfacesCount() noexcept
+{
+	auto count = std::size_t{ 0u };
+	la::networkInterface::NetworkInterfaceHelper::getInstance().enumerateInterfaces(
+		[&count](la::networkInterface::Interface const& /*intfc*/)
+		{
+			++count;
+		});
+	return count;
+}
+
+std::size_t getObserversCount() noexcept
+{
+	return la::networkInterface::NetworkInterfaceHelper::getInstance().getStatistics().observers.size();
+}
+
+#ifndef _WIN32
+bool isReadable(int const fd, int const timeoutMs) noexcept
+{
+	auto pfd = pollfd{ fd, POLLIN, 0 };
+	return ::poll(&pfd, 1, timeoutMs) == 1 && (pfd.revents & POLLIN) != 0;
+}
+#endif // !_WIN32
+} // namespace
+
+/* ************************************************************ */
+/* C Bindings Monitor Tests                                     */
+/* ************************************************************ */
+TEST(CBindings, CreateMonitorInvalidCallback)
+{
+	EXPECT_EQ(nullptr, LA_NIH_createMonitor(nullptr, nullptr));
+	EXPECT_EQ(nullptr, LA_NIH_createPollableMonitor(nullptr, nullptr));
+	EXPECT_EQ(-1, LA_NIH_getMonitorFileDescriptor(nullptr));
+	EXPECT_EQ(0u, LA_NIH_processMonitorEvents(nullptr));
+	EXPECT_EQ(0u, LA_NIH_getMonitorDroppedEventsCount(nullptr));
+	LA_NIH_destroyMonitor(nullptr);
+}
+
+TEST(CBindings, CallbackMonitor)
+{
+	auto const interfacesCount = getInterfacesCount();
+	auto const observersCount = getObserversCount();
+
+	auto monitorEvents = MonitorEvents{};
+	auto* const monitor = LA_NIH_createMonitor(&onMonitorEvents, &monitorEvents);
+	ASSERT_NE(nullptr, monitor);
+	EXPECT_EQ(observersCount + 1u, getObserversCount()) << "Monitor should be registered";
+	EXPECT_EQ(-1, LA_NIH_getMonitorFileDescriptor(monitor)) << "Callback monitor is not pollable";
+
+	// Already existing interfaces are delivered as a single batch before returning
+	if (interfacesCount != 0u)
+	{
+		EXPECT_EQ(1u, monitorEvents.batchesCount);
+		EXPECT_EQ(interfacesCount, monitorEvents.kinds.size());
+		EXPECT_EQ(interfacesCount, monitorEvents.interfacesCount);
+		for (auto const kind : monitorEvents.kinds)
+		{
+			EXPECT_EQ(nih_event_kind_InterfaceAdded, kind);
+		}
+		EXPECT_EQ(std::this_thread::get_id(), monitorEvents.threadID);
+	}
+
+	LA_NIH_destroyMonitor(monitor);
+	EXPECT_EQ(observersCount, getObserversCount()) << "Destroyed monitor should be unregistered";
+}
+
+TEST(CBindings, PollableMonitor)
+{
+	auto const interfacesCount = getInterfacesCount();
+	auto const observersCount = getObserversCount();
+
+	auto monitorEvents = MonitorEvents{};
+	auto* const monitor = LA_NIH_createPollableMonitor(&onMonitorEvents, &monitorEvents);
+	ASSERT_NE(nullptr, monitor);
+	EXPECT_EQ(observersCount + 1u, getObserversCount()) << "Monitor should be registered";
+	EXPECT_EQ(0u, monitorEvents.batchesCount) << "Pollable monitor should only deliver events from LA_NIH_processMonitorEvents";
+
+	if (interfacesCount != 0u)
+	{
+#ifndef _WIN32
+		auto const fd = LA_NIH_getMonitorFileDescriptor(monitor);
+		ASSERT_NE(-1, fd);
+		EXPECT_TRUE(isReadable(fd, 1000)) << "File descriptor should be readable while events are pending";
+#endif // !_WIN32
+
+		// Pending events are delivered as a single batch, from the calling thread
+		EXPECT_EQ(interfacesCount, LA_NIH_processMonitorEvents(monitor));
+		EXPECT_EQ(1u, monitorEvents.batchesCount);
+		EXPECT_EQ(interfacesCount, monitorEvents.kinds.size());
+		EXPECT_EQ(interfacesCount, monitorEvents.interfacesCount);
+		for (auto const kind : monitorEvents.kinds)
+		{
+			EXPECT_EQ(nih_event_kind_InterfaceAdded, kind);
+		}
+		EXPECT_EQ(std::this_thread::get_id(), monitorEvents.threadID);
+
+#ifndef _WIN32
+		EXPECT_FALSE(isReadable(fd, 0)) << "File descriptor should not be readable anymore once events are processed";
+#endif // !_WIN32
+	}
+	EXPECT_EQ(0u, LA_NIH_processMonitorEvents(monitor)) << "No more pending events";
+	EXPECT_EQ(0u, LA_NIH_getMonitorDroppedEventsCount(monitor)) << "No event should be dropped while under capacity";
+
+	LA_NIH_destroyMonitor(monitor);
+	EXPECT_EQ(observersCount, getObserversCount()) << "Destroyed monitor should be unregistered";
+}
@@ -41,10 +41,26 @@
 
 #include <string>
 #include <unordered_map>
+#include <set>
 #include <mutex>
 #include <thread>
 #include <chrono>
 #include <iostream>
+#include <future>
+#include <atomic>
+#include <vector>
+
+#if defined(__linux__)
+#	include <cstring> // strncpy
+#	include <sched.h> // unshare
+#	include <fcntl.h> // open
+#	include <unistd.h> // close
+#	include <sys/ioctl.h>
+#	include <sys/socket.h>
+#	include <net/if.h>
+#	include <poll.h>
+#	include <cstdlib> // exit
+#endif // __linux__
 
 /* ************************************************************ */
 /* Static Method Tests                                          */
@@ -55,6 +71,845 @@ TEST(NetworkInterfaceHelper, MacAddressToString)
 	EXPECT_STREQ("00:01:02:03:04:05", s.c_str());
 }
 
+/* ************************************************************ */
+/* InterfaceFilter Tests                                        */
+/* ************************************************************ */
+TEST(InterfaceFilter, DefaultMatchesAll)
+{
+	auto const filter = la::networkInterface::InterfaceFilter{};
+	auto intfc = la::networkInterface::Interface{};
+
+	EXPECT_TRUE(filter.matches(intfc));
+	intfc.id = "eth0";
+	intfc.type = la::networkInterface::Interface::Type::Loopback;
+	intfc.isVirtual = true;
+	EXPECT_TRUE(filter.matches(intfc));
+}
+
+TEST(InterfaceFilter, Types)
+{
+	auto filter = la::networkInterface::InterfaceFilter{};
+	filter.types = la::networkInterface::InterfaceFilter::typeMask(la::networkInterface::Interface::Type::Ethernet) | la::networkInterface::InterfaceFilter::typeMask(la::networkInterface::Interface::Type::WiFi);
+	auto intfc = la::networkInterface::Interface{};
+
+	intfc.type = la::networkInterface::Interface::Type::Ethernet;
+	EXPECT_TRUE(filter.matches(intfc));
+	intfc.type = la::networkInterface::Interface::Type::WiFi;
+	EXPECT_TRUE(filter.matches(intfc));
+	intfc.type = la::networkInterface::Interface::Type::Loopback;
+	EXPECT_FALSE(filter.matches(intfc));
+	intfc.type = la::networkInterface::Interface::Type::AWDL;
+	EXPECT_FALSE(filter.matches(intfc));
+}
+
+TEST(InterfaceFilter, NamePattern)
+{
+	auto filter = la::networkInterface::InterfaceFilter{};
+	auto intfc = la::networkInterface::Interface{};
+	intfc.id = "{4D36E972-E325}";
+	intfc.alias = "eth0";
+
+	filter.namePattern = "eth0";
+	EXPECT_TRUE(filter.matches(intfc)) << "Alias should be matched";
+	filter.namePattern = "eth*";
+	EXPECT_TRUE(filter.matches(intfc));
+	filter.namePattern = "e?h?";
+	EXPECT_TRUE(filter.matches(intfc));
+	filter.namePattern = "*";
+	EXPECT_TRUE(filter.matches(intfc));
+	filter.namePattern = "{4D36E972*}";
+	EXPECT_TRUE(filter.matches(intfc)) << "Id should be matched";
+	filter.namePattern = "*0";
+	EXPECT_TRUE(filter.matches(intfc));
+	filter.namePattern = "eth";
+	EXPECT_FALSE(filter.matches(intfc));
+	filter.namePattern = "eth0?";
+	EXPECT_FALSE(filter.matches(intfc));
+	filter.namePattern = "wl*";
+	EXPECT_FALSE(filter.matches(intfc));
+	filter.namePattern = "*1";
+	EXPECT_FALSE(filter.matches(intfc));
+}
+
+TEST(InterfaceFilter, States)
+{
+	auto filter = la::networkInterface::InterfaceFilter{};
+	auto intfc = la::networkInterface::Interface{};
+
+	filter.physicalOnly = true;
+	EXPECT_TRUE(filter.matches(intfc));
+	intfc.isVirtual = true;
+	EXPECT_FALSE(filter.matches(intfc));
+
+	filter = la::networkInterface::InterfaceFilter{};
+	filter.virtualOnly = true;
+	EXPECT_TRUE(filter.matches(intfc));
+	intfc.isVirtual = false;
+	EXPECT_FALSE(filter.matches(intfc));
+
+	filter = la::networkInterface::InterfaceFilter{};
+	filter.enabledOnly = true;
+	filter.connectedOnly = true;
+	EXPECT_FALSE(filter.matches(intfc));
+	intfc.isEnabled = true;
+	EXPECT_FALSE(filter.matches(intfc));
+	intfc.isConnected = true;
+	EXPECT_TRUE(filter.matches(intfc));
+}
+
+TEST(InterfaceFilter, AddressType)
+{
+	auto filter = la::networkInterface::InterfaceFilter{};
+	filter.addressType = la::networkInterface::IPAddress::Type::V4;
+	auto intfc = la::networkInterface::Interface{};
+
+	EXPECT_FALSE(filter.matches(intfc));
+	intfc.ipAddressInfos.push_back(la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "fe80::1" }, la::networkInterface::IPAddress{ la::networkInterface::IPAddress::packedV6FromPrefixLength(64) } });
+	EXPECT_FALSE(filter.matches(intfc));
+	intfc.ipAddressInfos.push_back(la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "192.168.1.1" }, la::networkInterface::IPAddress{ la::networkInterface::makePackedMaskV4(24) } });
+	EXPECT_TRUE(filter.matches(intfc));
+}
+
+TEST(InterfacesSnapshot, Empty)
+{
+	auto const snapshot = la::networkInterface::InterfacesSnapshot{};
+
+	EXPECT_EQ(0u, snapshot.getInterfacesCount());
+	EXPECT_EQ(nullptr, snapshot.data());
+	EXPECT_EQ(0u, snapshot.size());
+	EXPECT_THROW(snapshot.getInterface(0), std::invalid_argument) << "Out of range index should throw";
+}
+
+TEST(InterfacesSnapshot, Build)
+{
+	auto intfc1 = la::networkInterface::Interface{};
+	intfc1.id = "eth0";
+	intfc1.description = "Ethernet adapter";
+	intfc1.alias = "LAN";
+	intfc1.macAddress = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55 };
+	intfc1.ipAddressInfos.push_back({ la::networkInterface::IPAddress{ "192.168.1.10" }, la::networkInterface::IPAddress{ "255.255.255.0" } });
+	intfc1.ipAddressInfos.push_back({ la::networkInterface::IPAddress{ "fe80::1" }, la::networkInterface::IPAddress{ "ffff:ffff:ffff:ffff::" } });
+	intfc1.gateways.push_back(la::networkInterface::IPAddress{ "192.168.1.1" });
+	intfc1.type = la::networkInterface::Interface::Type::Ethernet;
+	intfc1.isEnabled = true;
+	intfc1.isConnected = true;
+	auto intfc2 = la::networkInterface::Interface{};
+	intfc2.id = "lo";
+	intfc2.type = la::networkInterface::Interface::Type::Loopback;
+	intfc2.isVirtual = true;
+
+	auto const snapshot = la::networkInterface::InterfacesSnapshot::build({ &intfc1, &intfc2 });
+	ASSERT_EQ(2u, snapshot.getInterfacesCount());
+	EXPECT_NE(nullptr, snapshot.data());
+	EXPECT_THROW(snapshot.getInterface(2), std::invalid_argument) << "Out of range index should throw";
+
+	auto const& e1 = snapshot.getInterface(0);
+	EXPECT_EQ("eth0", snapshot.getString(e1.id));
+	EXPECT_EQ("Ethernet adapter", snapshot.getString(e1.description));
+	EXPECT_EQ("LAN", snapshot.getString(e1.alias));
+	EXPECT_EQ('\0', snapshot.getString(e1.alias).data()[3]) << "Strings should be NULL-terminated";
+	EXPECT_EQ(intfc1.macAddress, e1.macAddress);
+	EXPECT_EQ(static_cast<std::uint8_t>(la::networkInterface::Interface::Type::Ethernet), e1.type);
+	EXPECT_EQ(1u, e1.isEnabled);
+	EXPECT_EQ(1u, e1.isConnected);
+	EXPECT_EQ(0u, e1.isVirtual);
+
+	ASSERT_EQ(2u, e1.ipAddressesCount);
+	auto const* const ips = snapshot.getIPAddresses(e1);
+	EXPECT_EQ(static_cast<std::uint8_t>(la::networkInterface::IPAddress::Type::V4), ips[0].type);
+	EXPECT_EQ(24u, ips[0].prefixLength);
+	EXPECT_EQ(192u, ips[0].bytes[0]);
+	EXPECT_EQ(168u, ips[0].bytes[1]);
+	EXPECT_EQ(1u, ips[0].bytes[2]);
+	EXPECT_EQ(10u, ips[0].bytes[3]);
+	EXPECT_EQ(static_cast<std::uint8_t>(la::networkInterface::IPAddress::Type::V6), ips[1].type);
+	EXPECT_EQ(64u, ips[1].prefixLength);
+	EXPECT_EQ(0xfeu, ips[1].bytes[0]);
+	EXPECT_EQ(0x80u, ips[1].bytes[1]);
+	EXPECT_EQ(0x01u, ips[1].bytes[15]);
+
+	ASSERT_EQ(1u, e1.gatewaysCount);
+	auto const* const gateways = snapshot.getGateways(e1);
+	EXPECT_EQ(0u, gateways[0].prefixLength);
+	EXPECT_EQ(1u, gateways[0].bytes[3]);
+
+	auto const& e2 = snapshot.getInterface(1);
+	EXPECT_EQ("lo", snapshot.getString(e2.id));
+	EXPECT_TRUE(snapshot.getString(e2.description).empty());
+	EXPECT_EQ(0u, e2.ipAddressesCount);
+	EXPECT_EQ(0u, e2.gatewaysCount);
+	EXPECT_EQ(1u, e2.isVirtual);
+
+	// Relocatable: a copy of the buffer has the same content
+	auto const* const header = reinterpret_cast<la::networkInterface::InterfacesSnapshot::Header const*>(snapshot.data());
+	EXPECT_EQ(la::networkInterface::InterfacesSnapshot::Version, header->version);
+	EXPECT_EQ(snapshot.size(), header->size);
+	EXPECT_EQ(2u, header->interfacesCount);
+}
+
+TEST(InterfacesSnapshot, Rebuild)
+{
+	auto intfc1 = la::networkInterface::Interface{};
+	intfc1.id = "eth0";
+	intfc1.description = "Ethernet adapter";
+	auto intfc2 = la::networkInterface::Interface{};
+	intfc2.id = "lo";
+
+	auto snapshot = la::networkInterface::InterfacesSnapshot::build({ &intfc1, &intfc2 });
+	auto const* const buffer = snapshot.data();
+
+	// A smaller snapshot reuses the buffer, without leftovers of the previous content
+	la::networkInterface::InterfacesSnapshot::build({ &intfc2 }, snapshot);
+	EXPECT_EQ(buffer, snapshot.data()) << "Buffer should be reused when large enough";
+	ASSERT_EQ(1u, snapshot.getInterfacesCount());
+	EXPECT_EQ("lo", snapshot.getString(snapshot.getInterface(0).id));
+	EXPECT_TRUE(snapshot.getString(snapshot.getInterface(0).description).empty());
+	EXPECT_EQ(snapshot.size(), reinterpret_cast<la::networkInterface::InterfacesSnapshot::Header const*>(snapshot.data())->size);
+
+	// A larger snapshot grows the buffer
+	la::networkInterface::InterfacesSnapshot::build({ &intfc1, &intfc2, &intfc1 }, snapshot);
+	ASSERT_EQ(3u, snapshot.getInterfacesCount());
+	EXPECT_EQ("Ethernet adapter", snapshot.getString(snapshot.getInterface(2).description));
+}
+
+TEST(InterfacesSnapshot, MakeIPAddressEntry)
+{
+	auto const v4 = la::networkInterface::InterfacesSnapshot::makeIPAddressEntry(la::networkInterface::IPAddressInfo{ la::networkInterface::IPAddress{ "10.0.0.1" }, la::networkInterface::IPAddress{ "255.254.0.0" } });
+	EXPECT_EQ(static_cast<std::uint8_t>(la::networkInterface::IPAddress::Type::V4), v4.type);
+	EXPECT_EQ(15u, v4.prefixLength);
+	EXPECT_EQ(10u, v4.bytes[0]);
+	EXPECT_EQ(1u, v4.bytes[3]);
+	EXPECT_EQ(0u, v4.bytes[4]) << "Unused bytes should be zero";
+
+	auto const v6 = la::networkInterface::InterfacesSnapshot::makeIPAddressEntry(la::networkInterface::IPAddress{ "2001:db8::ff" }, 0u);
+	EXPECT_EQ(static_cast<std::uint8_t>(la::networkInterface::IPAddress::Type::V6), v6.type);
+	EXPECT_EQ(0u, v6.prefixLength);
+	EXPECT_EQ(0x20u, v6.bytes[0]);
+	EXPECT_EQ(0x01u, v6.bytes[1]);
+	EXPECT_EQ(0x0du, v6.bytes[2]);
+	EXPECT_EQ(0xb8u, v6.bytes[3]);
+	EXPECT_EQ(0xffu, v6.bytes[15]);
+
+	auto const invalid = la::networkInterface::InterfacesSnapshot::makeIPAddressEntry(la::networkInterface::IPAddress{}, 8u);
+	EXPECT_EQ(static_cast<std::uint8_t>(la::networkInterface::IPAddress::Type::None), invalid.type);
+}
+
+TEST(InterfacesSnapshot, TakeSnapshot)
+{
+	auto& helper = la::networkInterface::NetworkInterfaceHelper::getInstance();
+
+	auto count = std::size_t{ 0u };
+	helper.enumerateInterfaces(
+		[&count](la::networkInterface::Interface const&)
+		{
+			++count;
+		});
+
+	auto const snapshot = helper.takeSnapshot();
+	EXPECT_EQ(count, snapshot.getInterfacesCount());
+	for (auto i = 0u; i < snapshot.getInterfacesCount(); ++i)
+	{
+		auto const& entry = snapshot.getInterface(i);
+		EXPECT_NO_THROW(helper.getInterfaceByName(std::string{ snapshot.getString(entry.id) })) << "Snapshot interface should exist";
+	}
+}
+
+TEST(NetworkInterfaceHelper, WaitForTimeout)
+{
+	auto& helper = la::networkInterface::NetworkInterfaceHelper::getInstance();
+
+	auto const start = std::chrono::steady_clock::now();
+	auto const result = helper.waitFor(
+		[](la::networkInterface::Interface const&)
+		{
+			return false;
+		},
+		std::chrono::milliseconds{ 50 });
+	EXPECT_FALSE(result.has_value()) << "Predicate never matching should time out";
+	EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds{ 50 }) << "Should wait for the whole timeout";
+
+	EXPECT_FALSE(helper.waitForInterface("NonExistingInterface", {}, std::chrono::milliseconds{ 10 }).has_value()) << "Non existing interface should time out";
+}
+
+TEST(NetworkInterfaceHelper, WaitForExistingInterface)
+{
+	auto& helper = la::networkInterface::NetworkInterfaceHelper::getInstance();
+
+	auto name = std::string{};
+	helper.enumerateInterfaces(
+		[&name](la::networkInterface::Interface const& intfc)
+		{
+			name = intfc.id;
+		});
+	if (name.empty())
+	{
+		GTEST_SKIP() << "No network interface found";
+	}
+
+	auto const result = helper.waitForInterface(name, {}, std::chrono::seconds{ 10 });
+	ASSERT_TRUE(result.has_value()) << "Existing interface should be returned immediately";
+	EXPECT_EQ(name, result->id);
+}
+
+TEST(NetworkInterfaceHelper, WaitForMaxTimeout)
+{
+	auto& helper = la::networkInterface::NetworkInterfaceHelper::getInstance();
+
+	auto name = std::string{};
+	helper.enumerateInterfaces(
+		[&name](la::networkInterface::Interface const& intfc)
+		{
+			name = intfc.id;
+		});
+	if (name.empty())
+	{
+		GTEST_SKIP() << "No network interface found";
+	}
+
+	// Deadline must saturate instead of overflowing (which would time out immediately)
+	auto const result = helper.waitForInterface(name, {}, std::chrono::milliseconds::max());
+	ASSERT_TRUE(result.has_value()) << "Existing interface should be returned immediately";
+	EXPECT_EQ(name, result->id);
+}
+
+TEST(NetworkInterfaceHelper, WaitForFromObserver)
+{
+	class Obs : public la::networkInterface::NetworkInterfaceHelper::DefaultedObserver
+	{
+	public:
+		explicit Obs(la::networkInterface::NetworkInterfaceHelper& helper) noexcept
+			: _helper{ helper }
+		{
+		}
+		virtual void onInterfaceAdded(la::networkInterface::Interface const& intfc) noexcept override
+		{
+			// Waiting from an observer cannot be woken up by a change, it must not block
+			auto const start = std::chrono::steady_clock::now();
+			hasNoMatch = !_helper.waitFor(
+				[](la::networkInterface::Interface const&)
+				{
+					return false;
+				},
+				std::chrono::seconds{ 10 });
+			auto const result = _helper.waitForInterface(intfc.id, {}, std::chrono::seconds{ 10 });
+			foundSelf = result.has_value() && result->id == intfc.id;
+			duration = std::chrono::steady_clock::now() - start;
+		}
+
+		la::networkInterface::NetworkInterfaceHelper& _helper;
+		bool hasNoMatch{ false };
+		bool foundSelf{ false };
+		std::chrono::steady_clock::duration duration{};
+	};
+
+	auto& helper = la::networkInterface::NetworkInterfaceHelper::getInstance();
+	auto obs = Obs{ helper };
+	helper.registerObserver(&obs);
+	helper.unregisterObserver(&obs);
+
+	if (obs.duration == std::chrono::steady_clock::duration{})
+	{
+		GTEST_SKIP() << "No network interface found";
+	}
+	EXPECT_TRUE(obs.hasNoMatch) << "Predicate never matching should return std::nullopt";
+	EXPECT_TRUE(obs.foundSelf) << "Already known interface should be returned";
+	EXPECT_LT(obs.duration, std::chrono::seconds{ 5 }) << "Waiting from an observer should return immediately";
+}
+
+TEST(NetworkInterfaceHelper, ChangesCompletedAfterInitialInterfaces)
+{
+	class Obs : public la::networkInterface::NetworkInterfaceHelper::DefaultedObserver
+	{
+	public:
+		virtual void onInterfaceAdded(la::networkInterface::Interface const& /*intfc*/) noexcept override
+		{
+			++addedCount;
+		}
+		virtual void onChangesCompleted() noexcept override
+		{
+			++completedCount;
+			addedCountWhenCompleted = addedCount;
+		}
+		size_t addedCount{ 0u };
+		size_t completedCount{ 0u };
+		size_t addedCountWhenCompleted{ 0u };
+	};
+
+	auto& helper = la::networkInterface::NetworkInterfaceHelper::getInstance();
+	auto obs = Obs{};
+	helper.registerObserver(&obs);
+	helper.unregisterObserver(&obs);
+
+	if (obs.addedCount == 0u)
+	{
+		GTEST_SKIP() << "No network interface found";
+	}
+	EXPECT_LE(1u, obs.completedCount) << "Initial interfaces should be completed as a group";
+	EXPECT_EQ(obs.addedCount, obs.addedCountWhenCompleted) << "All initial interfaces should be notified before the group is completed";
+}
+
+TEST(NetworkInterfaceHelper, Statistics)
+{
+	auto& helper = la::networkInterface::NetworkInterfaceHelper::getInstance();
+	auto obs = la::networkInterface::NetworkInterfaceHelper::DefaultedObserver{};
+	helper.registerObserver(&obs);
+
+	auto const statistics = helper.getStatistics();
+	EXPECT_LE(1u, statistics.fullRefreshCount) << "Interfaces should have been queried at least once";
+	EXPECT_EQ(statistics.fullRefreshCount + statistics.interfaceRefreshCount, statistics.refreshDurations.count) << "Each refresh should be recorded";
+	EXPECT_LE(1u, statistics.lockWaitDurations.count) << "Lock acquisitions should be recorded";
+
+	auto found = false;
+	for (auto const& observerStatistics : statistics.observers)
+	{
+		if (observerStatistics.observer == &obs)
+		{
+			found = true;
+		}
+	}
+	EXPECT_TRUE(found) << "Registered observer should be listed";
+
+	helper.unregisterObserver(&obs);
+	for (auto const& observerStatistics : helper.getStatistics().observers)
+	{
+		EXPECT_NE(&obs, observerStatistics.observer) << "Unregistered observer should not be listed";
+	}
+
+	auto const text = la::networkInterface::NetworkInterfaceHelper::statisticsToPrometheusText(statistics, "test");
+	EXPECT_NE(std::string::npos, text.find("# TYPE test_refreshes_total counter\n"));
+	EXPECT_NE(std::string::npos, text.find("test_refreshes_total{type=\"full\"} " + std::to_string(statistics.fullRefreshCount) + "\n"));
+	EXPECT_NE(std::string::npos, text.find("test_refresh_duration_seconds_bucket{le=\"+Inf\"} " + std::to_string(statistics.refreshDurations.count) + "\n"));
+	EXPECT_NE(std::string::npos, text.find("test_observer_callback_duration_seconds_count{observer=\""));
+	EXPECT_NE(std::string::npos, text.find("test_observer_dropped_notifications_total{observer=\""));
+}
+
+TEST(NetworkInterfaceHelper, SlowObserverIsolation)
+{
+	class SlowObserver : public la::networkInterface::NetworkInterfaceHelper::DefaultedObserver
+	{
+	public:
+		virtual void onInterfaceAdded(la::networkInterface::Interface const& /*intfc*/) noexcept override
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+			++addedCount;
+		}
+		virtual void onChangesCompleted() noexcept override
+		{
+			// Called for each group of changes, only report the first one (a promise can only be set once)
+			std::call_once(completedOnce,
+				[this]()
+				{
+					completedThread = std::this_thread::get_id();
+					completedPromise.set_value();
+				});
+		}
+		std::atomic<size_t> addedCount{ 0u };
+		std::thread::id completedThread{};
+		std::once_flag completedOnce{};
+		std::promise<void> completedPromise{};
+	};
+
+	auto& helper = la::networkInterface::NetworkInterfaceHelper::getInstance();
+	auto slowObserverPromise = std::promise<la::networkInterface::NetworkInterfaceHelper::Observer const*>{};
+	helper.setObserverCallbackBudget(std::chrono::milliseconds{ 5 },
+		[&slowObserverPromise](la::networkInterface::NetworkInterfaceHelper::Observer const* const observer, std::chrono::nanoseconds const callbackDuration)
+		{
+			EXPECT_LE(std::chrono::milliseconds{ 5 }, callbackDuration);
+			slowObserverPromise.set_value(observer);
+		});
+
+	auto fastObs = la::networkInterface::NetworkInterfaceHelper::DefaultedObserver{};
+	auto slowObs = SlowObserver{};
+	helper.registerObserver(&fastObs);
+	helper.registerObserver(&slowObs);
+
+	auto slowObserverFuture = slowObserverPromise.get_future();
+	if (slowObserverFuture.wait_for(std::chrono::seconds{ 5 }) != std::future_status::ready)
+	{
+		helper.setObserverCallbackBudget(std::chrono::microseconds{ 0 });
+		GTEST_SKIP() << "No network interface found";
+	}
+	EXPECT_EQ(&slowObs, slowObserverFuture.get()) << "Slow observer should be reported";
+
+	auto completedFuture = slowObs.completedPromise.get_future();
+	ASSERT_EQ(std::future_status::ready, completedFuture.wait_for(std::chrono::seconds{ 5 })) << "Isolated observer should still be notified";
+	EXPECT_NE(std::this_thread::get_id(), slowObs.completedThread) << "Isolated observer should be notified from its own thread";
+
+	for (auto const& observerStatistics : helper.getStatistics().observers)
+	{
+		EXPECT_EQ(observerStatistics.observer == &slowObs, observerStatistics.isIsolated) << "Only the slow observer should be isolated";
+		EXPECT_EQ(0u, observerStatistics.droppedNotificationsCount) << "No notification should be dropped while under capacity";
+	}
+
+	helper.unregisterObserver(&slowObs);
+	helper.unregisterObserver(&fastObs);
+	helper.setObserverCallbackBudget(std::chrono::microseconds{ 0 });
+}
+
+/* ************************************************************ */
+/* Statistics Tests                                             */
+/* ************************************************************ */
+TEST(Statistics, HistogramBuckets)
+{
+	using Histogram = la::networkInterface::NetworkInterfaceHelper::Statistics::Histogram;
+
+	for (auto value = std::uint64_t{ 0u }; value < 8u; ++value)
+	{
+		EXPECT_EQ(value, Histogram::getBucketIndex(value)) << "Small values should have their own bucket";
+	}
+	EXPECT_EQ(Histogram::BucketsCount - 1u, Histogram::getBucketIndex(~std::uint64_t{ 0u }));
+
+	for (auto index = std::size_t{ 0u }; index < Histogram::BucketsCount; ++index)
+	{
+		auto const lowerBound = Histogram::getBucketLowerBound(index);
+		EXPECT_EQ(index, Histogram::getBucketIndex(lowerBound)) << "Lower bound of bucket " << index << " should be recorded in that bucket";
+		if (index > 0u)
+		{
+			EXPECT_EQ(index - 1u, Histogram::getBucketIndex(lowerBound - 1u)) << "Value below bucket " << index << " should be recorded in the previous bucket";
+		}
+	}
+}
+
+TEST(Statistics, HistogramPercentile)
+{
+	using Histogram = la::networkInterface::NetworkInterfaceHelper::Statistics::Histogram;
+
+	auto histogram = Histogram{};
+	EXPECT_EQ(0u, histogram.getPercentile(50.0)) << "Empty histogram";
+
+	for (auto value = std::uint64_t{ 1u }; value <= 1000u; ++value)
+	{
+		++histogram.buckets[Histogram::getBucketIndex(value)];
+		++histogram.count;
+		histogram.sum += value;
+		histogram.max = value;
+	}
+
+	auto const p50 = histogram.getPercentile(50.0);
+	EXPECT_LE(500u, p50);
+	EXPECT_GE(625u, p50) << "Relative error should be below 25%";
+	auto const p99 = histogram.getPercentile(99.0);
+	EXPECT_LE(990u, p99);
+	EXPECT_GE(1000u, p99) << "Percentile should be capped to max";
+	EXPECT_EQ(1000u, histogram.getPercentile(100.0));
+	EXPECT_EQ(1u, histogram.getPercentile(0.0));
+}
+
+#if defined(__linux__)
+TEST(NetworkInterfaceHelper, CreateForInvalidNetworkNamespace)
+{
+	EXPECT_THROW(la::networkInterface::NetworkInterfaceHelper::createForNetworkNamespace(-1), std::invalid_argument) << "Invalid file descriptor should throw";
+	EXPECT_THROW(la::networkInterface::NetworkInterfaceHelper::createForNetworkNamespace(std::string{ "/nonexistent/ns/net" }), std::invalid_argument) << "Non existing path should throw";
+	EXPECT_THROW(la::networkInterface::NetworkInterfaceHelper::createForNetworkNamespace(std::string{ "/proc/self/status" }), std::invalid_argument) << "Path not referring to a network namespace should throw";
+}
+
+TEST(NetworkInterfaceHelper, CreateForCurrentNetworkNamespace)
+{
+	auto helper = la::networkInterface::NetworkInterfaceHelper::UniquePointer{ nullptr, nullptr };
+	try
+	{
+		helper = la::networkInterface::NetworkInterfaceHelper::createForNetworkNamespace(std::string{ "/proc/self/ns/net" });
+	}
+	catch (std::invalid_argument const& e)
+	{
+		GTEST_SKIP() << "Cannot enter the network namespace (missing privileges?): " << e.what();
+	}
+	ASSERT_NE(nullptr, helper);
+
+	// Same namespace as the process, so the same interfaces should be seen
+	auto expectedIDs = std::set<std::string>{};
+	la::networkInterface::NetworkInterfaceHelper::getInstance().enumerateInterfaces(
+		[&expectedIDs](la::networkInterface::Interface const& intfc)
+		{
+			expectedIDs.insert(intfc.id);
+		});
+	auto ids = std::set<std::string>{};
+	helper->enumerateInterfaces(
+		[&ids](la::networkInterface::Interface const& intfc)
+		{
+			ids.insert(intfc.id);
+		});
+	EXPECT_EQ(expectedIDs, ids);
+
+	// Observers of the instance are notified of the already discovered interfaces
+	auto addedIDs = std::set<std::string>{};
+	class Observer final : public la::networkInterface::NetworkInterfaceHelper::DefaultedObserver
+	{
+	public:
+		explicit Observer(std::set<std::string>& addedIDs) noexcept
+			: _addedIDs{ addedIDs }
+		{
+		}
+
+	private:
+		virtual void onInterfaceAdded(la::networkInterface::Interface const& intfc) noexcept override
+		{
+			_addedIDs.insert(intfc.id);
+		}
+
+		std::set<std::string>& _addedIDs;
+	};
+	auto observer = Observer{ addedIDs };
+	helper->registerObserver(&observer);
+	EXPECT_EQ(expectedIDs, addedIDs);
+	helper->unregisterObserver(&observer);
+}
+
+/** Empty network namespace (only containing a down loopback interface), kept alive by a file descriptor, with a socket to change its interfaces */
+class IsolatedNetworkNamespace final
+{
+public:
+	IsolatedNetworkNamespace() noexcept
+	{
+		// unshare only moves the calling thread, so use a temporary one (resources created in the namespace stay attached to it)
+		std::thread(
+			[this]()
+			{
+				if (::unshare(CLONE_NEWNET) == 0)
+				{
+					_netnsFd = ::open("/proc/thread-self/ns/net", O_RDONLY | O_CLOEXEC);
+					_socket = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+				}
+			})
+			.join();
+	}
+	~IsolatedNetworkNamespace() noexcept
+	{
+		if (_socket != -1)
+		{
+			::close(_socket);
+		}
+		if (_netnsFd != -1)
+		{
+			::close(_netnsFd);
+		}
+	}
+
+	bool isValid() const noexcept
+	{
+		return _netnsFd != -1 && _socket != -1;
+	}
+	int getNetnsFd() const noexcept
+	{
+		return _netnsFd;
+	}
+	bool setLinkUp(std::string const& name, bool const up) const noexcept
+	{
+		auto request = ifreq{};
+		std::strncpy(request.ifr_name, name.c_str(), IFNAMSIZ - 1);
+		if (::ioctl(_socket, SIOCGIFFLAGS, &request) != 0)
+		{
+			return false;
+		}
+		request.ifr_flags = static_cast<decltype(request.ifr_flags)>(up ? (request.ifr_flags | IFF_UP) : (request.ifr_flags & ~IFF_UP));
+		return ::ioctl(_socket, SIOCSIFFLAGS, &request) == 0;
+	}
+
+	// Deleted compiler auto-generated methods
+	IsolatedNetworkNamespace(IsolatedNetworkNamespace const&) = delete;
+	IsolatedNetworkNamespace(IsolatedNetworkNamespace&&) = delete;
+	IsolatedNetworkNamespace& operator=(IsolatedNetworkNamespace const&) = delete;
+	IsolatedNetworkNamespace& operator=(IsolatedNetworkNamespace&&) = delete;
+
+private:
+	int _netnsFd{ -1 };
+	int _socket{ -1 };
+};
+
+TEST(NetworkInterfaceHelper, FilteredObserverTransitions)
+{
+	auto const netns = IsolatedNetworkNamespace{};
+	if (!netns.isValid())
+	{
+		GTEST_SKIP() << "Cannot create a network namespace (missing privileges?)";
+	}
+	auto helper = la::networkInterface::NetworkInterfaceHelper::UniquePointer{ nullptr, nullptr };
+	try
+	{
+		helper = la::networkInterface::NetworkInterfaceHelper::createForNetworkNamespace(netns.getNetnsFd());
+	}
+	catch (std::invalid_argument const& e)
+	{
+		GTEST_SKIP() << "Cannot enter the network namespace (missing privileges?): " << e.what();
+	}
+
+	class Observer final : public la::networkInterface::NetworkInterfaceHelper::DefaultedObserver
+	{
+	public:
+		std::vector<std::string> getEvents() const
+		{
+			// Lock
+			auto const lg = std::lock_guard(_lock);
+			return _events;
+		}
+
+	private:
+		void addEvent(std::string const& event)
+		{
+			// Lock
+			auto const lg = std::lock_guard(_lock);
+			_events.push_back(event);
+		}
+		virtual void onInterfaceAdded(la::networkInterface::Interface const& intfc) noexcept override
+		{
+			addEvent("added:" + intfc.id);
+		}
+		virtual void onInterfaceRemoved(la::networkInterface::Interface const& intfc) noexcept override
+		{
+			addEvent("removed:" + intfc.id);
+		}
+		virtual void onInterfaceConnectedStateChanged(la::networkInterface::Interface const& intfc, bool const isConnected) noexcept override
+		{
+			addEvent("connected:" + intfc.id + (isConnected ? ":true" : ":false"));
+		}
+
+		mutable std::mutex _lock{};
+		std::vector<std::string> _events{};
+	};
+	auto const waitForLoopbackConnected = [&helper](bool const isConnected)
+	{
+		return helper
+			->waitFor(
+				[isConnected](la::networkInterface::Interface const& intfc)
+				{
+					return intfc.id == "lo" && intfc.isConnected == isConnected;
+				},
+				std::chrono::seconds{ 5 })
+			.has_value();
+	};
+
+	// A new namespace only contains the loopback interface, which is down
+	ASSERT_TRUE(waitForLoopbackConnected(false));
+
+	auto filter = la::networkInterface::InterfaceFilter{};
+	filter.connectedOnly = true;
+	auto filteredObserver = Observer{};
+	auto observer = Observer{};
+	helper->registerObserver(&filteredObserver, filter);
+	helper->registerObserver(&observer);
+	EXPECT_TRUE(filteredObserver.getEvents().empty()) << "Interface not passing the filter should not be notified on registration";
+	EXPECT_EQ(std::vector<std::string>{ "added:lo" }, observer.getEvents());
+
+	// Interface starting to pass the filter is added (without any change notification, since it wasn't visible yet)
+	ASSERT_TRUE(netns.setLinkUp("lo", true));
+	ASSERT_TRUE(waitForLoopbackConnected(true));
+	EXPECT_EQ(std::vector<std::string>{ "added:lo" }, filteredObserver.getEvents());
+	EXPECT_EQ((std::vector<std::string>{ "added:lo", "connected:lo:true" }), observer.getEvents());
+
+	// Interface stopping to pass the filter is removed (without any change notification, since it isn't visible anymore)
+	ASSERT_TRUE(netns.setLinkUp("lo", false));
+	ASSERT_TRUE(waitForLoopbackConnected(false));
+	EXPECT_EQ((std::vector<std::string>{ "added:lo", "removed:lo" }), filteredObserver.getEvents());
+	EXPECT_EQ((std::vector<std::string>{ "added:lo", "connected:lo:true", "connected:lo:false" }), observer.getEvents());
+
+	helper->unregisterObserver(&observer);
+	helper->unregisterObserver(&filteredObserver);
+}
+
+/** Enables external event processing and checks observers are notified from the thread calling processEvents. Returns 0 on success, the failed step otherwise. */
+static int runExternalEventProcessing() noexcept
+{
+	auto const netns = IsolatedNetworkNamespace{};
+	if (!netns.isValid())
+	{
+		return 1;
+	}
+
+	// Shared by all instances, so it also applies to the network namespace instance
+	auto const eventsFd = la::networkInterface::NetworkInterfaceHelper::enableExternalEventProcessing();
+	if (eventsFd == -1)
+	{
+		return 2;
+	}
+
+	class Observer final : public la::networkInterface::NetworkInterfaceHelper::DefaultedObserver
+	{
+	public:
+		std::atomic_bool isConnected{ false };
+		std::atomic_bool isNotifiedFromOtherThread{ false };
+
+	private:
+		virtual void onInterfaceConnectedStateChanged(la::networkInterface::Interface const& intfc, bool const connected) noexcept override
+		{
+			if (std::this_thread::get_id() != _threadID)
+			{
+				isNotifiedFromOtherThread = true;
+			}
+			if (intfc.id == "lo")
+			{
+				isConnected = connected;
+			}
+		}
+
+		std::thread::id const _threadID{ std::this_thread::get_id() };
+	};
+
+	try
+	{
+		auto helper = la::networkInterface::NetworkInterfaceHelper::createForNetworkNamespace(netns.getNetnsFd());
+		auto observer = Observer{};
+		helper->registerObserver(&observer);
+
+		if (!netns.setLinkUp("lo", true))
+		{
+			return 3;
+		}
+
+		// Pump events from this thread until the change is notified
+		auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{ 5 };
+		while (!observer.isConnected && std::chrono::steady_clock::now() < deadline)
+		{
+			auto pfd = pollfd{ eventsFd, POLLIN, 0 };
+			::poll(&pfd, 1, 100);
+			la::networkInterface::NetworkInterfaceHelper::processEvents();
+		}
+
+		// Waiting from the thread processing events must not block (no change could be received)
+		auto const waitStart = std::chrono::steady_clock::now();
+		auto const intfc = helper->waitFor(
+			[](la::networkInterface::Interface const&)
+			{
+				return false;
+			},
+			std::chrono::seconds{ 10 });
+		auto const isWaitBlocking = intfc.has_value() || (std::chrono::steady_clock::now() - waitStart) >= std::chrono::seconds{ 5 };
+		helper->unregisterObserver(&observer);
+
+		if (!observer.isConnected)
+		{
+			return 4;
+		}
+		if (observer.isNotifiedFromOtherThread)
+		{
+			return 5;
+		}
+		if (isWaitBlocking)
+		{
+			return 7;
+		}
+	}
+	catch (...)
+	{
+		return 6;
+	}
+	return 0;
+}
+
+TEST(NetworkInterfaceHelperDeathTest, ExternalEventProcessing)
+{
+	if (!IsolatedNetworkNamespace{}.isValid())
+	{
+		GTEST_SKIP() << "Cannot create a network namespace (missing privileges?)";
+	}
+
+	// External processing cannot be reverted, run it in a new process (re-executed, so no helper thread is inherited) to not affect the other tests
+	auto const previousStyle = ::testing::GTEST_FLAG(death_test_style);
+	::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+	EXPECT_EXIT(std::exit(runExternalEventProcessing()), ::testing::ExitedWithCode(0), "") << "Observers should be notified from the thread calling processEvents, and waitFor should not block it";
+	::testing::GTEST_FLAG(death_test_style) = previousStyle;
+}
+#endif // __linux__
+
 /*
 * The purpose of this manual test is to check for valid enumeration
 * after the engine has been restarted (ie. All observers removed, then a new one added)
@@ -0,0 +1,178 @@
+/*
+* Copyright (C) 2016-2026, L-Acoustics
+
+* This file is part of LA_networkInterfaceHelper.
+
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+
+*  - Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*  - Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*  - Neither the name of  nor the names of its contributors may be used to
+*    endorse or promote products derived from this software without specific
+*    prior written permission.
+
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+
+* You should have received a copy of the BSD 3-clause License
+* along with LA_networkInterfaceHelper.  If not, see <https://opensource.org/licenses/BSD-3-Clause>.
+*/
+
+// Public API
+#include <la/networkInterfaceHelper/tracing.hpp>
+#include <la/networkInterfaceHelper/networkInterfaceHelper.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+static la::networkInterface::tracing::Event makeEvent(char const* const name, std::uint64_t const startTime, std::uint64_t const duration)
+{
+	auto event = la::networkInterface::tracing::Event{};
+	event.name = name;
+	event.category = la::networkInterface::tracing::Category::Refresh;
+	event.startTime = startTime;
+	event.duration = duration;
+	event.threadID = 1u;
+	return event;
+}
+
+TEST(Tracing, RingBufferSinkOrder)
+{
+	auto sink = la::networkInterface::tracing::RingBufferSink{ 4u };
+	EXPECT_TRUE(sink.getEvents().empty());
+
+	char const* const names[] = { "e0", "e1", "e2", "e3", "e4", "e5" };
+	for (auto const* const name : names)
+	{
+		sink.onEvent(makeEvent(name, 0u, 0u));
+	}
+
+	auto const events = sink.getEvents();
+	ASSERT_EQ(4u, events.size()) << "Only the last 'capacity' events should be kept";
+	EXPECT_STREQ("e2", events[0].name) << "Oldest event should be first";
+	EXPECT_STREQ("e5", events[3].name) << "Newest event should be last";
+}
+
+TEST(Tracing, RingBufferSinkClear)
+{
+	auto sink = la::networkInterface::tracing::RingBufferSink{ 4u };
+	sink.onEvent(makeEvent("before", 0u, 0u));
+	sink.clear();
+	EXPECT_TRUE(sink.getEvents().empty());
+
+	sink.onEvent(makeEvent("after", 0u, 0u));
+	auto const events = sink.getEvents();
+	ASSERT_EQ(1u, events.size());
+	EXPECT_STREQ("after", events[0].name);
+}
+
+TEST(Tracing, RingBufferSinkConcurrentWriters)
+{
+	// Small capacity so writers constantly wrap around slots being written or read
+	auto sink = la::networkInterface::tracing::RingBufferSink{ 4u };
+	auto shouldStop = std::atomic_bool{ false };
+	auto writers = std::vector<std::thread>{};
+	for (auto writer = 1u; writer <= 4u; ++writer)
+	{
+		writers.emplace_back(
+			[&sink, &shouldStop, writer]()
+			{
+				for (auto value = std::uint64_t{ writer }; !shouldStop; value += 4u)
+				{
+					// All the fields of an event are derived from the same value, so a torn event can be detected
+					auto event = makeEvent("concurrent", value, value);
+					event.threadID = value;
+					sink.onEvent(event);
+				}
+			});
+	}
+
+	auto tornEventsCount = 0u;
+	for (auto iteration = 0u; iteration < 20000u; ++iteration)
+	{
+		for (auto const& event : sink.getEvents())
+		{
+			if (event.startTime != event.duration || event.startTime != event.threadID)
+			{
+				++tornEventsCount;
+			}
+		}
+	}
+	shouldStop = true;
+	for (auto& writer : writers)
+	{
+		writer.join();
+	}
+
+	EXPECT_EQ(0u, tornEventsCount) << "Events overwritten while being read should be skipped";
+}
+
+TEST(Tracing, ChromeTraceJson)
+{
+	auto sink = la::networkInterface::tracing::RingBufferSink{ 4u };
+	sink.onEvent(makeEvent("fullRefresh", 1234567u, 5u));
+
+	auto const json = sink.toChromeTraceJson();
+	EXPECT_EQ(0u, json.find("{\"traceEvents\":[")) << json;
+	EXPECT_NE(std::string::npos, json.find("\"name\":\"fullRefresh\",\"cat\":\"refresh\",\"ph\":\"X\",\"pid\":0,\"tid\":1,\"ts\":1234.567,\"dur\":0.005")) << json;
+
+	EXPECT_EQ("{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n", la::networkInterface::tracing::eventsToChromeTraceJson({}));
+}
+
+TEST(Tracing, ObserverCallbacks)
+{
+	if (!la::networkInterface::tracing::isCompiledIn())
+	{
+		GTEST_SKIP() << "Trace points not compiled in";
+	}
+
+	auto sink = la::networkInterface::tracing::RingBufferSink{};
+	la::networkInterface::tracing::setSink(&sink);
+
+	auto& helper = la::networkInterface::NetworkInterfaceHelper::getInstance();
+	auto obs = la::networkInterface::NetworkInterfaceHelper::DefaultedObserver{};
+	helper.registerObserver(&obs);
+	helper.unregisterObserver(&obs);
+	la::networkInterface::tracing::setSink(&la::networkInterface::tracing::getDefaultSink());
+
+	auto hasEnumeration = false;
+	auto hasObserverCallback = false;
+	for (auto const& event : sink.getEvents())
+	{
+		if (event.category == la::networkInterface::tracing::Category::Enumeration)
+		{
+			hasEnumeration = true;
+			EXPECT_EQ(static_cast<void const*>(&helper), event.context);
+		}
+		else if (event.category == la::networkInterface::tracing::Category::ObserverCallback && event.context == &obs)
+		{
+			hasObserverCallback = true;
+		}
+	}
+	EXPECT_TRUE(hasEnumeration) << "Registering an observer should wait for the first enumeration";
+
+	auto interfacesCount = size_t{ 0u };
+	helper.enumerateInterfaces(
+		[&interfacesCount](la::networkInterface::Interface const& /*intfc*/)
+		{
+			++interfacesCount;
+		});
+	EXPECT_EQ(interfacesCount != 0u, hasObserverCallback) << "Each observer callback should be traced";
+}